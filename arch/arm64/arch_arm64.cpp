@@ -23,6 +23,16 @@ using namespace std;
 
 #define EMPTY(S) (S[0] == '\0')
 
+// Like "%s%#" PRIx64 with an optional "-" sign, buf must hold 20 characters
+static const char* FormatImmediate(char* buf, uint64_t magnitude, bool negative = false)
+{
+	char* cur = buf;
+	if (negative)
+		*cur++ = '-';
+	format_hex(cur, magnitude, true);
+	return buf;
+}
+
 #define BINARYNINJA_MANUAL_RELOCATION ((uint64_t)-2)
 
 enum MachoArm64RelocationType : uint32_t
@@ -337,77 +347,33 @@ class Arm64Architecture : public Architecture
 
 
 	void SetInstructionInfoForInstruction(
-	    uint64_t addr, const Instruction& instr, InstructionInfo& result)
+	    uint64_t addr, const InstructionClass& instr, InstructionInfo& result)
 	{
-		result.length = 4;
-		switch (instr.operation)
+		result.length = instr.length;
+		switch (instr.branch)
 		{
-		case ARM64_BL:
-			if (instr.operands[0].operandClass == LABEL)
-				result.AddBranch(CallDestination, instr.operands[0].immediate);
-			break;
-
-		case ARM64_B:
-			if (instr.operands[0].operandClass == LABEL)
-				result.AddBranch(UnconditionalBranch, instr.operands[0].immediate);
-			else
-				result.AddBranch(UnresolvedBranch);
-			break;
-
-		case ARM64_B_EQ:
-		case ARM64_B_NE:
-		case ARM64_B_CS:
-		case ARM64_B_CC:
-		case ARM64_B_MI:
-		case ARM64_B_PL:
-		case ARM64_B_VS:
-		case ARM64_B_VC:
-		case ARM64_B_HI:
-		case ARM64_B_LS:
-		case ARM64_B_GE:
-		case ARM64_B_LT:
-		case ARM64_B_GT:
-		case ARM64_B_LE:
-		case ARM64_B_AL:
-		case ARM64_B_NV:
-			result.AddBranch(TrueBranch, instr.operands[0].immediate);
-			result.AddBranch(FalseBranch, addr + 4);
+		case BRANCH_CALL:
+			result.AddBranch(CallDestination, instr.target);
 			break;
-		case ARM64_TBZ:
-		case ARM64_TBNZ:
-			result.AddBranch(TrueBranch, instr.operands[2].immediate);
-			result.AddBranch(FalseBranch, addr + 4);
+		case BRANCH_UNCONDITIONAL:
+			result.AddBranch(UnconditionalBranch, instr.target);
 			break;
-		case ARM64_CBZ:
-		case ARM64_CBNZ:
-			result.AddBranch(TrueBranch, instr.operands[1].immediate);
+		case BRANCH_CONDITIONAL:
+			result.AddBranch(TrueBranch, instr.target);
 			result.AddBranch(FalseBranch, addr + 4);
 			break;
-		case ARM64_BR:
-		case ARM64_BRAA:
-		case ARM64_BRAAZ:
-		case ARM64_BRAB:
-		case ARM64_BRABZ:
-		case ARM64_DRPS:
+		case BRANCH_INDIRECT:
 			result.AddBranch(UnresolvedBranch);
 			break;
-		case ARM64_ERET:
-		case ARM64_ERETAA:
-		case ARM64_ERETAB:
-		case ARM64_RET:
-		case ARM64_RETAA:
-		case ARM64_RETAB:
+		case BRANCH_RETURN:
 			result.AddBranch(FunctionReturn);
 			break;
-		case ARM64_SVC:
-		case ARM64_HVC:
-		case ARM64_SMC:
+		case BRANCH_SYSCALL:
 			result.AddBranch(SystemCall);
 			break;
-		case ARM64_UDF:
+		case BRANCH_EXCEPTION:
 			result.AddBranch(ExceptionBranch);
 			break;
-
 		default:
 			break;
 		}
@@ -427,8 +393,8 @@ class Arm64Architecture : public Architecture
 			result.emplace_back(TextToken, shiftStr);
 			if (operand->shiftValueUsed != 0)
 			{
-				char buf[64] = {0};
-				snprintf(buf, sizeof(buf), "%#x", (uint32_t)operand->shiftValue);
+				char buf[20];
+				FormatImmediate(buf, (uint32_t)operand->shiftValue);
 				result.emplace_back(OperationToken, " #");
 				result.emplace_back(IntegerToken, buf, operand->shiftValue);
 			}
@@ -441,14 +407,14 @@ class Arm64Architecture : public Architecture
 	    const InstructionOperand* __restrict operand, vector<InstructionTextToken>& result)
 	{
 		char buf[64] = {0};
-		const char* sign = "";
+		bool negative = false;
 		if (operand == NULL)
 			return FAILED_TO_DISASSEMBLE_OPERAND;
 
 		uint64_t imm = operand->immediate;
 		if (operand->signedImm == 1 && ((int64_t)imm) < 0)
 		{
-			sign = "-";
+			negative = true;
 			imm = -(int64_t)imm;
 		}
 
@@ -468,18 +434,15 @@ class Arm64Architecture : public Architecture
 			break;
 		}
 		case IMM32:
-			snprintf(buf, sizeof(buf), "%s%#x", sign, (uint32_t)imm);
 			result.emplace_back(OperationToken, "#");
-			result.emplace_back(IntegerToken, buf, operand->immediate);
+			result.emplace_back(IntegerToken, FormatImmediate(buf, (uint32_t)imm, negative), operand->immediate);
 			break;
 		case IMM64:
-			snprintf(buf, sizeof(buf), "%s%#" PRIx64, sign, imm);
 			result.emplace_back(OperationToken, "#");
-			result.emplace_back(IntegerToken, buf, operand->immediate);
+			result.emplace_back(IntegerToken, FormatImmediate(buf, imm, negative), operand->immediate);
 			break;
 		case LABEL:
-			snprintf(buf, sizeof(buf), "%#" PRIx64, operand->immediate);
-			result.emplace_back(PossibleAddressToken, buf, operand->immediate);
+			result.emplace_back(PossibleAddressToken, FormatImmediate(buf, operand->immediate), operand->immediate);
 			break;
 		default:
 			return FAILED_TO_DISASSEMBLE_OPERAND;
@@ -505,13 +468,10 @@ class Arm64Architecture : public Architecture
 	uint32_t tokenize_register(const InstructionOperand* restrict operand, uint32_t registerNumber,
 	    vector<InstructionTextToken>& result)
 	{
-		char buf[64] = {0};
-
 		/* case: system registers */
 		if (operand->operandClass == SYS_REG)
 		{
-			snprintf(buf, sizeof(buf), "%s", get_system_register_name((SystemReg)operand->sysreg));
-			result.emplace_back(RegisterToken, buf);
+			result.emplace_back(RegisterToken, get_system_register_name((SystemReg)operand->sysreg));
 			return DISASM_SUCCESS;
 		}
 
@@ -547,7 +507,8 @@ class Arm64Architecture : public Architecture
 		/* only use index if this is isolated REG (not, for example, MULTIREG */
 		if (operand->operandClass == REG && operand->laneUsed)
 		{
-			snprintf(buf, sizeof(buf), "%u", operand->lane);
+			char buf[24];
+			format_unsigned(buf, operand->lane);
 			result.emplace_back(BraceToken, "[");
 			result.emplace_back(IntegerToken, buf);
 			result.emplace_back(BraceToken, "]");
@@ -561,18 +522,17 @@ class Arm64Architecture : public Architecture
 	    const InstructionOperand* restrict operand, vector<InstructionTextToken>& result)
 	{
 		char immBuff[32] = {0};
-		char paramBuff[32] = {0};
 		const char *reg0, *reg1;
 
 		reg0 = get_register_name(operand->reg[0]);
 		if (EMPTY(reg0))
 			return FAILED_TO_DISASSEMBLE_REGISTER;
 
-		const char* sign = "";
+		bool negative = false;
 		int64_t imm = operand->immediate;
 		if (operand->signedImm && (int64_t)imm < 0)
 		{
-			sign = "-";
+			negative = true;
 			imm = -imm;
 		}
 		const char* startToken = "[";
@@ -588,7 +548,7 @@ class Arm64Architecture : public Architecture
 			break;
 		case MEM_PRE_IDX:
 			endToken = "!";
-			snprintf(immBuff, sizeof(immBuff), "%s%#" PRIx64, sign, (uint64_t)imm);
+			FormatImmediate(immBuff, (uint64_t)imm, negative);
 			result.emplace_back(TextToken, ", ");
 			result.emplace_back(OperationToken, "#");
 			result.emplace_back(IntegerToken, immBuff, operand->immediate);
@@ -597,12 +557,12 @@ class Arm64Architecture : public Architecture
 			endToken = NULL;
 			if (operand->reg[1] == REG_NONE)
 			{
-				snprintf(paramBuff, sizeof(paramBuff), "%s%#" PRIx64, sign, (uint64_t)imm);
+				FormatImmediate(immBuff, (uint64_t)imm, negative);
 				result.emplace_back(EndMemoryOperandToken, "");
 				result.emplace_back(BraceToken, "]");
 				result.emplace_back(TextToken, ", ");
 				result.emplace_back(OperationToken, "#");
-				result.emplace_back(IntegerToken, paramBuff, operand->immediate);
+				result.emplace_back(IntegerToken, immBuff, operand->immediate);
 			}
 			else
 			{
@@ -619,7 +579,7 @@ class Arm64Architecture : public Architecture
 		case MEM_OFFSET:  // [<reg> optional(imm)]
 			if (operand->immediate != 0)
 			{
-				snprintf(immBuff, sizeof(immBuff), "%s%#" PRIx64, sign, (uint64_t)imm);
+				FormatImmediate(immBuff, (uint64_t)imm, negative);
 				result.emplace_back(TextToken, ", ");
 				result.emplace_back(OperationToken, "#");
 				result.emplace_back(IntegerToken, immBuff, operand->immediate);
@@ -670,7 +630,7 @@ class Arm64Architecture : public Architecture
 		if (operand->laneUsed)
 		{
 			result.emplace_back(BraceToken, "[");
-			snprintf(index, sizeof(index), "%d", operand->lane);
+			format_unsigned(index, operand->lane);
 			result.emplace_back(IntegerToken, index, operand->lane);
 			result.emplace_back(BraceToken, "]");
 		}
@@ -772,8 +732,12 @@ class Arm64Architecture : public Architecture
 		if (maxLen < 4)
 			return false;
 
-		Instruction instr;
-		if (!Disassemble(data, addr, maxLen, instr))
+		if (m_onlyDisassembleOnAlignedAddresses && (addr % 4 != 0))
+			return false;
+
+		// Branch classification only, building the operands is left to GetInstructionText and lifting
+		InstructionClass instr;
+		if (aarch64_classify(*(uint32_t*)data, &instr, addr) != 0)
 			return false;
 
 		SetInstructionInfoForInstruction(addr, instr, result);
@@ -787,25 +751,20 @@ class Arm64Architecture : public Architecture
 		len = 4;
 		Instruction instr;
 		bool tokenizeSuccess = false;
-		char buf[9];
+		char buf[24];
 		if (!Disassemble(data, addr, len, instr))
 			return false;
 
-		memset(buf, 0x20, sizeof(buf));
 		const char* operation = get_operation(&instr);
 		if (operation == nullptr)
 			return false;
 
+		// Pad the operation to 8 columns, with at least one space
+		static const char padding[] = "        ";
 		size_t operationLen = strlen(operation);
-		if (operationLen < 8)
-		{
-			buf[8 - operationLen] = '\0';
-		}
-		else
-			buf[1] = '\0';
 
 		result.emplace_back(InstructionToken, operation);
-		result.emplace_back(TextToken, buf);
+		result.emplace_back(TextToken, padding + (operationLen < 8 ? operationLen : 7));
 		for (size_t i = 0; i < MAX_OPERANDS; i++)
 		{
 			if (instr.operands[i].operandClass == NONE)
@@ -851,24 +810,24 @@ class Arm64Architecture : public Architecture
 			case STR_IMM: /* eg: "mul #0xe" */
 				result.emplace_back(TextToken, instr.operands[i].name);
 				result.emplace_back(OperationToken, " #");
-				snprintf(buf, sizeof(buf), "0x%" PRIx64, instr.operands[i].immediate);
+				format_hex(buf, instr.operands[i].immediate, false);
 				result.emplace_back(IntegerToken, buf);
 				tokenizeSuccess = true;
 				break;
 			case ACCUM_ARRAY: /* eg: "za[w12, #0x6]" */
 				result.emplace_back(TextToken, "ZA");
 				result.emplace_back(BraceToken, "[");
-				snprintf(buf, sizeof(buf), "%s", get_register_name(operand->reg[0]));
-				result.emplace_back(RegisterToken, buf);
+				result.emplace_back(RegisterToken, get_register_name(operand->reg[0]));
 				result.emplace_back(OperandSeparatorToken, ", ");
 				result.emplace_back(OperationToken, " #");
-				snprintf(buf, sizeof(buf), "0x%" PRIx64, operand->immediate);
+				format_hex(buf, operand->immediate, false);
 				result.emplace_back(IntegerToken, buf);
 				result.emplace_back(BraceToken, "]");
 				tokenizeSuccess = true;
 				break;
 			case SME_TILE: /* eg: "z0v.b[w12, #0xb]" */
-				snprintf(buf, sizeof(buf), "Z%d", operand->tile);
+				buf[0] = 'Z';
+				format_unsigned(buf + 1, operand->tile);
 				result.emplace_back(TextToken, buf);
 				if (operand->slice == SLICE_HORIZONTAL)
 					result.emplace_back(TextToken, "h");
@@ -878,13 +837,12 @@ class Arm64Architecture : public Architecture
 				if (operand->reg[0] != REG_NONE)
 				{
 					result.emplace_back(BraceToken, "[");
-					snprintf(buf, sizeof(buf), "%s", get_register_name(operand->reg[0]));
-					result.emplace_back(RegisterToken, buf);
+					result.emplace_back(RegisterToken, get_register_name(operand->reg[0]));
 					if (operand->arrSpec != ARRSPEC_FULL)
 					{
 						result.emplace_back(OperandSeparatorToken, ", ");
 						result.emplace_back(OperationToken, " #");
-						snprintf(buf, sizeof(buf), "0x%" PRIx64, instr.operands[i].immediate);
+						format_hex(buf, instr.operands[i].immediate, false);
 						result.emplace_back(IntegerToken, buf);
 					}
 					result.emplace_back(BraceToken, "]");
@@ -900,7 +858,7 @@ class Arm64Architecture : public Architecture
 				{
 					result.emplace_back(OperandSeparatorToken, ", ");
 					result.emplace_back(OperationToken, "#");
-					snprintf(buf, sizeof(buf), "0x%" PRIx64, operand->immediate);
+					format_hex(buf, operand->immediate, false);
 					result.emplace_back(IntegerToken, buf);
 				}
 				result.emplace_back(BraceToken, "]");
@@ -4,31 +4,38 @@
 int decode_spec(context* ctx, Instruction* dec);        // from decode0.cpp
 int decode_scratchpad(context* ctx, Instruction* dec);  // from decode_scratchpad.c
 
+static void init_context(context* ctx, uint32_t instructionValue, uint64_t address)
+{
+	ctx->halted = 1;  // enable disassembly of exception instructions like DCPS1
+	ctx->insword = instructionValue;
+	ctx->address = address;
+	ctx->features0 = ARCH_FEATURES_ALL;
+	ctx->features1 = ARCH_FEATURES_ALL;
+	ctx->EDSCR_HDE = 1;
+}
+
+static bool accept_decode_status(int rc, const Instruction* instr)
+{
+	if (rc == DECODE_STATUS_OK)
+		return true;
+
+	/* exceptional cases where we accept a non-OK decode status */
+	if (rc == DECODE_STATUS_END_OF_INSTRUCTION && instr->encoding == ENC_HINT_HM_HINTS)
+		return true;
+
+	/* no exception! fail! */
+	return false;
+}
+
 int aarch64_decompose(uint32_t instructionValue, Instruction* instr, uint64_t address)
 {
 	context ctx = {0};
-	ctx.halted = 1;  // enable disassembly of exception instructions like DCPS1
-	ctx.insword = instructionValue;
-	ctx.address = address;
-	ctx.features0 = ARCH_FEATURES_ALL;
-	ctx.features1 = ARCH_FEATURES_ALL;
-	ctx.EDSCR_HDE = 1;
+	init_context(&ctx, instructionValue, address);
 
 	/* have the spec-generated code populate all the pcode variables */
 	int rc = decode_spec(&ctx, instr);
-
-	if (rc != DECODE_STATUS_OK)
-	{
-		/* exceptional cases where we accept a non-OK decode status */
-		if (rc == DECODE_STATUS_END_OF_INSTRUCTION && instr->encoding == ENC_HINT_HM_HINTS)
-		{
-			while (0)
-				;
-		}
-		/* no exception! fail! */
-		else
-			return rc;
-	}
+	if (!accept_decode_status(rc, instr))
+		return rc;
 
 	/* if UDF encoding, return undefined */
 	// if(instr->encoding == ENC_UDF_ONLY_PERM_UNDEF)
@@ -37,3 +44,110 @@ int aarch64_decompose(uint32_t instructionValue, Instruction* instr, uint64_t ad
 	/* convert the pcode variables to list of operands, etc. */
 	return decode_scratchpad(&ctx, instr);
 }
+
+/* immediate branches, indexed by bits [31,24] of the instruction word */
+struct direct_branch
+{
+	uint8_t branch; /* enum BranchKind, BRANCH_NONE if not an immediate branch */
+	uint8_t lsb;    /* position and width of the signed word offset */
+	uint8_t width;
+};
+
+#define B_IMM26  {BRANCH_UNCONDITIONAL, 0, 26}
+#define BL_IMM26 {BRANCH_CALL, 0, 26}
+#define B_IMM19  {BRANCH_CONDITIONAL, 5, 19}
+#define B_IMM14  {BRANCH_CONDITIONAL, 5, 14}
+
+static const struct direct_branch direct_branches[256] = {
+	[0x14] = B_IMM26, [0x15] = B_IMM26, [0x16] = B_IMM26, [0x17] = B_IMM26, /* b */
+	[0x94] = BL_IMM26, [0x95] = BL_IMM26, [0x96] = BL_IMM26, [0x97] = BL_IMM26, /* bl */
+	[0x54] = B_IMM19, /* b.<cond>, only if o0 (bit 4) is clear */
+	[0x34] = B_IMM19, [0x35] = B_IMM19, [0xB4] = B_IMM19, [0xB5] = B_IMM19, /* cbz, cbnz */
+	[0x36] = B_IMM14, [0x37] = B_IMM14, [0xB6] = B_IMM14, [0xB7] = B_IMM14, /* tbz, tbnz */
+};
+
+int aarch64_classify(uint32_t instructionValue, InstructionClass* result, uint64_t address)
+{
+	result->length = 4;
+	result->branch = BRANCH_NONE;
+	result->target = 0;
+
+	/* immediate branches have no unallocated or feature dependent encodings, except for b.<cond> */
+	const struct direct_branch* direct = &direct_branches[instructionValue >> 24];
+	if (direct->branch != BRANCH_NONE && !((instructionValue >> 24) == 0x54 && (instructionValue & 0x10)))
+	{
+		int shift = 32 - direct->lsb - direct->width;
+		int64_t offset = ((int32_t)(instructionValue << shift) >> (shift + direct->lsb)) * 4;
+		result->branch = direct->branch;
+		result->target = address + offset;
+		return DECODE_STATUS_OK;
+	}
+
+	/* everything else needs the spec decoder to know if it is allocated, but no operands */
+	context ctx = {0};
+	Instruction instr;
+	instr.encoding = ENC_UNKNOWN;
+	init_context(&ctx, instructionValue, address);
+
+	int rc = decode_spec(&ctx, &instr);
+	if (!accept_decode_status(rc, &instr))
+		return rc;
+
+	switch (instr.encoding)
+	{
+	/* decode_scratchpad() has no operands for these, so aarch64_decompose() rejects them */
+	case ENC_BFDOT_ASIMDELEM_E:
+	case ENC_BFMLAL_ASIMDELEM_F:
+	case ENC_BFMLAL_ASIMDSAME2_F_:
+	case ENC_BFMMLA_ASIMDSAME2_E:
+	case ENC_ZERO_ZA_I_:
+		return DECODE_STATUS_ERROR_OPERANDS;
+
+	case ENC_BL_ONLY_BRANCH_IMM:
+		result->branch = BRANCH_CALL;
+		result->target = address + ctx.offset;
+		break;
+	case ENC_B_ONLY_BRANCH_IMM:
+		result->branch = BRANCH_UNCONDITIONAL;
+		result->target = address + ctx.offset;
+		break;
+	case ENC_B_ONLY_CONDBRANCH:
+	case ENC_CBZ_32_COMPBRANCH:
+	case ENC_CBZ_64_COMPBRANCH:
+	case ENC_CBNZ_32_COMPBRANCH:
+	case ENC_CBNZ_64_COMPBRANCH:
+	case ENC_TBZ_ONLY_TESTBRANCH:
+	case ENC_TBNZ_ONLY_TESTBRANCH:
+		result->branch = BRANCH_CONDITIONAL;
+		result->target = address + ctx.offset;
+		break;
+	case ENC_BR_64_BRANCH_REG:
+	case ENC_BRAA_64P_BRANCH_REG:
+	case ENC_BRAAZ_64_BRANCH_REG:
+	case ENC_BRAB_64P_BRANCH_REG:
+	case ENC_BRABZ_64_BRANCH_REG:
+	case ENC_DRPS_64E_BRANCH_REG:
+		result->branch = BRANCH_INDIRECT;
+		break;
+	case ENC_ERET_64E_BRANCH_REG:
+	case ENC_ERETAA_64E_BRANCH_REG:
+	case ENC_ERETAB_64E_BRANCH_REG:
+	case ENC_RET_64R_BRANCH_REG:
+	case ENC_RETAA_64E_BRANCH_REG:
+	case ENC_RETAB_64E_BRANCH_REG:
+		result->branch = BRANCH_RETURN;
+		break;
+	case ENC_SVC_EX_EXCEPTION:
+	case ENC_HVC_EX_EXCEPTION:
+	case ENC_SMC_EX_EXCEPTION:
+		result->branch = BRANCH_SYSCALL;
+		break;
+	case ENC_UDF_ONLY_PERM_UNDEF:
+		result->branch = BRANCH_EXCEPTION;
+		break;
+	default:
+		break;
+	}
+
+	return DECODE_STATUS_OK;
+}
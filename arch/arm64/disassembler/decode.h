@@ -567,12 +567,41 @@ struct Instruction
 typedef struct Instruction Instruction;
 #endif
 
+//-----------------------------------------------------------------------------
+// branch classification (OUTPUT of aarch64_classify)
+//-----------------------------------------------------------------------------
+
+enum BranchKind
+{
+	BRANCH_NONE,
+	BRANCH_CALL,           // bl
+	BRANCH_UNCONDITIONAL,  // b
+	BRANCH_CONDITIONAL,    // b.<cond>, cbz, cbnz, tbz, tbnz
+	BRANCH_INDIRECT,       // br, braa, braaz, brab, brabz, drps
+	BRANCH_RETURN,         // ret, retaa, retab, eret, eretaa, eretab
+	BRANCH_SYSCALL,        // svc, hvc, smc
+	BRANCH_EXCEPTION       // udf
+};
+
+struct InstructionClass
+{
+	uint32_t length;
+	enum BranchKind branch;
+	uint64_t target;  // for calls, unconditional and conditional branches
+};
+
+#ifndef __cplusplus
+typedef struct InstructionClass InstructionClass;
+#endif
+
 #ifdef __cplusplus
 extern "C"
 {
 #endif
 
 	int aarch64_decompose(uint32_t instructionValue, Instruction* instr, uint64_t address);
+	// same status as aarch64_decompose(), but only classifies branches, without building operands
+	int aarch64_classify(uint32_t instructionValue, InstructionClass* result, uint64_t address);
 	size_t get_register_size(enum Register);
 
 #ifdef __cplusplus
@@ -8,46 +8,127 @@
 #include "regs.h"
 #include "pcode.h"
 
-const char *get_arrspec_str(ArrangementSpec arrspec)
+//-----------------------------------------------------------------------------
+// printf-free formatting
+//-----------------------------------------------------------------------------
+
+static const char hex_digits[] = "0123456789abcdef";
+
+size_t format_hex(char *out, uint64_t value, bool alternate)
 {
-	switch(arrspec) {
-		case ARRSPEC_FULL: return ".1q";
-		case ARRSPEC_2DOUBLES: return ".2d";
-		case ARRSPEC_4SINGLES: return ".4s";
-		case ARRSPEC_8HALVES: return ".8h";
-		case ARRSPEC_16BYTES: return ".16b";
-		case ARRSPEC_1DOUBLE: return ".1d";
-		case ARRSPEC_2SINGLES: return ".2s";
-		case ARRSPEC_4HALVES: return ".4h";
-		case ARRSPEC_8BYTES: return ".8b";
-		case ARRSPEC_1SINGLE: return ".1s";
-		case ARRSPEC_2HALVES: return ".2h";
-		case ARRSPEC_4BYTES: return ".4b";
-		case ARRSPEC_1HALF: return ".1h";
-		case ARRSPEC_1BYTE: return ".1b";
-		default: return "";
+	char digits[16];
+	size_t n = 0, len = 0;
+
+	do {
+		digits[n++] = hex_digits[value & 15];
+		value >>= 4;
+	} while (value);
+
+	/* "%#x" leaves zero unprefixed, "0x%x" does not */
+	if (!alternate || n > 1 || digits[0] != '0') {
+		out[len++] = '0';
+		out[len++] = 'x';
 	}
+	while (n)
+		out[len++] = digits[--n];
+	out[len] = '\0';
+	return len;
 }
 
-const char *get_arrspec_str_truncated(ArrangementSpec arrspec)
+size_t format_unsigned(char *out, uint64_t value)
 {
-	switch(arrspec) {
-		case ARRSPEC_FULL: return ".q";
-		case ARRSPEC_2DOUBLES: return ".d";
-		case ARRSPEC_4SINGLES: return ".s";
-		case ARRSPEC_8HALVES: return ".h";
-		case ARRSPEC_16BYTES: return ".b";
-		case ARRSPEC_1DOUBLE: return ".d";
-		case ARRSPEC_2SINGLES: return ".s";
-		case ARRSPEC_4HALVES: return ".h";
-		case ARRSPEC_8BYTES: return ".b";
-		case ARRSPEC_1SINGLE: return ".s";
-		case ARRSPEC_2HALVES: return ".h";
-		case ARRSPEC_4BYTES: return ".4b"; // not an error, UDOT_asimdelem_D and SDOT_asimdelem_D use this
-		case ARRSPEC_1HALF: return ".h";
-		case ARRSPEC_1BYTE: return ".b";
-		default: return "";
+	char digits[20];
+	size_t n = 0, len = 0;
+
+	do {
+		digits[n++] = '0' + (value % 10);
+		value /= 10;
+	} while (value);
+
+	while (n)
+		out[len++] = digits[--n];
+	out[len] = '\0';
+	return len;
+}
+
+/* bounded string builder, the replacement for snprintf() into fixed size buffers */
+struct text {
+	char *cur;
+	char *end;
+	bool overflow;
+};
+
+static void text_init(struct text *t, char *buf, size_t size)
+{
+	t->cur = buf;
+	t->end = buf + size;
+	t->overflow = size == 0;
+	if (size)
+		*buf = '\0';
+}
+
+static void text_append(struct text *t, const char *str, size_t len)
+{
+	if (t->overflow || len >= (size_t)(t->end - t->cur)) {
+		t->overflow = true;
+		return;
 	}
+	memcpy(t->cur, str, len);
+	t->cur += len;
+	*t->cur = '\0';
+}
+
+static void text_str(struct text *t, const char *str)
+{
+	text_append(t, str, strlen(str));
+}
+
+static void text_char(struct text *t, char c)
+{
+	text_append(t, &c, 1);
+}
+
+static void text_hex(struct text *t, uint64_t value, bool alternate)
+{
+	char buf[20];
+	text_append(t, buf, format_hex(buf, value, alternate));
+}
+
+static void text_unsigned(struct text *t, uint64_t value)
+{
+	char buf[24];
+	text_append(t, buf, format_unsigned(buf, value));
+}
+
+//-----------------------------------------------------------------------------
+// registers to string
+//-----------------------------------------------------------------------------
+
+/* indexed by ArrangementSpec */
+static const char *arrspec_strings[] = {
+	"", ".1q", ".2d", ".4s", ".8h", ".16b", ".1d", ".2s",
+	".4h", ".8b", ".1s", ".2h", ".4b", ".1h", ".1b"
+};
+
+static const char *arrspec_strings_truncated[] = {
+	"", ".q", ".d", ".s", ".h", ".b", ".d", ".s",
+	".h", ".b", ".s", ".h",
+	".4b", // not an error, UDOT_asimdelem_D and SDOT_asimdelem_D use this
+	".h", ".b"
+};
+
+const char *get_arrspec_str(ArrangementSpec arrspec)
+{
+	if ((unsigned)arrspec > ARRSPEC_1BYTE)
+		return "";
+	return arrspec_strings[arrspec];
+}
+
+const char *get_arrspec_str_truncated(ArrangementSpec arrspec)
+{
+	if ((unsigned)arrspec > ARRSPEC_1BYTE)
+		return "";
+	return arrspec_strings_truncated[arrspec];
 }
 
 const char *get_register_arrspec(Register reg, const InstructionOperand *operand)
@@ -68,31 +149,39 @@ const char *get_register_arrspec(Register reg, const InstructionOperand *operand
 	return get_arrspec_str(operand->arrSpec);
 }
 
-int get_register_full(Register reg, const InstructionOperand *operand, char *result)
+static int text_register_full(struct text *t, Register reg, const InstructionOperand *operand)
 {
-	strcpy(result, get_register_name(reg));
-	if(result[0] == '\0')
+	const char *name = get_register_name(reg);
+	if(name[0] == '\0')
 		return -1;
 
-	strcat(result, get_register_arrspec(reg, operand));
-
+	text_str(t, name);
+	text_str(t, get_register_arrspec(reg, operand));
 	return 0;
 }
 
+int get_register_full(Register reg, const InstructionOperand *operand, char *result)
+{
+	struct text t;
+	text_init(&t, result, 16);
+	return text_register_full(&t, reg, operand) || t.overflow ? -1 : 0;
+}
+
 //-----------------------------------------------------------------------------
 // miscellany to string
 //-----------------------------------------------------------------------------
 
 uint32_t get_implementation_specific(const InstructionOperand *operand, char *outBuffer, uint32_t outBufferSize)
 {
-	return snprintf(outBuffer,
-			outBufferSize,
-			"s%d_%d_c%d_c%d_%d",
-			operand->implspec[0],
-			operand->implspec[1],
-			operand->implspec[2],
-			operand->implspec[3],
-			operand->implspec[4]) >= outBufferSize;
+	/* "s<op0>_<op1>_c<CRn>_c<CRm>_<op2>" */
+	static const char *separators[] = {"s", "_", "_c", "_c", "_"};
+	struct text t;
+	text_init(&t, outBuffer, outBufferSize);
+	for (int i = 0; i < 5; i++) {
+		text_str(&t, separators[i]);
+		text_unsigned(&t, operand->implspec[i]);
+	}
+	return t.overflow;
 }
 
 const char *get_operation(const Instruction *inst)
@@ -134,41 +223,39 @@ const char *get_shift(ShiftType shift)
 // operand processing helpers
 //-----------------------------------------------------------------------------
 
+/* ", <shift>{ #<amount>}" */
+static uint32_t text_shift(struct text *t, const InstructionOperand *operand)
+{
+	if (operand->shiftType == ShiftType_NONE)
+		return DISASM_SUCCESS;
+
+	const char *shiftStr = get_shift(operand->shiftType);
+	if (shiftStr == NULL)
+		return FAILED_TO_DISASSEMBLE_OPERAND;
+	text_str(t, ", ");
+	text_str(t, shiftStr);
+	if (operand->shiftValueUsed != 0) {
+		text_str(t, " #");
+		text_hex(t, operand->shiftValue, true);
+	}
+	return DISASM_SUCCESS;
+}
+
 static inline uint32_t get_shifted_register(
 	const InstructionOperand *operand,
 	uint32_t registerNumber,
 	char *outBuffer,
 	uint32_t outBufferSize)
 {
-	char immBuff[32] = {0};
-	char shiftBuff[64] = {0};
-
-	char reg[16];
-	if(get_register_full(operand->reg[registerNumber], operand, reg))
+	struct text t;
+	text_init(&t, outBuffer, outBufferSize);
+	if(text_register_full(&t, operand->reg[registerNumber], operand))
 		return FAILED_TO_DISASSEMBLE_REGISTER;
 
-	if (operand->shiftType != ShiftType_NONE)
-	{
-		if (operand->shiftValueUsed != 0)
-		{
-			if (snprintf(immBuff, sizeof(immBuff), " #%#x", operand->shiftValue) >= sizeof(immBuff))
-			{
-				return FAILED_TO_DISASSEMBLE_REGISTER;
-			}
-		}
-		const char *shiftStr = get_shift(operand->shiftType);
-		if (shiftStr == NULL)
-			return FAILED_TO_DISASSEMBLE_OPERAND;
-		snprintf(
-				shiftBuff,
-				sizeof(shiftBuff),
-				", %s%s",
-				shiftStr,
-				immBuff);
-	}
-	if (snprintf(outBuffer, outBufferSize, "%s%s", reg, shiftBuff) < 0)
-		return FAILED_TO_DISASSEMBLE_REGISTER;
-	return DISASM_SUCCESS;
+	uint32_t rc = text_shift(&t, operand);
+	if (rc != DISASM_SUCCESS)
+		return rc;
+	return t.overflow ? FAILED_TO_DISASSEMBLE_REGISTER : DISASM_SUCCESS;
 }
 
 uint32_t get_memory_operand(
@@ -176,104 +263,80 @@ uint32_t get_memory_operand(
 	char *outBuffer,
 	uint32_t outBufferSize)
 {
-	char immBuff[64]= {0};
-	char extendBuff[48] = {0};
-	char paramBuff[32] = {0};
+	struct text t;
+	text_init(&t, outBuffer, outBufferSize);
 
-	char reg0[16]={'\0'}, reg1[16]={'\0'};
-	if(get_register_full(operand->reg[0], operand, reg0))
+	text_char(&t, '[');
+	if(text_register_full(&t, operand->reg[0], operand))
 		return FAILED_TO_DISASSEMBLE_REGISTER;
 
-	const char *sign = "";
+	bool negative = false;
 	int64_t imm = operand->immediate;
 	if (operand->signedImm && (int64_t)imm < 0)
 	{
-		sign = "-";
+		negative = true;
 		imm = -imm;
 	}
 
 	switch (operand->operandClass)
 	{
 		case MEM_REG:
-			if (snprintf(outBuffer, outBufferSize, "[%s]", reg0) >= outBufferSize)
-				return FAILED_TO_DISASSEMBLE_OPERAND;
+			text_char(&t, ']');
 			break;
 
 		case MEM_PRE_IDX:
-			if (snprintf(outBuffer, outBufferSize, "[%s, #%s%#" PRIx64 "]!", reg0, sign, (uint64_t)imm) >= outBufferSize)
-				return FAILED_TO_DISASSEMBLE_OPERAND;
+			text_str(&t, negative ? ", #-" : ", #");
+			text_hex(&t, (uint64_t)imm, true);
+			text_str(&t, "]!");
 			break;
 
 		case MEM_POST_IDX: // [<reg>], <reg|imm>
+			text_str(&t, "], ");
 			if (operand->reg[1] != REG_NONE) {
-				if(get_register_full((Register)operand->reg[1], operand, reg1))
+				if(text_register_full(&t, operand->reg[1], operand))
 					return FAILED_TO_DISASSEMBLE_REGISTER;
-
-				snprintf(paramBuff, sizeof(paramBuff), ", %s", reg1);
 			}
-			else if (snprintf(paramBuff, sizeof(paramBuff), ", #%s%#" PRIx64, sign, (uint64_t)imm) >= sizeof(paramBuff))
-				return FAILED_TO_DISASSEMBLE_OPERAND;
-
-			if (snprintf(outBuffer, outBufferSize, "[%s]%s", reg0, paramBuff) >= outBufferSize)
-				return FAILED_TO_DISASSEMBLE_OPERAND;
-
+			else {
+				text_str(&t, negative ? "#-" : "#");
+				text_hex(&t, (uint64_t)imm, true);
+			}
 			break;
 
 		case MEM_OFFSET: // [<reg> optional(imm)]
 			if (operand->immediate != 0) {
-				const char *mul_vl = operand->mul_vl ? ", mul vl" : "";
-				if(snprintf(immBuff, sizeof(immBuff), ", #%s%#" PRIx64 "%s", sign, (uint64_t)imm, mul_vl) >= sizeof(immBuff)) {
-					return FAILED_TO_DISASSEMBLE_OPERAND;
-				}
+				text_str(&t, negative ? ", #-" : ", #");
+				text_hex(&t, (uint64_t)imm, true);
+				if (operand->mul_vl)
+					text_str(&t, ", mul vl");
 			}
-
-			if (snprintf(outBuffer, outBufferSize, "[%s%s]", reg0, immBuff) >= outBufferSize)
-				return FAILED_TO_DISASSEMBLE_OPERAND;
+			text_char(&t, ']');
 			break;
 
-		case MEM_EXTENDED:
-			if(get_register_full(operand->reg[1], operand, reg1))
+		case MEM_EXTENDED: // like "[x24, x30, lsl #0x0]"
+			text_str(&t, ", ");
+			if(text_register_full(&t, operand->reg[1], operand))
 				return FAILED_TO_DISASSEMBLE_REGISTER;
-
-			if (reg0[0] == '\0' || reg1[0] == '\0') {
+			if (text_shift(&t, operand) != DISASM_SUCCESS)
 				return FAILED_TO_DISASSEMBLE_OPERAND;
-			}
-
-			// immBuff, like "#0x0"
-			if (operand->shiftValueUsed)
-				if(snprintf(immBuff, sizeof(immBuff), " #%#x", operand->shiftValue) >= sizeof(immBuff))
-					return FAILED_TO_DISASSEMBLE_OPERAND;
-
-			// extendBuff, like "lsl #0x0"
-			if (operand->shiftType != ShiftType_NONE)
-			{
-				if (snprintf(extendBuff, sizeof(extendBuff), ", %s%s",
-							get_shift(operand->shiftType), immBuff) >= sizeof(extendBuff))
-				{
-					return FAILED_TO_DISASSEMBLE_OPERAND;
-				}
-			}
-
-			// together, like "[x24, x30, lsl #0x0]"
-			if (snprintf(outBuffer, outBufferSize, "[%s, %s%s]", reg0, reg1, extendBuff) >= outBufferSize)
-				return FAILED_TO_DISASSEMBLE_OPERAND;
-
+			text_char(&t, ']');
 			break;
+
 		default:
 			return NOT_MEMORY_OPERAND;
 	}
-	return DISASM_SUCCESS;
+	return t.overflow ? FAILED_TO_DISASSEMBLE_OPERAND : DISASM_SUCCESS;
 }
 
 uint32_t get_register(const InstructionOperand *operand, uint32_t registerNumber, char *outBuffer, uint32_t outBufferSize)
 {
+	struct text t;
+	text_init(&t, outBuffer, outBufferSize);
+
 	/* 1) handle system registers */
 	if(operand->operandClass == SYS_REG)
 	{
-		if (snprintf(outBuffer, outBufferSize, "%s",
-			get_system_register_name(operand->sysreg)) >= outBufferSize)
-			return FAILED_TO_DISASSEMBLE_REGISTER;
-		return 0;
+		text_str(&t, get_system_register_name(operand->sysreg));
+		return t.overflow ? FAILED_TO_DISASSEMBLE_REGISTER : 0;
 	}
 
 	if(operand->operandClass != REG && operand->operandClass != MULTI_REG)
@@ -285,189 +348,160 @@ uint32_t get_register(const InstructionOperand *operand, uint32_t registerNumber
 		return get_shifted_register(operand, registerNumber, outBuffer, outBufferSize);
 	}
 
-	char reg_buf[16];
-	if(get_register_full(operand->reg[registerNumber], operand, reg_buf))
+	if(text_register_full(&t, operand->reg[registerNumber], operand))
 		return FAILED_TO_DISASSEMBLE_REGISTER;
 
 	/* 3) handle predicate registers */
 	if(operand->operandClass == REG && operand->pred_qual && operand->reg[0] >= REG_P0 && operand->reg[0] <= REG_P31)
 	{
-		if(snprintf(outBuffer, outBufferSize, "%s/%c", reg_buf, operand->pred_qual) >= outBufferSize)
-			return FAILED_TO_DISASSEMBLE_REGISTER;
-		return 0;
+		text_char(&t, '/');
+		text_char(&t, operand->pred_qual);
 	}
-
 	/* 4) handle other registers */
-	char index[32] = {0};
-	if(operand->operandClass == REG && operand->laneUsed)
-		snprintf(index, sizeof(index), "[%u]", operand->lane);
-
-	if(snprintf(outBuffer, outBufferSize, "%s%s", reg_buf, index) >= outBufferSize)
-		return FAILED_TO_DISASSEMBLE_REGISTER;
+	else if(operand->operandClass == REG && operand->laneUsed)
+	{
+		text_char(&t, '[');
+		text_unsigned(&t, operand->lane);
+		text_char(&t, ']');
+	}
 
-	return 0;
+	return t.overflow ? FAILED_TO_DISASSEMBLE_REGISTER : 0;
 }
 
 uint32_t get_multireg_operand(const InstructionOperand *operand, char *result, uint32_t result_sz)
 {
-	char lane_str[32] = {0};
-	char reg_str[4][32];
+	struct text t;
 	uint32_t elem_n;
-	int rc;
-	memset(&reg_str, 0, sizeof(reg_str));
 
+	if (operand->reg[0] == REG_NONE)
+		return FAILED_TO_DISASSEMBLE_OPERAND;
+
+	text_init(&t, result, result_sz);
+	text_char(&t, '{');
 	for (elem_n = 0; elem_n < 4 && operand->reg[elem_n] != REG_NONE; elem_n++)
-		if (get_register(operand, elem_n, reg_str[elem_n], 32) != 0)
+	{
+		char reg_str[32];
+		if (get_register(operand, elem_n, reg_str, sizeof(reg_str)) != 0)
 			return FAILED_TO_DISASSEMBLE_OPERAND;
+		if (elem_n)
+			text_str(&t, ", ");
+		text_str(&t, reg_str);
+	}
+	text_char(&t, '}');
 
 	if(operand->laneUsed)
-		snprintf(lane_str, sizeof(lane_str), "[%d]", operand->lane);
-
-	switch (elem_n)
 	{
-		case 1:
-			rc = snprintf(result, result_sz, "{%s}%s",
-				reg_str[0], lane_str);
-			break;
-		case 2:
-			rc = snprintf(result, result_sz, "{%s, %s}%s",
-				reg_str[0], reg_str[1], lane_str);
-			break;
-		case 3:
-			rc = snprintf(result, result_sz, "{%s, %s, %s}%s",
-				reg_str[0], reg_str[1], reg_str[2], lane_str);
-			break;
-		case 4:
-			rc = snprintf(result, result_sz, "{%s, %s, %s, %s}%s",
-				reg_str[0], reg_str[1], reg_str[2], reg_str[3], lane_str);
-			break;
-		default:
-			return FAILED_TO_DISASSEMBLE_OPERAND;
+		text_char(&t, '[');
+		text_unsigned(&t, operand->lane);
+		text_char(&t, ']');
 	}
 
-	return rc < 0 ? FAILED_TO_DISASSEMBLE_OPERAND : DISASM_SUCCESS;
+	return t.overflow ? FAILED_TO_DISASSEMBLE_OPERAND : DISASM_SUCCESS;
 }
 
 uint32_t get_shifted_immediate(const InstructionOperand *instructionOperand, char *outBuffer, uint32_t outBufferSize, uint32_t type)
 {
-	char shiftBuff[48] = {0};
-	char immBuff[32] = {0};
-	const char *sign = "";
+	struct text t;
+	bool negative = false;
 	if (instructionOperand == NULL)
 		return FAILED_TO_DISASSEMBLE_OPERAND;
 
 	uint64_t imm = instructionOperand->immediate;
 	if (instructionOperand->signedImm == 1 && ((int64_t)imm) < 0)
 	{
-		sign = "-";
+		negative = true;
 		imm = -(int64_t)imm;
 	}
-	if (instructionOperand->shiftType != ShiftType_NONE)
-	{
-		if (instructionOperand->shiftValueUsed != 0)
-		{
-			if (snprintf(immBuff, sizeof(immBuff), " #%#x", instructionOperand->shiftValue) >= sizeof(immBuff))
-			{
-				return FAILED_TO_DISASSEMBLE_REGISTER;
-			}
-		}
-		const char *shiftStr = get_shift(instructionOperand->shiftType);
-		if (shiftStr == NULL)
-			return FAILED_TO_DISASSEMBLE_OPERAND;
-		snprintf(
-				shiftBuff,
-				sizeof(shiftBuff),
-				", %s%s",
-				shiftStr,
-				immBuff);
-	}
+
+	text_init(&t, outBuffer, outBufferSize);
 	if (type == FIMM32)
 	{
+		/* the one remaining printf, there is no cheap exact float formatting */
+		char floatBuff[64];
 		float f = *(const float*)&instructionOperand->immediate;
-		if (snprintf(outBuffer, outBufferSize, "#%.08f%s", f, shiftBuff) >= outBufferSize)
-			return FAILED_TO_DISASSEMBLE_OPERAND;
-	}
-	else if (type == IMM32)
-	{
-		if (snprintf(outBuffer, outBufferSize, "#%s%#x%s", sign, (uint32_t)imm, shiftBuff) >= outBufferSize)
-			return FAILED_TO_DISASSEMBLE_OPERAND;
+		snprintf(floatBuff, sizeof(floatBuff), "#%.08f", f);
+		text_str(&t, floatBuff);
 	}
 	else if (type == LABEL)
 	{
-		if (snprintf(outBuffer, outBufferSize, "0x%" PRIx64, (uint64_t)imm) >= outBufferSize)
-			return FAILED_TO_DISASSEMBLE_OPERAND;
+		text_hex(&t, imm, false);
+		return t.overflow ? FAILED_TO_DISASSEMBLE_OPERAND : DISASM_SUCCESS;
 	}
 	else if (type == STR_IMM)
 	{
-		if (snprintf(outBuffer, outBufferSize, "%s #0x%" PRIx64, instructionOperand->name, (uint64_t)imm) >= outBufferSize)
-			return FAILED_TO_DISASSEMBLE_OPERAND;
+		text_str(&t, instructionOperand->name);
+		text_str(&t, " #");
+		text_hex(&t, imm, false);
+		return t.overflow ? FAILED_TO_DISASSEMBLE_OPERAND : DISASM_SUCCESS;
 	}
 	else
 	{
-		if (snprintf(outBuffer, outBufferSize, "#%s%#" PRIx64 "%s",
-					sign,
-					imm,
-					shiftBuff) >= outBufferSize)
-			return FAILED_TO_DISASSEMBLE_OPERAND;
+		text_str(&t, negative ? "#-" : "#");
+		text_hex(&t, type == IMM32 ? (uint32_t)imm : imm, true);
 	}
-	return DISASM_SUCCESS;
+
+	if (text_shift(&t, instructionOperand) != DISASM_SUCCESS)
+		return FAILED_TO_DISASSEMBLE_OPERAND;
+	return t.overflow ? FAILED_TO_DISASSEMBLE_OPERAND : DISASM_SUCCESS;
 }
 
 uint32_t get_sme_tile(const InstructionOperand *operand, char *outBuffer, uint32_t outBufferSize)
 {
-	char base_offset[32] = {'\0'};
-	if(operand->reg[0] != REG_NONE) {
-		if(operand->arrSpec == ARRSPEC_FULL)
-			snprintf(base_offset, sizeof(base_offset), "[%s]", get_register_name(operand->reg[0]));
-		else
-			snprintf(base_offset, sizeof(base_offset), "[%s, #%llu]", get_register_name(operand->reg[0]), operand->immediate);
-	}
+	struct text t;
+	text_init(&t, outBuffer, outBufferSize);
 
-	char *slice = "";
+	text_char(&t, 'Z');
+	text_unsigned(&t, operand->tile);
 	if(operand->slice == SLICE_HORIZONTAL)
-		slice = "H";
+		text_char(&t, 'H');
 	else if(operand->slice == SLICE_VERTICAL)
-		slice = "V";
-
-	if(snprintf(outBuffer, outBufferSize, "Z%d%s%s%s",
-	  operand->tile,
-	  slice,
-	  get_arrspec_str_truncated(operand->arrSpec),
-	  base_offset
-	 ) >= outBufferSize)
-		return FAILED_TO_DISASSEMBLE_OPERAND;
+		text_char(&t, 'V');
+	text_str(&t, get_arrspec_str_truncated(operand->arrSpec));
 
-	return DISASM_SUCCESS;
+	if(operand->reg[0] != REG_NONE) {
+		text_char(&t, '[');
+		text_str(&t, get_register_name(operand->reg[0]));
+		if(operand->arrSpec != ARRSPEC_FULL) {
+			text_str(&t, ", #");
+			text_unsigned(&t, operand->immediate);
+		}
+		text_char(&t, ']');
+	}
+
+	return t.overflow ? FAILED_TO_DISASSEMBLE_OPERAND : DISASM_SUCCESS;
 }
 
 uint32_t get_indexed_element(const InstructionOperand *operand, char *outBuffer, uint32_t outBufferSize)
 {
-	// make the "{, #<imm>}"
-	char optional_comma_and[32];
-	if(operand->immediate)
-		if(snprintf(optional_comma_and, 32, ", #%llu", operand->immediate) >= 32)
-			return FAILED_TO_DISASSEMBLE_OPERAND;
-	
+	struct text t;
+	text_init(&t, outBuffer, outBufferSize);
+
 	// <Pn>.<T>[<Wm>{, #<imm>}]
-	if(snprintf(outBuffer, outBufferSize, "%s%s[%s%s]",
-		get_register_name(operand->reg[0]),
-		get_arrspec_str_truncated(operand->arrSpec),
-		get_register_name(operand->reg[1]),
-		optional_comma_and
-	  ) >= outBufferSize)
-	  	return FAILED_TO_DISASSEMBLE_OPERAND;
+	text_str(&t, get_register_name(operand->reg[0]));
+	text_str(&t, get_arrspec_str_truncated(operand->arrSpec));
+	text_char(&t, '[');
+	text_str(&t, get_register_name(operand->reg[1]));
+	if(operand->immediate) {
+		text_str(&t, ", #");
+		text_unsigned(&t, operand->immediate);
+	}
+	text_char(&t, ']');
 
-	return DISASM_SUCCESS;
+	return t.overflow ? FAILED_TO_DISASSEMBLE_OPERAND : DISASM_SUCCESS;
 }
 
 uint32_t get_accum_array(const InstructionOperand *operand, char *outBuffer, uint32_t outBufferSize)
 {
-	if(snprintf(outBuffer, outBufferSize, "ZA[%s, #%llu]",
-	  get_register_name(operand->reg[0]), operand->immediate
-	  ) >= outBufferSize)
-		return FAILED_TO_DISASSEMBLE_OPERAND;
+	struct text t;
+	text_init(&t, outBuffer, outBufferSize);
 
-	return DISASM_SUCCESS;
+	text_str(&t, "ZA[");
+	text_str(&t, get_register_name(operand->reg[0]));
+	text_str(&t, ", #");
+	text_unsigned(&t, operand->immediate);
+	text_char(&t, ']');
+
+	return t.overflow ? FAILED_TO_DISASSEMBLE_OPERAND : DISASM_SUCCESS;
 }
 
 //-----------------------------------------------------------------------------
@@ -476,29 +510,28 @@ uint32_t get_accum_array(const InstructionOperand *operand, char *outBuffer, uin
 
 int aarch64_disassemble(Instruction *instruction, char *buf, size_t buf_sz)
 {
-	char operandStrings[MAX_OPERANDS][130];
 	char tmpOperandString[128];
 	const char *operand = tmpOperandString;
+	struct text t;
 	if (instruction == NULL || buf_sz == 0 || buf == NULL)
 		return INVALID_ARGUMENTS;
 
-	memset(operandStrings, 0, sizeof(operandStrings));
 	const char *operation = get_operation(instruction);
 	if (operation == NULL)
 		return FAILED_TO_DISASSEMBLE_OPERATION;
 
-	for(int i=0; i<MAX_OPERANDS; i++)
-		memset(&(operandStrings[i][0]), 0, 128);
+	memset(buf, 0, buf_sz);
+	text_init(&t, buf, buf_sz);
+	text_str(&t, operation);
 
 	for(int i=0; i<MAX_OPERANDS && instruction->operands[i].operandClass != NONE; i++)
 	{
 		switch (instruction->operands[i].operandClass)
 		{
 			case CONDITION:
-				if (snprintf(tmpOperandString, sizeof(tmpOperandString), "%s",
-							get_condition((Condition)instruction->operands[i].cond)) >= sizeof(tmpOperandString))
+				operand = get_condition((Condition)instruction->operands[i].cond);
+				if (operand == NULL)
 					return FAILED_TO_DISASSEMBLE_OPERAND;
-				operand = tmpOperandString;
 				break;
 			case FIMM32:
 			case IMM32:
@@ -580,23 +613,17 @@ int aarch64_disassemble(Instruction *instruction, char *buf, size_t buf_sz)
 					sizeof(tmpOperandString)) != DISASM_SUCCESS)
 					return FAILED_TO_DISASSEMBLE_OPERAND;
 				operand = tmpOperandString;
-				break;				
+				break;
 			case NAME:
 				operand = instruction->operands[i].name;
 				break;
 			case NONE:
 				break;
 		}
-		snprintf(operandStrings[i], sizeof(operandStrings[i]), i==0?"\t%s":", %s", operand);
+		text_str(&t, i==0 ? "\t" : ", ");
+		text_str(&t, operand);
 	}
-	memset(buf, 0, buf_sz);
-	if (snprintf(buf, buf_sz, "%s%s%s%s%s%s",
-				get_operation(instruction),
-				operandStrings[0],
-				operandStrings[1],
-				operandStrings[2],
-				operandStrings[3],
-				operandStrings[4]) >= buf_sz)
+	if (t.overflow)
 		return OUTPUT_BUFFER_TOO_SMALL;
 	return DISASM_SUCCESS;
 }
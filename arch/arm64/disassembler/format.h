@@ -34,6 +34,11 @@ extern "C" {
 // get a text representation of the decomposed instruction
 int aarch64_disassemble(Instruction *instruction, char *buf, size_t buf_sz);
 
+// printf-free number formatting, out must hold 19 (hex) or 21 (unsigned) characters
+// alternate: like "%#" PRIx64 (zero without 0x prefix), otherwise like "0x%" PRIx64
+size_t format_hex(char *out, uint64_t value, bool alternate);
+size_t format_unsigned(char *out, uint64_t value);
+
 // register (and related) to string
 int get_register_full(enum Register, const InstructionOperand *, char *result);
 const char *get_register_arrspec(enum Register, const InstructionOperand *);
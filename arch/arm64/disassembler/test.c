@@ -252,6 +252,223 @@ int disassemble(uint64_t address, uint32_t insword, char* result)
 	return 0;
 }
 
+/* branch classification from a full decode, as Arm64Architecture::SetInstructionInfoForInstruction does it */
+void classify_decoded(Instruction* instr, InstructionClass* result)
+{
+	result->length = 4;
+	result->branch = BRANCH_NONE;
+	result->target = 0;
+
+	switch (instr->operation)
+	{
+	case ARM64_BL:
+		result->branch = BRANCH_CALL;
+		result->target = instr->operands[0].immediate;
+		break;
+	case ARM64_B:
+		result->branch = instr->operands[0].operandClass == LABEL ? BRANCH_UNCONDITIONAL : BRANCH_INDIRECT;
+		result->target = instr->operands[0].immediate;
+		break;
+	case ARM64_B_EQ:
+	case ARM64_B_NE:
+	case ARM64_B_CS:
+	case ARM64_B_CC:
+	case ARM64_B_MI:
+	case ARM64_B_PL:
+	case ARM64_B_VS:
+	case ARM64_B_VC:
+	case ARM64_B_HI:
+	case ARM64_B_LS:
+	case ARM64_B_GE:
+	case ARM64_B_LT:
+	case ARM64_B_GT:
+	case ARM64_B_LE:
+	case ARM64_B_AL:
+	case ARM64_B_NV:
+		result->branch = BRANCH_CONDITIONAL;
+		result->target = instr->operands[0].immediate;
+		break;
+	case ARM64_TBZ:
+	case ARM64_TBNZ:
+		result->branch = BRANCH_CONDITIONAL;
+		result->target = instr->operands[2].immediate;
+		break;
+	case ARM64_CBZ:
+	case ARM64_CBNZ:
+		result->branch = BRANCH_CONDITIONAL;
+		result->target = instr->operands[1].immediate;
+		break;
+	case ARM64_BR:
+	case ARM64_BRAA:
+	case ARM64_BRAAZ:
+	case ARM64_BRAB:
+	case ARM64_BRABZ:
+	case ARM64_DRPS:
+		result->branch = BRANCH_INDIRECT;
+		break;
+	case ARM64_ERET:
+	case ARM64_ERETAA:
+	case ARM64_ERETAB:
+	case ARM64_RET:
+	case ARM64_RETAA:
+	case ARM64_RETAB:
+		result->branch = BRANCH_RETURN;
+		break;
+	case ARM64_SVC:
+	case ARM64_HVC:
+	case ARM64_SMC:
+		result->branch = BRANCH_SYSCALL;
+		break;
+	case ARM64_UDF:
+		result->branch = BRANCH_EXCEPTION;
+		break;
+	default:
+		break;
+	}
+}
+
+/* compare aarch64_classify() against aarch64_decompose(), returns 0 if they agree */
+int classify_check(uint64_t address, uint32_t insword)
+{
+	Instruction instr;
+	InstructionClass expected, actual;
+	memset(&instr, 0, sizeof(instr));
+
+	int rc_full = aarch64_decompose(insword, &instr, address);
+	int rc_fast = aarch64_classify(insword, &actual, address);
+	if (rc_full != rc_fast)
+	{
+		printf("%08X: aarch64_decompose() returned %d, aarch64_classify() returned %d\n", insword, rc_full,
+		    rc_fast);
+		return -1;
+	}
+	if (rc_full)
+		return 0;
+
+	classify_decoded(&instr, &expected);
+	if (expected.length != actual.length || expected.branch != actual.branch ||
+	    ((expected.branch == BRANCH_CALL || expected.branch == BRANCH_UNCONDITIONAL ||
+	         expected.branch == BRANCH_CONDITIONAL) &&
+	        expected.target != actual.target))
+	{
+		printf("%08X: expected branch %d to %llX, aarch64_classify() gave branch %d to %llX\n", insword,
+		    expected.branch, expected.target, actual.branch, actual.target);
+		return -1;
+	}
+	return 0;
+}
+
+/* instruction words from the disassembly test cases, a corpus of valid encodings */
+uint32_t* load_test_cases(const char* path, int* count)
+{
+	char line[1024];
+	int capacity = 65536;
+	uint32_t* result = malloc(capacity * sizeof(uint32_t));
+	*count = 0;
+
+	FILE* fp = fopen(path, "r");
+	if (!fp)
+	{
+		printf("ERROR: opening %s\n", path);
+		free(result);
+		return NULL;
+	}
+	while (fgets(line, sizeof(line), fp))
+	{
+		char* end;
+		if (line[0] == '/')
+			continue;
+		uint32_t insword = strtoul(line, &end, 16);
+		if (end == line)
+			continue;
+		if (*count == capacity)
+		{
+			capacity *= 2;
+			result = realloc(result, capacity * sizeof(uint32_t));
+		}
+		result[(*count)++] = insword;
+	}
+	fclose(fp);
+	return result;
+}
+
+/* compare the printf-free number formatting against snprintf(), returns 0 if they agree */
+int format_check(uint64_t value)
+{
+	char expected[32], actual[32];
+	int failures = 0;
+
+	snprintf(expected, sizeof(expected), "%#llx", value);
+	format_hex(actual, value, true);
+	failures += strcmp(expected, actual) != 0;
+
+	snprintf(expected, sizeof(expected), "0x%llx", value);
+	format_hex(actual, value, false);
+	failures += strcmp(expected, actual) != 0;
+
+	snprintf(expected, sizeof(expected), "%llu", value);
+	format_unsigned(actual, value);
+	failures += strcmp(expected, actual) != 0;
+
+	if (failures)
+		printf("%llX: formatted as \"%s\", expected \"%s\"\n", value, actual, expected);
+	return failures;
+}
+
+/* disassembly at this address is what format_cases.txt expects */
+#define FORMAT_CASES_ADDRESS 0x100000
+/* "format-cases" also writes every word at this stride that disassembles */
+#define FORMAT_CASES_STRIDE 262139
+
+/* disassemble at FORMAT_CASES_ADDRESS, returns 0 on success */
+int format_instruction(uint32_t insword, char* result, size_t result_sz)
+{
+	Instruction instr;
+	memset(&instr, 0, sizeof(instr));
+	int rc = aarch64_decompose(insword, &instr, FORMAT_CASES_ADDRESS);
+	if (rc)
+		return rc;
+	return aarch64_disassemble(&instr, result, result_sz);
+}
+
+/* compare the full aarch64_disassemble() text against each "<insword> <text>" line of a file,
+   returns the number of mismatches or -1 if the file can't be read */
+int format_cases_check(const char* path, int* checked)
+{
+	char line[1024], actual[1024];
+	int failures = 0;
+	*checked = 0;
+
+	FILE* fp = fopen(path, "r");
+	if (!fp)
+	{
+		printf("ERROR: opening %s\n", path);
+		return -1;
+	}
+	while (fgets(line, sizeof(line), fp))
+	{
+		char* end;
+		if (line[0] == '/')
+			continue;
+		uint32_t insword = strtoul(line, &end, 16);
+		if (end == line || *end != ' ')
+			continue;
+		char* expected = end + 1;
+		expected[strcspn(expected, "\r\n")] = '\0';
+
+		(*checked)++;
+		int rc = format_instruction(insword, actual, sizeof(actual));
+		if (rc || strcmp(expected, actual))
+		{
+			printf("%08X: formatted as \"%s\" (%d), expected \"%s\"\n", insword, rc ? "" : actual, rc,
+			    expected);
+			failures++;
+		}
+	}
+	fclose(fp);
+	return failures;
+}
+
 double subtract_timespecs(struct timespec t1, struct timespec t0)
 {
 	double delta = 0;
@@ -308,6 +525,131 @@ int main(int ac, char** av)
 		return 0;
 	}
 
+	/* differential test of the classification fast path: test cases, then a uniform sample of all
+	   2^32 instruction words (every one of them with "classify-test all") */
+	if (!strcmp(av[1], "classify-test"))
+	{
+		int count, failures = 0;
+		uint64_t checked = 0;
+		uint32_t* words = load_test_cases("test_cases.txt", &count);
+		if (!words)
+			return -1;
+
+		verbose = 0;
+		for (int i = 0; i < count; i++, checked++)
+			failures += classify_check(0x100000, words[i]) != 0;
+		free(words);
+
+		uint64_t stride = ac > 2 && !strcmp(av[2], "all") ? 1 : 251;
+		for (uint64_t insword = rand() % stride; insword <= 0xFFFFFFFF; insword += stride, checked++)
+		{
+			/* vary the address, including near the ends of the address space */
+			uint64_t address = ((uint64_t)rand() << 34) ^ ((uint64_t)rand() << 2);
+			failures += classify_check(address, (uint32_t)insword) != 0;
+		}
+
+		printf("%llu instructions checked, %d mismatches\n", checked, failures);
+		return failures ? -1 : 0;
+	}
+
+	/* printf-free number formatting vs. snprintf(), at every power of two boundary and random values */
+	if (!strcmp(av[1], "format-test"))
+	{
+		int failures = 0;
+		for (int bit = 0; bit < 64; bit++)
+		{
+			uint64_t value = (uint64_t)1 << bit;
+			failures += format_check(value) + format_check(value - 1) + format_check(value + 1);
+			failures += format_check(~value);
+		}
+		failures += format_check(0xFFFFFFFFFFFFFFFFULL);
+		for (int i = 0; i < 10000000; i++)
+		{
+			uint64_t value = ((uint64_t)rand() << 62) ^ ((uint64_t)rand() << 31) ^ rand();
+			failures += format_check(value >> (rand() % 64));
+		}
+
+		printf("%d mismatches\n", failures);
+		return failures ? -1 : 0;
+	}
+
+	/* full disassembly text vs. the expected strings in format_cases.txt, which cover the words of
+	   test_cases.txt and a sample of all instruction words (see "format-cases") */
+	if (!strcmp(av[1], "disasm-test"))
+	{
+		int checked;
+		int failures = format_cases_check(ac > 2 ? av[2] : "format_cases.txt", &checked);
+		if (failures < 0)
+			return -1;
+
+		printf("%d instructions checked, %d mismatches\n", checked, failures);
+		return failures ? -1 : 0;
+	}
+
+	/* write the expected strings for "disasm-test"; only regenerate format_cases.txt when a change to
+	   the disassembly text is intended */
+	if (!strcmp(av[1], "format-cases"))
+	{
+		int count;
+		uint32_t* words = load_test_cases("test_cases.txt", &count);
+		if (!words)
+			return -1;
+
+		printf("// aarch64_disassemble() text at address %#x, checked by \"./test disasm-test\"\n",
+		    FORMAT_CASES_ADDRESS);
+		printf("// words from test_cases.txt, then every word at a stride of %d that disassembles\n",
+		    FORMAT_CASES_STRIDE);
+		for (int i = 0; i < count; i++)
+		{
+			if (format_instruction(words[i], instxt, sizeof(instxt)) == 0)
+				printf("%08X %s\n", words[i], instxt);
+		}
+		free(words);
+
+		for (uint64_t word = 0; word <= 0xFFFFFFFF; word += FORMAT_CASES_STRIDE)
+		{
+			if (format_instruction((uint32_t)word, instxt, sizeof(instxt)) == 0)
+				printf("%08X %s\n", (uint32_t)word, instxt);
+		}
+		return 0;
+	}
+
+	/* throughput of aarch64_classify() vs. aarch64_decompose() over the valid test case encodings */
+	if (!strcmp(av[1], "classify-speed"))
+	{
+		int count;
+		uint32_t* words = load_test_cases(ac > 2 ? av[2] : "test_cases.txt", &count);
+		if (!words || !count)
+			return -1;
+
+		InstructionClass cls;
+		int64_t iterations = 10000000, branches_full = 0, branches_fast = 0;
+
+		clock_gettime(CLOCK_MONOTONIC, &t0);
+		for (int64_t i = 0; i < iterations; i++)
+		{
+			memset(&instr, 0, sizeof(instr));
+			if (aarch64_decompose(words[i % count], &instr, 0) == 0)
+				branches_full += instr.operation == ARM64_B;
+		}
+		clock_gettime(CLOCK_MONOTONIC, &t1);
+		delta = subtract_timespecs(t1, t0);
+		printf("aarch64_decompose(): %.0f instructions/s (%lld b)\n", iterations / delta, branches_full);
+
+		clock_gettime(CLOCK_MONOTONIC, &t0);
+		for (int64_t i = 0; i < iterations; i++)
+		{
+			if (aarch64_classify(words[i % count], &cls, 0) == 0)
+				branches_fast += cls.branch == BRANCH_UNCONDITIONAL;
+		}
+		clock_gettime(CLOCK_MONOTONIC, &t1);
+		delta = subtract_timespecs(t1, t0);
+		printf(" aarch64_classify(): %.0f instructions/s (%lld b)\n", iterations / delta, branches_fast);
+
+		free(words);
+		return 0;
+	}
+
 	// There's no disassemble speed test yet because randomly generated instruction words often do
 	// not decode.
 
@@ -0,0 +1,105 @@
+#!/usr/bin/env python3
+# read neon_intrin_types.txt and generate the NEON intrinsic input/output type tables
+#
+# each line of neon_intrin_types.txt is:
+#
+#   <intrinsic> <input types> -> <output types>
+#
+# where a type is i<bytes> for an unsigned integer or f<bytes> for a float, eg:
+#
+#   ARM64_INTRIN_VADDQ_S8 i16 i16 -> i16
+#
+# intrinsics are grouped by signature; each distinct signature is built once, the first time an
+# intrinsic that uses it is queried (see NeonCachedInputTypes() in neon_intrinsics.cpp)
+#
+# outputs, in the parent directory:
+#   neon_intrinsic_input_type.include          cases for NeonGetIntrinsicInputs()
+#   neon_intrinsic_output_type.include         cases for NeonGetIntrinsicOutputs()
+#   neon_intrinsic_cached_input_types.include  builders for each distinct input signature
+#   neon_intrinsic_cached_output_types.include builders for each distinct output signature
+
+import os
+import re
+import sys
+
+from collections import OrderedDict
+
+HEADER = '// Generated file, please do not edit directly\n\n'
+
+def binja_type(t):
+	m = re.match(r'^([if])(\d+)$', t)
+	if not m:
+		print('cannot convert type %s into binja type' % t)
+		sys.exit(-1)
+	if m.group(1) == 'i':
+		return 'Type::IntegerType(%s, false)' % m.group(2)
+	return 'Type::FloatType(%s)' % m.group(2)
+
+class TypeCacher():
+	def __init__(self, name, element, enclose):
+		self.name = name
+		self.element = element
+		self.enclose = enclose
+		# signature -> list of intrinsics using it, in order of first appearance
+		self.signatures = OrderedDict()
+
+	def add(self, intrinsic, types):
+		# intrinsics without types fall through to the default case
+		if not types:
+			return
+		self.signatures.setdefault(tuple(types), []).append(intrinsic)
+
+	def vector_str(self, types):
+		elements = [(self.enclose % binja_type(t)) if self.enclose else binja_type(t) for t in types]
+		return 'vector<%s> { %s }' % (self.element, ', '.join(elements))
+
+	def dump_cases(self, path):
+		func = 'NeonCached%sTypes' % self.name.capitalize()
+		with open(path, 'w') as fp:
+			fp.write(HEADER)
+			for (idx, intrinsics) in enumerate(self.signatures.values()):
+				for intrinsic in intrinsics:
+					fp.write('case %s:\n' % intrinsic)
+				fp.write('\treturn %s(%d);\n' % (func, idx))
+
+	def dump_builders(self, path):
+		name = self.name.capitalize()
+		with open(path, 'w') as fp:
+			fp.write(HEADER)
+			fp.write('static constexpr size_t g_neonCached%sTypeCount = %d;\n\n' % (name, len(self.signatures)))
+			fp.write('static vector<%s> NeonBuild%sTypes(size_t index)\n' % (self.element, name))
+			fp.write('{\n')
+			fp.write('\tswitch (index)\n')
+			fp.write('\t{\n')
+			for (idx, types) in enumerate(self.signatures):
+				fp.write('\tcase %d:\n' % idx)
+				fp.write('\t\treturn %s;\n' % self.vector_str(types))
+			fp.write('\tdefault:\n')
+			fp.write('\t\treturn vector<%s>();\n' % self.element)
+			fp.write('\t}\n')
+			fp.write('}\n')
+
+if __name__ == '__main__':
+	here = os.path.dirname(os.path.abspath(__file__))
+	out_dir = os.path.join(here, '..')
+
+	inputs = TypeCacher('input', 'NameAndType', 'NameAndType(%s)')
+	outputs = TypeCacher('output', 'Confidence<Ref<Type>>', None)
+
+	with open(os.path.join(here, 'neon_intrin_types.txt')) as fp:
+		for line in fp:
+			line = line.strip()
+			if not line or line.startswith('#'):
+				continue
+			m = re.match(r'^(ARM64_INTRIN_\w+)(.*)->(.*)$', line)
+			if not m:
+				print('cannot parse line -%s-' % line)
+				sys.exit(-1)
+			(intrinsic, in_types, out_types) = m.group(1, 2, 3)
+			inputs.add(intrinsic, in_types.split())
+			outputs.add(intrinsic, out_types.split())
+
+	inputs.dump_cases(os.path.join(out_dir, 'neon_intrinsic_input_type.include'))
+	outputs.dump_cases(os.path.join(out_dir, 'neon_intrinsic_output_type.include'))
+	inputs.dump_builders(os.path.join(out_dir, 'neon_intrinsic_cached_input_types.include'))
+	outputs.dump_builders(os.path.join(out_dir, 'neon_intrinsic_cached_output_types.include'))
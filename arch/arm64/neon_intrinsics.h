@@ -3930,7 +3930,7 @@ enum NeonIntrinsic : uint32_t
 };
 
 string NeonGetIntrinsicName(uint32_t intrinsic);
-vector<NameAndType> NeonGetIntrinsicInputs(uint32_t intrinsic);
-vector<Confidence<Ref<Type>>> NeonGetIntrinsicOutputs(uint32_t intrinsic);
+const vector<NameAndType>& NeonGetIntrinsicInputs(uint32_t intrinsic);
+const vector<Confidence<Ref<Type>>>& NeonGetIntrinsicOutputs(uint32_t intrinsic);
 bool NeonGetLowLevelILForInstruction(
     Architecture* arch, uint64_t addr, LowLevelILFunction& il, Instruction& instr, size_t addrSize);
@@ -0,0 +1,58 @@
+// Microbenchmark of aarch64 intrinsic signature lookups (GetIntrinsicInputs/GetIntrinsicOutputs).
+//
+// The first pass over all intrinsics builds the cached NEON signatures, later passes only look
+// them up. Both go through the core, the same way analysis queries intrinsic types.
+//
+//   arm64_intrinsic_bench [passes]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include "binaryninjaapi.h"
+
+using namespace std;
+using namespace BinaryNinja;
+
+
+static double LookupAll(Architecture* arch, const vector<uint32_t>& intrinsics, size_t& typeCount)
+{
+	auto start = chrono::steady_clock::now();
+	for (uint32_t intrinsic : intrinsics)
+	{
+		typeCount += arch->GetIntrinsicInputs(intrinsic).size();
+		typeCount += arch->GetIntrinsicOutputs(intrinsic).size();
+	}
+	return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+
+int main(int argc, char* argv[])
+{
+	const size_t passes = (argc >= 2) ? strtoull(argv[1], nullptr, 0) : 100;
+
+	SetBundledPluginDirectory(GetBundledPluginDirectory());
+	InitPlugins();
+
+	Ref<Architecture> arch = Architecture::GetByName("aarch64");
+	if (!arch)
+	{
+		fprintf(stderr, "aarch64 architecture is not available\n");
+		return 1;
+	}
+
+	const vector<uint32_t> intrinsics = arch->GetAllIntrinsics();
+	size_t typeCount = 0;
+	const double cold = LookupAll(arch, intrinsics, typeCount);
+
+	double warm = 0;
+	for (size_t i = 0; i < passes; i++)
+		warm += LookupAll(arch, intrinsics, typeCount);
+
+	printf("%zu intrinsics, %zu types returned\n", intrinsics.size(), typeCount);
+	printf("first pass: %.1f ns/intrinsic\n", cold * 1e9 / intrinsics.size());
+	if (passes)
+		printf("later passes: %.1f ns/intrinsic (%zu passes)\n", warm * 1e9 / (intrinsics.size() * passes), passes);
+
+	BNShutdown();
+	return 0;
+}
@@ -3,8 +3,12 @@
 #include <stdio.h>
 #include <string.h>
 #include <sstream>
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include "binaryninjaapi.h"
 #include "il.h"
+#include "fastdecode.h"
 extern "C" {
     #include "xed-interface.h"
 }
@@ -430,6 +434,139 @@ bool X86CommonArchitecture::Decode(const uint8_t* data, size_t len, xed_decoded_
 	}
 }
 
+// Each instruction is typically decoded by GetInstructionInfo, GetInstructionText and
+// GetInstructionLowLevelIL in turn, usually on the same analysis thread. Keep a small,
+// direct mapped cache of decoded instructions per thread so that XED only has to decode
+// each instruction once. Entries are validated against the full instruction bytes, so
+// patched or relocated code never returns a stale decode.
+static constexpr size_t DECODE_CACHE_BITS = 10;
+static constexpr size_t DECODE_CACHE_SIZE = 1 << DECODE_CACHE_BITS;
+static constexpr uint64_t DECODE_CACHE_STATS_FLUSH_INTERVAL = 0x10000;
+
+struct DecodeCacheEntry
+{
+	uint64_t addr;
+	size_t bits; // Zero for empty entries
+	size_t length;
+	uint8_t bytes[XED_MAX_INSTRUCTION_BYTES];
+	xed_decoded_inst_t xedd;
+};
+
+struct DecodeCache
+{
+	DecodeCacheEntry entries[DECODE_CACHE_SIZE];
+	uint64_t hits = 0;
+	uint64_t misses = 0;
+};
+
+static std::atomic<uint64_t> g_decodeCacheHits {0};
+static std::atomic<uint64_t> g_decodeCacheMisses {0};
+
+
+static void FlushDecodeCacheStatistics(DecodeCache& cache)
+{
+	g_decodeCacheHits.fetch_add(cache.hits, std::memory_order_relaxed);
+	g_decodeCacheMisses.fetch_add(cache.misses, std::memory_order_relaxed);
+	cache.hits = 0;
+	cache.misses = 0;
+}
+
+
+static DecodeCache& GetThreadDecodeCache()
+{
+	// The cache itself lives on the heap to keep the thread local storage footprint small
+	struct DecodeCacheHolder
+	{
+		unique_ptr<DecodeCache> cache;
+		~DecodeCacheHolder()
+		{
+			if (cache)
+				FlushDecodeCacheStatistics(*cache);
+		}
+	};
+	thread_local DecodeCacheHolder holder;
+	if (!holder.cache)
+		holder.cache = make_unique<DecodeCache>(); // Value initialized, so all entries start out empty
+	return *holder.cache;
+}
+
+
+bool X86CommonArchitecture::DecodeCached(const uint8_t* data, uint64_t addr, size_t len, xed_decoded_inst_t* xedd)
+{
+	DecodeCache& cache = GetThreadDecodeCache();
+	DecodeCacheEntry& entry = cache.entries[(addr * 0x9e3779b97f4a7c15ULL) >> (64 - DECODE_CACHE_BITS)];
+
+	if ((cache.hits + cache.misses) >= DECODE_CACHE_STATS_FLUSH_INTERVAL)
+		FlushDecodeCacheStatistics(cache);
+
+	if ((entry.bits == m_bits) && (entry.addr == addr) && (entry.length <= len)
+		&& (memcmp(entry.bytes, data, entry.length) == 0))
+	{
+		cache.hits++;
+		*xedd = entry.xedd;
+		// The decoded instruction refers back to the buffer it was decoded from, which is owned by the caller
+		xedd->_byte_array._dec = data;
+		return true;
+	}
+
+	cache.misses++;
+	if (!Decode(data, len, xedd))
+		return false;
+
+	entry.addr = addr;
+	entry.bits = m_bits;
+	entry.length = xed_decoded_inst_get_length(xedd);
+	memcpy(entry.bytes, data, entry.length);
+	entry.xedd = *xedd;
+	return true;
+}
+
+
+void X86CommonArchitecture::GetDecodeCacheStatistics(uint64_t& hits, uint64_t& misses)
+{
+	FlushDecodeCacheStatistics(GetThreadDecodeCache());
+	hits = g_decodeCacheHits.load(std::memory_order_relaxed);
+	misses = g_decodeCacheMisses.load(std::memory_order_relaxed);
+}
+
+
+const string& X86CommonArchitecture::GetXedRegisterString(xed_reg_enum_t reg, bool att) const
+{
+	// Register names are rendered for nearly every operand, so build every spelling of them once up front
+	// and hand out the interned copies
+	struct RegisterStrings
+	{
+		const string* names[2][2][XED_REG_LAST]; // [att][lowerCase][reg]
+
+		RegisterStrings()
+		{
+			for (size_t i = 0; i < XED_REG_LAST; i++)
+			{
+				string name;
+				if ((i >= XED_REG_X87_FIRST) && (i <= XED_REG_X87_LAST))
+					name = "ST" + to_string(i - XED_REG_X87_FIRST);
+				else
+					name = xed_reg_enum_t2str((xed_reg_enum_t)i);
+
+				string lower = name;
+				for (char& c : lower)
+					c = tolower(c);
+
+				names[0][0][i] = &StringInternTable::InternString(name);
+				names[0][1][i] = &StringInternTable::InternString(lower);
+				names[1][0][i] = &StringInternTable::InternString("%" + name);
+				names[1][1][i] = &StringInternTable::InternString("%" + lower);
+			}
+		}
+	};
+	static const RegisterStrings strings;
+
+	if (reg >= XED_REG_LAST)
+		reg = XED_REG_INVALID;
+	return *strings.names[att ? 1 : 0][m_disassembly_options.lowerCase ? 1 : 0][reg];
+}
+
+
 size_t X86CommonArchitecture::GetAddressSizeBits()  const
 {
 	return GetAddressSize() * 8;
@@ -604,149 +741,194 @@ void X86CommonArchitecture::GetAddressSizeToken(const short bytes, vector<Instru
 	}
 }
 
-unsigned short X86CommonArchitecture::GetInstructionOpcode(const xed_decoded_inst_t* const xedd, const xed_operand_values_t* const ov, vector<InstructionTextToken>& result) const
+// To match asmx86 disassembly, returns nullptr if the Intel mnemonic is used as is
+static const char* GetBNIntelMnemonic(xed_iclass_enum_t iclass)
+{
+	switch (iclass)
+	{
+	case XED_ICLASS_RET_NEAR:
+		return "RETN";
+	case XED_ICLASS_JZ:
+		return "JE";
+	case XED_ICLASS_JNZ:
+		return "JNE";
+	case XED_ICLASS_JNB:
+		return "JAE";
+	case XED_ICLASS_JNBE:
+		return "JA";
+	case XED_ICLASS_JP:
+		return "JPE";
+	case XED_ICLASS_JNP:
+		return "JPO";
+	case XED_ICLASS_JNL:
+		return "JGE";
+	case XED_ICLASS_JNLE:
+		return "JG";
+
+	case XED_ICLASS_SETNB:
+		return "SETAE";
+	case XED_ICLASS_SETZ:
+		return "SETE";
+	case XED_ICLASS_SETNZ:
+		return "SETNE";
+	case XED_ICLASS_SETNBE:
+		return "SETA";
+	case XED_ICLASS_SETP:
+		return "SETPE";
+	case XED_ICLASS_SETNP:
+		return "SETPO";
+	case XED_ICLASS_SETNL:
+		return "SETGE";
+	case XED_ICLASS_SETNLE:
+		return "SETG";
+
+	case XED_ICLASS_CMOVNB:
+		return "CMOVAE";
+	case XED_ICLASS_CMOVZ:
+		return "CMOVE";
+	case XED_ICLASS_CMOVNZ:
+		return "CMOVNE";
+	case XED_ICLASS_CMOVNBE:
+		return "CMOVA";
+	case XED_ICLASS_CMOVP:
+		return "CMOVPE";
+	case XED_ICLASS_CMOVNP:
+		return "CMOVPO";
+	case XED_ICLASS_CMOVNL:
+		return "CMOVGE";
+	case XED_ICLASS_CMOVNLE:
+		return "CMOVG";
+
+	default:
+		return nullptr;
+	}
+}
+
+
+static string GetIformMnemonic(xed_iform_enum_t iform, DISASSEMBLY_FLAVOR_ENUM df)
+{
+	switch (df)
+	{
+	case DF_INTEL:
+		return xed_iform_to_iclass_string_intel(iform);
+	case DF_BN_INTEL:
+		if (const char* mnemonic = GetBNIntelMnemonic(xed_iform_to_iclass(iform)))
+			return mnemonic;
+		return xed_iform_to_iclass_string_intel(iform);
+	case DF_ATT:
+		return xed_iform_to_iclass_string_att(iform);
+	case DF_XED:
+		return xed_iclass_enum_t2str(xed_iform_to_iclass(iform));
+	default:
+		LogError("Invalid Disassembly Flavor");
+		return "";
+	}
+}
+
+
+// Bits of GetInstructionOpcode's prefix mask, in the order the prefixes are printed
+enum MnemonicPrefix
 {
-	string opcode = "";
+	MnemonicPrefixBnd = 1,
+	MnemonicPrefixXacquire = 2,
+	MnemonicPrefixXrelease = 4,
+	MnemonicPrefixLock = 8,
+	MnemonicPrefixRep = 0x10,
+	MnemonicPrefixRepne = 0x20,
+	MnemonicPrefixHintNotTaken = 0x40,
+	MnemonicPrefixHintTaken = 0x80
+};
+
+
+static uint32_t GetMnemonicPrefixes(const xed_decoded_inst_t* const xedd, const xed_operand_values_t* const ov)
+{
+	uint32_t prefixes = 0;
 	if (xed_decoded_inst_has_mpx_prefix(xedd))
-		opcode += "BND ";
+		prefixes |= MnemonicPrefixBnd;
 	if (xed_decoded_inst_is_xacquire(xedd))
-		opcode += "XACQUIRE ";
+		prefixes |= MnemonicPrefixXacquire;
 	if (xed_decoded_inst_is_xrelease(xedd))
-		opcode += "XRELEASE ";
+		prefixes |= MnemonicPrefixXrelease;
 	if (xed_operand_values_has_lock_prefix(ov))
-		opcode += "LOCK ";
+		prefixes |= MnemonicPrefixLock;
 	if (xed_operand_values_has_real_rep(ov))
 	{
 		if (xed_operand_values_has_rep_prefix(ov))
-			opcode += "REP ";
+			prefixes |= MnemonicPrefixRep;
 		if (xed_operand_values_has_repne_prefix(ov))
-			opcode += "REPNE ";
+			prefixes |= MnemonicPrefixRepne;
 	}
 	else if (xed_operand_values_branch_not_taken_hint(ov))
-		opcode += "HINT-NOT-TAKEN ";
+		prefixes |= MnemonicPrefixHintNotTaken;
 	else if (xed_operand_values_branch_taken_hint(ov))
-		opcode += "HINT-TAKEN ";
+		prefixes |= MnemonicPrefixHintTaken;
+	return prefixes;
+}
 
-	switch (m_disassembly_options.df)
-	{
-	case DF_INTEL:
-		opcode += string(xed_iform_to_iclass_string_intel(xed_decoded_inst_get_iform_enum(xedd)));
-		break;
-	case DF_BN_INTEL:
-		// To match asmx86 disassembly
-		switch (xed_decoded_inst_get_iclass(xedd))
-		{
-		case XED_ICLASS_RET_NEAR:
-			opcode += "RETN";
-			break;
-		case XED_ICLASS_JZ:
-			opcode += "JE";
-			break;
-		case XED_ICLASS_JNZ:
-			opcode += "JNE";
-			break;
-		case XED_ICLASS_JNB:
-			opcode += "JAE";
-			break;
-		case XED_ICLASS_JNBE:
-			opcode += "JA";
-			break;
-		case XED_ICLASS_JP:
-			opcode += "JPE";
-			break;
-		case XED_ICLASS_JNP:
-			opcode += "JPO";
-			break;
-		case XED_ICLASS_JNL:
-			opcode += "JGE";
-			break;
-		case XED_ICLASS_JNLE:
-			opcode += "JG";
-			break;
 
-		case XED_ICLASS_SETNB:
-			opcode += "SETAE";
-			break;
-		case XED_ICLASS_SETZ:
-			opcode += "SETE";
-			break;
-		case XED_ICLASS_SETNZ:
-			opcode += "SETNE";
-			break;
-		case XED_ICLASS_SETNBE:
-			opcode += "SETA";
-			break;
-		case XED_ICLASS_SETP:
-			opcode += "SETPE";
-			break;
-		case XED_ICLASS_SETNP:
-			opcode += "SETPO";
-			break;
-		case XED_ICLASS_SETNL:
-			opcode += "SETGE";
-			break;
-		case XED_ICLASS_SETNLE:
-			opcode += "SETG";
-			break;
+static string ConvertCase(string str, bool lowerCase)
+{
+	if (lowerCase)
+		for (char& c : str)
+			c = tolower(c);
+	else
+		for (char& c : str)
+			c = toupper(c);
+	return str;
+}
 
-		case XED_ICLASS_CMOVNB:
-			opcode += "CMOVAE";
-			break;
-		case XED_ICLASS_CMOVZ:
-			opcode += "CMOVE";
-			break;
-		case XED_ICLASS_CMOVNZ:
-			opcode += "CMOVNE";
-			break;
-		case XED_ICLASS_CMOVNBE:
-			opcode += "CMOVA";
-			break;
-		case XED_ICLASS_CMOVP:
-			opcode += "CMOVPE";
-			break;
-		case XED_ICLASS_CMOVNP:
-			opcode += "CMOVPO";
-			break;
-		case XED_ICLASS_CMOVNL:
-			opcode += "CMOVGE";
-			break;
-		case XED_ICLASS_CMOVNLE:
-			opcode += "CMOVG";
-			break;
 
-		default:
-			opcode += string(xed_iform_to_iclass_string_intel(xed_decoded_inst_get_iform_enum(xedd)));
+const string& X86CommonArchitecture::GetMnemonicString(xed_iform_enum_t iform, uint32_t prefixes) const
+{
+	// The mnemonic is rendered for every instruction. Each flavor and case gets a table of the
+	// interned mnemonic of every iform, built the first time that combination is used.
+	struct MnemonicStrings
+	{
+		const string* names[XED_IFORM_LAST];
+
+		MnemonicStrings(DISASSEMBLY_FLAVOR_ENUM df, bool lowerCase)
+		{
+			for (size_t i = 0; i < XED_IFORM_LAST; i++)
+				names[i] = &StringInternTable::InternString(ConvertCase(GetIformMnemonic((xed_iform_enum_t)i, df), lowerCase));
 		}
-		break;
-	case DF_ATT:
-		opcode += string(xed_iform_to_iclass_string_att(xed_decoded_inst_get_iform_enum(xedd)));
-		break;
-	case DF_XED:
-		opcode += string(xed_iclass_enum_t2str(xed_decoded_inst_get_iclass(xedd)));
-		break;
-	default:
-		LogError("Invalid Disassembly Flavor");
-	}
+	};
+	static const size_t flavorCount = DF_XED + 1;
+	static once_flag built[flavorCount][2];
+	static const MnemonicStrings* strings[flavorCount][2];
+
+	const DISASSEMBLY_FLAVOR_ENUM df = m_disassembly_options.df;
+	const bool lowerCase = m_disassembly_options.lowerCase;
+	if (iform >= XED_IFORM_LAST)
+		iform = XED_IFORM_INVALID;
+	if (((size_t)df >= flavorCount) || prefixes)
+	{
+		// Prefixed instructions are rare, so their mnemonics are only interned once seen
+		static const char* const prefixNames[] = {
+			"BND ", "XACQUIRE ", "XRELEASE ", "LOCK ", "REP ", "REPNE ", "HINT-NOT-TAKEN ", "HINT-TAKEN "};
+		string mnemonic;
+		for (size_t i = 0; i < sizeof(prefixNames) / sizeof(prefixNames[0]); i++)
+			if (prefixes & (1 << i))
+				mnemonic += prefixNames[i];
+		mnemonic += GetIformMnemonic(iform, df);
+		return StringInternTable::InternString(ConvertCase(mnemonic, lowerCase));
+	}
+
+	call_once(built[df][lowerCase ? 1 : 0], [&]() { strings[df][lowerCase ? 1 : 0] = new MnemonicStrings(df, lowerCase); });
+	return *strings[df][lowerCase ? 1 : 0]->names[iform];
+}
 
-	if (m_disassembly_options.lowerCase)
-		for (char& c : opcode)
-			c = tolower(c);
-	else
-		for (char& c : opcode)
-			c = toupper(c);
 
+unsigned short X86CommonArchitecture::GetInstructionOpcode(const xed_decoded_inst_t* const xedd, const xed_operand_values_t* const ov, vector<InstructionTextToken>& result) const
+{
+	const string& opcode = GetMnemonicString(xed_decoded_inst_get_iform_enum(xedd), GetMnemonicPrefixes(xedd, ov));
 	result.emplace_back(InstructionToken, opcode);
-
 	return (unsigned short)opcode.length();
 }
 
 void X86CommonArchitecture::GetInstructionPadding(const unsigned int instruction_name_length, vector<InstructionTextToken>& result) const
 {
-	string padding = "";
 	const short min = 7 < instruction_name_length ? 7 : instruction_name_length;
-	for (unsigned short delim = 0; delim < (8 - min); ++delim)
-		padding += ' ';
-	result.emplace_back(TextToken, padding);
+	result.emplace_back(TextToken, string(8 - min, ' '));
 }
 
 // (in theory) Exactly how XED wants the world to see x86
@@ -785,22 +967,8 @@ void X86CommonArchitecture::GetOperandTextIntel(const xed_decoded_inst_t* const
 		case XED_OPERAND_REG7:
 		case XED_OPERAND_REG8:
 		{
-			string reg = "";
-
 			const xed_reg_enum_t xedReg = xed_decoded_inst_get_reg(xedd, op_name);
-			if ((xedReg >= XED_REG_X87_FIRST) && (xedReg <=  XED_REG_X87_LAST))
-			{
-				reg += "ST";
-				reg += ('0' + (xedReg-XED_REG_X87_FIRST));
-			}
-			else
-			{
-				reg += xed_reg_enum_t2str(xedReg);
-			}
-			if (m_disassembly_options.lowerCase)
-				for (char& c : reg)
-					c = tolower(c);
-			result.emplace_back(RegisterToken, reg);
+			result.emplace_back(RegisterToken, GetXedRegisterString(xedReg));
 			break;
 		}
 		case XED_OPERAND_AGEN:
@@ -819,11 +987,7 @@ void X86CommonArchitecture::GetOperandTextIntel(const xed_decoded_inst_t* const
 			const bool validSegment = (seg != XED_REG_INVALID && !xed_operand_values_using_default_segment(ov, 0));
 			if (validSegment)
 			{
-				string seg_str(xed_reg_enum_t2str(seg));
-				if (m_disassembly_options.lowerCase)
-					for (char& c : seg_str)
-						c = tolower(c);
-				result.emplace_back(RegisterToken, seg_str);
+				result.emplace_back(RegisterToken, GetXedRegisterString(seg));
 				result.emplace_back(OperationToken, ":");
 			}
 
@@ -834,11 +998,7 @@ void X86CommonArchitecture::GetOperandTextIntel(const xed_decoded_inst_t* const
 
 			if ((base != XED_REG_INVALID) && !((base == XED_REG_RIP) || (base == XED_REG_EIP) || (base == XED_REG_IP)))
 			{
-				string base_str(xed_reg_enum_t2str(base));
-				if (m_disassembly_options.lowerCase)
-					for (char& c : base_str)
-						c = tolower(c);
-				result.emplace_back(RegisterToken, base_str);
+				result.emplace_back(RegisterToken, GetXedRegisterString(base));
 				started = true;
 			}
 			else if ((base == XED_REG_RIP) || (base == XED_REG_EIP) || (base == XED_REG_IP))
@@ -876,12 +1036,7 @@ void X86CommonArchitecture::GetOperandTextIntel(const xed_decoded_inst_t* const
 						result.emplace_back(OperationToken, "+");
 					started = true;
 
-					string index_str(xed_reg_enum_t2str(index));
-					if (m_disassembly_options.lowerCase)
-						for (char& c : index_str)
-							c = tolower(c);
-
-					result.emplace_back(RegisterToken, index_str);
+					result.emplace_back(RegisterToken, GetXedRegisterString(index));
 
 					const unsigned int scale = xed_decoded_inst_get_scale(xedd, 0);
 					if (scale != 1)
@@ -959,11 +1114,7 @@ void X86CommonArchitecture::GetOperandTextIntel(const xed_decoded_inst_t* const
 			const xed_reg_enum_t seg = xed_decoded_inst_get_seg_reg(xedd, 1);
 			if (seg != XED_REG_INVALID && !xed_operand_values_using_default_segment(ov, 1))
 			{
-				string seg_str(xed_reg_enum_t2str(seg));
-				if (m_disassembly_options.lowerCase)
-					for (char& c : seg_str)
-						c = tolower(c);
-				result.emplace_back(RegisterToken, seg_str);
+				result.emplace_back(RegisterToken, GetXedRegisterString(seg));
 
 				result.emplace_back(OperationToken, ":");
 			}
@@ -972,11 +1123,7 @@ void X86CommonArchitecture::GetOperandTextIntel(const xed_decoded_inst_t* const
 			const xed_reg_enum_t base = xed_decoded_inst_get_base_reg(xedd, 1);
 			if (base != XED_REG_INVALID)
 			{
-				string base_str(xed_reg_enum_t2str(base));
-				if (m_disassembly_options.lowerCase)
-					for (char& c : base_str)
-						c = tolower(c);
-				result.emplace_back(RegisterToken, base_str);
+				result.emplace_back(RegisterToken, GetXedRegisterString(base));
 			}
 			result.emplace_back(EndMemoryOperandToken, "");
 			result.emplace_back(BraceToken, "]");
@@ -1093,11 +1240,7 @@ void X86CommonArchitecture::GetOperandTextIntel(const xed_decoded_inst_t* const
 	if (extra_index_operand != XED_REG_INVALID)
 	{
 		result.emplace_back(OperandSeparatorToken, m_disassembly_options.separator);
-		string reg = xed_reg_enum_t2str(extra_index_operand);
-		if (m_disassembly_options.lowerCase)
-			for (char& c : reg)
-				c = tolower(c);
-		result.emplace_back(RegisterToken, reg);
+		result.emplace_back(RegisterToken, GetXedRegisterString(extra_index_operand));
 	}
 }
 
@@ -1137,33 +1280,24 @@ void X86CommonArchitecture::GetOperandTextBNIntel(const xed_decoded_inst_t* cons
 		case XED_OPERAND_REG7:
 		case XED_OPERAND_REG8:
 		{
-			string reg = "";
-
 			const xed_reg_enum_t xedReg = xed_decoded_inst_get_reg(xedd, op_name);
-			if ((xedReg >= XED_REG_X87_FIRST) && (xedReg <=  XED_REG_X87_LAST))
-			{
-				reg += "ST";
-				reg += ('0' + (xedReg - XED_REG_X87_FIRST));
-			}
 			// As of July 2020, the XED now outputs these registers as mm0, etc.
 			// However, to maintain backward-compatibility, we need to make them mmx0, etc,
 			// as they previously are
-			else if ((xedReg >= XED_REG_MMX0) && (xedReg <=  XED_REG_MMX1))
+			if ((xedReg >= XED_REG_MMX0) && (xedReg <=  XED_REG_MMX1))
 			{
-				reg += "MMX";
+				string reg = "MMX";
 				reg += ('0' + (xedReg - XED_REG_MMX0));
+				if (m_disassembly_options.lowerCase)
+					for (char& c : reg)
+						c = tolower(c);
+				result.emplace_back(RegisterToken, reg);
 			}
 			else
 			{
-				reg += xed_reg_enum_t2str(xedReg);
+				result.emplace_back(RegisterToken, GetXedRegisterString(xedReg));
 			}
 
-			if (m_disassembly_options.lowerCase)
-				for (char& c : reg)
-					c = tolower(c);
-
-			result.emplace_back(RegisterToken, reg);
-
 			// handle the {z} modifier
 			if (XED_REG_K1 <= xedReg && xedReg <= XED_REG_K7)
 			{
@@ -1191,11 +1325,7 @@ void X86CommonArchitecture::GetOperandTextBNIntel(const xed_decoded_inst_t* cons
 			const bool validSegment = (seg != XED_REG_INVALID && !xed_operand_values_using_default_segment(ov, 0));
 			if (validSegment)
 			{
-				string seg_str(xed_reg_enum_t2str(seg));
-				if (m_disassembly_options.lowerCase)
-					for (char& c : seg_str)
-						c = tolower(c);
-				result.emplace_back(RegisterToken, seg_str);
+				result.emplace_back(RegisterToken, GetXedRegisterString(seg));
 				result.emplace_back(OperationToken, ":");
 			}
 
@@ -1206,11 +1336,7 @@ void X86CommonArchitecture::GetOperandTextBNIntel(const xed_decoded_inst_t* cons
 
 			if ((base != XED_REG_INVALID) && !((base == XED_REG_RIP) || (base == XED_REG_EIP) || (base == XED_REG_IP)))
 			{
-				string base_str(xed_reg_enum_t2str(base));
-				if (m_disassembly_options.lowerCase)
-					for (char& c : base_str)
-						c = tolower(c);
-				result.emplace_back(RegisterToken, base_str);
+				result.emplace_back(RegisterToken, GetXedRegisterString(base));
 				started = true;
 			}
 			else if ((base == XED_REG_RIP) || (base == XED_REG_EIP) || (base == XED_REG_IP))
@@ -1253,12 +1379,7 @@ void X86CommonArchitecture::GetOperandTextBNIntel(const xed_decoded_inst_t* cons
 						result.emplace_back(OperationToken, "+");
 					started = true;
 
-					string index_str(xed_reg_enum_t2str(index));
-					if (m_disassembly_options.lowerCase)
-						for (char& c : index_str)
-							c = tolower(c);
-
-					result.emplace_back(RegisterToken, index_str);
+					result.emplace_back(RegisterToken, GetXedRegisterString(index));
 
 					const unsigned int scale = xed_decoded_inst_get_scale(xedd, 0);
 					if (scale != 1)
@@ -1332,11 +1453,7 @@ void X86CommonArchitecture::GetOperandTextBNIntel(const xed_decoded_inst_t* cons
 			const xed_reg_enum_t seg = xed_decoded_inst_get_seg_reg(xedd, 1);
 			if (seg != XED_REG_INVALID && !xed_operand_values_using_default_segment(ov, 1))
 			{
-				string seg_str(xed_reg_enum_t2str(seg));
-				if (m_disassembly_options.lowerCase)
-					for (char& c : seg_str)
-						c = tolower(c);
-				result.emplace_back(RegisterToken, seg_str);
+				result.emplace_back(RegisterToken, GetXedRegisterString(seg));
 
 				result.emplace_back(OperationToken, ":");
 			}
@@ -1345,11 +1462,7 @@ void X86CommonArchitecture::GetOperandTextBNIntel(const xed_decoded_inst_t* cons
 			const xed_reg_enum_t base = xed_decoded_inst_get_base_reg(xedd, 1);
 			if (base != XED_REG_INVALID)
 			{
-				string base_str(xed_reg_enum_t2str(base));
-				if (m_disassembly_options.lowerCase)
-					for (char& c : base_str)
-						c = tolower(c);
-				result.emplace_back(RegisterToken, base_str);
+				result.emplace_back(RegisterToken, GetXedRegisterString(base));
 			}
 			result.emplace_back(EndMemoryOperandToken, "");
 			result.emplace_back(BraceToken, "]");
@@ -1476,11 +1589,7 @@ void X86CommonArchitecture::GetOperandTextBNIntel(const xed_decoded_inst_t* cons
 	if (extra_index_operand != XED_REG_INVALID)
 	{
 		result.emplace_back(OperandSeparatorToken, m_disassembly_options.separator);
-		string reg = xed_reg_enum_t2str(extra_index_operand);
-		if (m_disassembly_options.lowerCase)
-			for (char& c : reg)
-				c = tolower(c);
-		result.emplace_back(RegisterToken, reg);
+		result.emplace_back(RegisterToken, GetXedRegisterString(extra_index_operand));
 	}
 }
 
@@ -1542,22 +1651,8 @@ void X86CommonArchitecture::GetOperandTextATT(const xed_decoded_inst_t* const xe
 		case XED_OPERAND_REG7:
 		case XED_OPERAND_REG8:
 		{
-			string reg = "%";
-
 			const xed_reg_enum_t xedReg = xed_decoded_inst_get_reg(xedd, op_name);
-			if ((xedReg >= XED_REG_X87_FIRST) && (xedReg <=  XED_REG_X87_LAST))
-			{
-				reg += "ST";
-				reg += ('0' + (xedReg-XED_REG_X87_FIRST));
-			}
-			else
-			{
-				reg += xed_reg_enum_t2str(xedReg);
-			}
-			if (m_disassembly_options.lowerCase)
-				for (char& c : reg)
-					c = tolower(c);
-			result.emplace_back(RegisterToken, reg);
+			result.emplace_back(RegisterToken, GetXedRegisterString(xedReg, true));
 			break;
 		}
 		case XED_OPERAND_AGEN:
@@ -1576,12 +1671,7 @@ void X86CommonArchitecture::GetOperandTextATT(const xed_decoded_inst_t* const xe
 			const bool validSegment = (seg != XED_REG_INVALID && !xed_operand_values_using_default_segment(ov, 0));
 			if (validSegment)
 			{
-				string seg_str(xed_reg_enum_t2str(seg));
-				seg_str = "%" + seg_str;
-				if (m_disassembly_options.lowerCase)
-					for (char& c : seg_str)
-						c = tolower(c);
-				result.emplace_back(RegisterToken, seg_str);
+				result.emplace_back(RegisterToken, GetXedRegisterString(seg, true));
 				result.emplace_back(OperationToken, ":");
 			}
 
@@ -1592,12 +1682,7 @@ void X86CommonArchitecture::GetOperandTextATT(const xed_decoded_inst_t* const xe
 
 			if ((base != XED_REG_INVALID) && !((base == XED_REG_RIP) || (base == XED_REG_EIP) || (base == XED_REG_IP)))
 			{
-				string base_str(xed_reg_enum_t2str(base));
-				base_str = "%" + base_str;
-				if (m_disassembly_options.lowerCase)
-					for (char& c : base_str)
-						c = tolower(c);
-				result.emplace_back(RegisterToken, base_str);
+				result.emplace_back(RegisterToken, GetXedRegisterString(base, true));
 				started = true;
 			}
 			else if ((base == XED_REG_RIP) || (base == XED_REG_EIP) || (base == XED_REG_IP))
@@ -1627,13 +1712,7 @@ void X86CommonArchitecture::GetOperandTextATT(const xed_decoded_inst_t* const xe
 					result.emplace_back(OperationToken, "+");
 				started = true;
 
-				string index_str(xed_reg_enum_t2str(index));
-				index_str = "%" + index_str;
-				if (m_disassembly_options.lowerCase)
-					for (char& c : index_str)
-						c = tolower(c);
-
-				result.emplace_back(RegisterToken, index_str);
+				result.emplace_back(RegisterToken, GetXedRegisterString(index, true));
 
 				const unsigned int scale = xed_decoded_inst_get_scale(xedd, 0);
 				if (scale != 1)
@@ -1711,12 +1790,7 @@ void X86CommonArchitecture::GetOperandTextATT(const xed_decoded_inst_t* const xe
 			const xed_reg_enum_t seg = xed_decoded_inst_get_seg_reg(xedd, 1);
 			if (seg != XED_REG_INVALID && !xed_operand_values_using_default_segment(ov, 1))
 			{
-				string seg_str(xed_reg_enum_t2str(seg));
-				seg_str = "%" + seg_str;
-				if (m_disassembly_options.lowerCase)
-					for (char& c : seg_str)
-						c = tolower(c);
-				result.emplace_back(RegisterToken, seg_str);
+				result.emplace_back(RegisterToken, GetXedRegisterString(seg, true));
 
 				result.emplace_back(OperationToken, ":");
 			}
@@ -1725,12 +1799,7 @@ void X86CommonArchitecture::GetOperandTextATT(const xed_decoded_inst_t* const xe
 			const xed_reg_enum_t base = xed_decoded_inst_get_base_reg(xedd, 1);
 			if (base != XED_REG_INVALID)
 			{
-				string base_str(xed_reg_enum_t2str(base));
-				base_str = "%" + base_str;
-				if (m_disassembly_options.lowerCase)
-					for (char& c : base_str)
-						c = tolower(c);
-				result.emplace_back(RegisterToken, base_str);
+				result.emplace_back(RegisterToken, GetXedRegisterString(base, true));
 			}
 			result.emplace_back(EndMemoryOperandToken, "");
 			result.emplace_back(BraceToken, "]");
@@ -2002,8 +2071,54 @@ vector<uint32_t> X86CommonArchitecture::GetSystemRegisters()
 	};
 }
 
+bool X86CommonArchitecture::GetInstructionInfoFast(const uint8_t* data, uint64_t addr, size_t maxLen, InstructionInfo& result)
+{
+	X86FastDecode::InstructionLengthInfo info;
+	if (!X86FastDecode::DecodeInstructionLength(data, maxLen, m_bits, info))
+		return false;
+
+	// Same classification as SetInstructionInfoForInstruction
+	result.length = info.length;
+	const uint64_t next = addr + info.length;
+	const uint64_t target = next + (uint64_t)info.displacement;
+	switch (info.branch)
+	{
+	case X86FastDecode::RelativeJump:
+		result.AddBranch(UnconditionalBranch, target);
+		break;
+	case X86FastDecode::IndirectJump:
+		result.AddBranch(UnresolvedBranch);
+		break;
+	case X86FastDecode::ConditionalJump:
+		result.AddBranch(TrueBranch, target);
+		result.AddBranch(FalseBranch, next);
+		break;
+	case X86FastDecode::RelativeCall:
+		if (target != next)
+			result.AddBranch(CallDestination, target);
+		break;
+	case X86FastDecode::Return:
+		result.AddBranch(FunctionReturn);
+		break;
+	case X86FastDecode::SystemCallInterrupt:
+		result.AddBranch(SystemCall);
+		break;
+	case X86FastDecode::ExceptionInstruction:
+		result.AddBranch(ExceptionBranch);
+		break;
+	default:
+		break;
+	}
+	return true;
+}
+
+
 bool X86CommonArchitecture::GetInstructionInfo(const uint8_t* data, uint64_t addr, size_t maxLen, InstructionInfo& result)
 {
+	// Most instructions only need their length and branch behavior, which doesn't require XED
+	if (GetInstructionInfoFast(data, addr, maxLen, result))
+		return true;
+
 	xed_decoded_inst_t xedd;
 	switch (m_bits)
 	{
@@ -2020,7 +2135,7 @@ bool X86CommonArchitecture::GetInstructionInfo(const uint8_t* data, uint64_t add
 		LogError("Invalid Processor Mode");
 		return false;
 	}
-	if (!Decode(data, maxLen, &xedd))
+	if (!DecodeCached(data, addr, maxLen, &xedd))
 		return false;
 
 	SetInstructionInfoForInstruction(addr, result, &xedd);
@@ -2047,7 +2162,7 @@ bool X86CommonArchitecture::GetInstructionText(const uint8_t* data, uint64_t add
 		return false;
 	}
 
-	if (Decode(data, len, &xedd))
+	if (DecodeCached(data, addr, len, &xedd))
 	{
 		len = xed_decoded_inst_get_length(&xedd);
 
@@ -2090,7 +2205,7 @@ bool X86CommonArchitecture::GetInstructionLowLevelIL(const uint8_t* data, uint64
 		LogError("Invalid Processor Mode");
 		return false;
 	}
-	if (!Decode(data, len, &xedd))
+	if (!DecodeCached(data, addr, len, &xedd))
 	{
 		il.AddInstruction(il.Undefined());
 		return false;
@@ -2182,6 +2297,9 @@ size_t X86CommonArchitecture::GetSemanticFlagGroupLowLevelIL(uint32_t semGroup,
 
 string X86CommonArchitecture::GetRegisterName(uint32_t reg)
 {
+	if (reg < XED_REG_LAST)
+		return GetXedRegisterString((xed_reg_enum_t)reg, m_disassembly_options.df == DF_ATT);
+
 	string reg_str = "";
 	if (m_disassembly_options.df == DF_ATT)
 		reg_str += "%";
@@ -2190,8 +2308,6 @@ string X86CommonArchitecture::GetRegisterName(uint32_t reg)
 		reg_str += "X87_R" + to_string(reg - REG_X87_r(0));
 	else if (reg == REG_X87_TOP)
 		reg_str += "TOP";
-	else if ((reg >= XED_REG_X87_FIRST) && (reg <= XED_REG_X87_LAST))
-		reg_str += "ST" + to_string(reg - XED_REG_X87_FIRST);
 	else
 		reg_str += xed_reg_enum_t2str((xed_reg_enum_t)reg);
 
@@ -4819,7 +4935,6 @@ extern "C"
 
 		// XED Setup
 		xed_tables_init();
-		X86CommonArchitecture::InitializeCachedTypes();
 
 		// Register the architectures in the global list of available architectures
 		Architecture* x16 = new X16Architecture();
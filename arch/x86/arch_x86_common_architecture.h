@@ -25,14 +25,18 @@ protected:
 	DISASSEMBLY_OPTIONS m_disassembly_options;
 
 	bool Decode(const uint8_t* data, size_t len, xed_decoded_inst_t* xedd);
+	bool DecodeCached(const uint8_t* data, uint64_t addr, size_t len, xed_decoded_inst_t* xedd);
 
 	size_t GetAddressSizeBits()  const;
 	uint64_t GetAddressMask() const;
 
 	void SetInstructionInfoForInstruction(uint64_t addr, InstructionInfo& result, xed_decoded_inst_t* xedd);
+	bool GetInstructionInfoFast(const uint8_t* data, uint64_t addr, size_t maxLen, InstructionInfo& result);
 	bool IsConditionalJump(xed_decoded_inst_t* xedd);
 	string GetSizeString(const size_t size) const;
 
+	const string& GetXedRegisterString(xed_reg_enum_t reg, bool att = false) const;
+	const string& GetMnemonicString(xed_iform_enum_t iform, uint32_t prefixes) const;
 	BNRegisterInfo RegisterInfo(xed_reg_enum_t fullWidthReg, size_t offset, size_t size, bool zeroExtend = false);
 	static void GetAddressSizeToken(const short bytes, vector<InstructionTextToken>& result, const bool lowerCase);
 	unsigned short GetInstructionOpcode(const xed_decoded_inst_t* const xedd,
@@ -101,10 +105,8 @@ public:
 	virtual bool InvertBranch(uint8_t* data, uint64_t, size_t len) override;
 	virtual bool SkipAndReturnValue(uint8_t* data, uint64_t, size_t len, uint64_t value) override;
 
-	static void InitializeCachedTypes();
-	static void InitializeCachedInputTypes();
-	static void InitializeCachedOutputTypes();
+	static void GetDecodeCacheStatistics(uint64_t& hits, uint64_t& misses);
 
-	inline static vector<NameAndType> *cached_input_types;
-	inline static vector<Confidence<Ref<Type>>> *cached_output_types;
+	static const vector<NameAndType>& GetCachedInputTypes(size_t index);
+	static const vector<Confidence<Ref<Type>>>& GetCachedOutputTypes(size_t index);
 };
@@ -2,6 +2,7 @@
 #include <inttypes.h>
 #include <stdio.h>
 #include <string.h>
+#include <mutex>
 #include <sstream>
 #include "binaryninjaapi.h"
 #include "il.h"
@@ -5229,32 +5230,88 @@ vector<Confidence<Ref<Type>>> X86CommonArchitecture::GetIntrinsicOutputs(uint32_
 }
 
 
-#ifdef __clang__
-// clang is very slow at optimizing this function. Optimizations have nearly zero
-// impact on initialization time, so just turn them off.
-void X86CommonArchitecture::InitializeCachedInputTypes() __attribute__((optnone))
-#else
-void X86CommonArchitecture::InitializeCachedInputTypes()
-#endif
+enum X86IntrinsicTypeKind : uint8_t
 {
+    X86IntrinsicUnsignedType,
+    X86IntrinsicSignedType,
+    X86IntrinsicFloatType,
+    X86IntrinsicBoolType
+};
+
+// A single intrinsic input or output type: an element of the given kind and width in bytes, or
+// an array of count such elements if count is nonzero
+struct X86IntrinsicTypeDescriptor
+{
+    X86IntrinsicTypeKind kind;
+    uint16_t width;
+    uint16_t count;
+};
+
+// The types of one cached signature, a range of the descriptor table
+struct X86IntrinsicSignature
+{
+    uint16_t first;
+    uint16_t count;
+};
+
 #include "x86_intrinsic_cached_input_types.include"
+#include "x86_intrinsic_cached_output_types.include"
+
+
+static Ref<Type> GetIntrinsicType(const X86IntrinsicTypeDescriptor& descriptor)
+{
+    Ref<Type> type;
+    switch (descriptor.kind)
+    {
+    case X86IntrinsicUnsignedType:
+        type = Type::IntegerType(descriptor.width, false);
+        break;
+    case X86IntrinsicSignedType:
+        type = Type::IntegerType(descriptor.width, true);
+        break;
+    case X86IntrinsicFloatType:
+        type = Type::FloatType(descriptor.width);
+        break;
+    default:
+        type = Type::BoolType();
+        break;
+    }
+
+    if (descriptor.count)
+        return Type::ArrayType(type, descriptor.count);
+    return type;
 }
 
 
-#ifdef __clang__
-// clang is very slow at optimizing this function. Optimizations have nearly zero
-// impact on initialization time, so just turn them off.
-void X86CommonArchitecture::InitializeCachedOutputTypes() __attribute__((optnone))
-#else
-void X86CommonArchitecture::InitializeCachedOutputTypes()
-#endif
+// Signatures are only turned into Type objects the first time an intrinsic using them is queried,
+// so that loading the plugin doesn't have to create thousands of types up front. Like the types
+// themselves, the caches are never freed.
+template <typename T, size_t Count>
+static const vector<T>& GetCachedTypes(
+    const X86IntrinsicTypeDescriptor* descriptors, const X86IntrinsicSignature (&signatures)[Count], size_t index)
 {
-#include "x86_intrinsic_cached_output_types.include"
+    static once_flag* built = new once_flag[Count];
+    static vector<T>* types = new vector<T>[Count];
+
+    call_once(built[index], [&]() {
+        const X86IntrinsicSignature& signature = signatures[index];
+        vector<T>& result = types[index];
+        result.reserve(signature.count);
+        for (size_t i = 0; i < signature.count; i++)
+            result.emplace_back(GetIntrinsicType(descriptors[signature.first + i]));
+    });
+    return types[index];
+}
+
+
+const vector<NameAndType>& X86CommonArchitecture::GetCachedInputTypes(size_t index)
+{
+    return GetCachedTypes<NameAndType>(x86_intrinsic_input_type_descriptors, x86_intrinsic_input_signatures, index);
 }
 
 
-void X86CommonArchitecture::InitializeCachedTypes()
+const vector<Confidence<Ref<Type>>>& X86CommonArchitecture::GetCachedOutputTypes(size_t index)
 {
-    X86CommonArchitecture::InitializeCachedInputTypes();
-    X86CommonArchitecture::InitializeCachedOutputTypes();
+    return GetCachedTypes<Confidence<Ref<Type>>>(
+        x86_intrinsic_output_type_descriptors, x86_intrinsic_output_signatures, index);
 }
@@ -14,25 +14,36 @@ class TypeCacher():
 
     def __init__(self, name):
         self.cached_types = []
+        self.cached_descriptors = []
         self.name = name
     
-    def get_cached_type_str(self, type_str):
+    def get_cached_type_str(self, type_str, descriptors):
         try:
-            cached_type_str = 'X86CommonArchitecture::cached_%s_types[%d]' % (self.name, self.cached_types.index(type_str))
+            idx = self.cached_types.index(type_str)
         except:
             self.cached_types.append(type_str)
-            cached_type_str = 'X86CommonArchitecture::cached_%s_types[%d]' % (self.name, len(self.cached_types) - 1)
+            self.cached_descriptors.append(descriptors)
+            idx = len(self.cached_types) - 1
 
-        return cached_type_str
+        return 'X86CommonArchitecture::GetCached%sTypes(%d)' % (self.name.capitalize(), idx)
     
     def dump_to_file(self, decl_path):
+        # Types are materialized from these descriptors the first time an intrinsic is queried,
+        # see X86CommonArchitecture::GetCachedInputTypes
         with open(decl_path, 'w') as output:
             output.write('// Generated file, please do not edit directly\n\n')
-            type_id_str = self.cached_types[0].split(' ')[0]
+            output.write(f'static constexpr X86IntrinsicTypeDescriptor x86_intrinsic_{self.name}_type_descriptors[] = {{\n')
+            for descriptors in self.cached_descriptors:
+                for (kind, width, count) in descriptors:
+                    output.write(f'\t{{ {kind}, {width}, {count} }},\n')
+            output.write('};\n\n')
             n = len(self.cached_types)
-            output.write(f'X86CommonArchitecture::cached_{self.name}_types = new {type_id_str}[{n}];\n')
-            for idx, cached_type in enumerate(self.cached_types):
-                output.write(f'X86CommonArchitecture::cached_{self.name}_types[{idx}] = {cached_type};\n')
+            output.write(f'static constexpr X86IntrinsicSignature x86_intrinsic_{self.name}_signatures[{n}] = {{\n')
+            first = 0
+            for descriptors in self.cached_descriptors:
+                output.write(f'\t{{ {first}, {len(descriptors)} }},\n')
+                first += len(descriptors)
+            output.write('};\n')
 
 class CodeGenerator():
     
@@ -76,11 +87,13 @@ class CodeGenerator():
         s += '\n\treturn '
         return_str = 'vector<%s> ' % self.vector_element_name
         return_str += '{ '
+        descriptors = []
         for operand in ins.operands:
             if not self.rw in operand.rw:
                 continue
 
             op_str = operand.generate_str()
+            descriptors.append(operand.generate_descriptor())
 
             if self.enclose_element_with == '':
                 return_str += '%s, ' % op_str
@@ -91,7 +104,7 @@ class CodeGenerator():
             return_str = return_str[:-2]
 
         return_str += ' }'
-        return_str = self.type_cacher.get_cached_type_str(return_str)
+        return_str = self.type_cacher.get_cached_type_str(return_str, descriptors)
         s += return_str
         s += ';\n'
         self.file.write(s)
@@ -432,6 +445,18 @@ class Operand():
 
         return s
 
+    def generate_descriptor(self):
+        # (kind, element width in bytes, array element count), matching generate_str
+        if self.type == 'float':
+            kind = 'X86IntrinsicFloatType'
+        elif self.type == 'int':
+            kind = 'X86IntrinsicSignedType' if self.signed else 'X86IntrinsicUnsignedType'
+        else:
+            kind = 'X86IntrinsicBoolType'
+
+        count = self.n_element if self.n_element > 1 else 0
+        return (kind, self.element_size_byte, count)
+
 def main():
     intrinsic_input = CodeGenerator('../x86_intrinsic_input_type.include', 'NameAndType', 'NameAndType', 'input', 'r')
     intrinsic_output = CodeGenerator('../x86_intrinsic_output_type.include', 'Confidence<Ref<Type>>', '', 'output', 'w')
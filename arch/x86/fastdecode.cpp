@@ -0,0 +1,440 @@
+#include <array>
+#include "fastdecode.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+	#include <emmintrin.h>
+	#define FASTDECODE_SSE2
+	#ifdef _MSC_VER
+		#include <intrin.h>
+	#endif
+#endif
+
+using namespace std;
+
+namespace X86FastDecode
+{
+	enum OpcodeFlags : uint16_t
+	{
+		OP_MODRM = 1 << 0,
+		OP_IMM8 = 1 << 1,
+		OP_IMM16 = 1 << 2,
+		OP_IMMZ = 1 << 3, // 16 or 32 bits depending on operand size
+		OP_IMMV = 1 << 4, // 16, 32 or 64 bits depending on operand size
+		OP_MOFFS = 1 << 5, // Address sized offset
+		OP_REL8 = 1 << 6,
+		OP_RELZ = 1 << 7,
+		OP_INVALID64 = 1 << 8, // Not encodable in 64-bit mode
+		OP_SLOW = 1 << 9, // Always handled by XED
+		OP_GROUP = 1 << 10, // Validity and immediate depend on ModRM.reg, see CheckGroup
+		OP_OPSIZE_OK = 1 << 11, // 0F map instructions that allow an operand size prefix
+		OP_VALID = 1 << 12
+	};
+
+	typedef array<uint16_t, 256> OpcodeTable;
+
+	static constexpr void SetRange(OpcodeTable& table, size_t first, size_t last, uint16_t flags)
+	{
+		for (size_t i = first; i <= last; i++)
+			table[i] = flags | OP_VALID;
+	}
+
+	static constexpr OpcodeTable BuildOneByteTable()
+	{
+		OpcodeTable table {};
+		// ALU operations: 00-05, 08-0D, ..., 38-3D
+		for (size_t base = 0; base < 0x40; base += 8)
+		{
+			SetRange(table, base, base + 3, OP_MODRM);
+			SetRange(table, base + 4, base + 4, OP_IMM8);
+			SetRange(table, base + 5, base + 5, OP_IMMZ);
+		}
+		// push/pop segment and BCD adjust, 0F and the segment prefixes are handled elsewhere
+		for (size_t op : {0x06, 0x07, 0x0e, 0x16, 0x17, 0x1e, 0x1f, 0x27, 0x2f, 0x37, 0x3f})
+			SetRange(table, op, op, OP_INVALID64);
+		SetRange(table, 0x40, 0x4f, OP_INVALID64); // inc/dec, REX in 64-bit mode
+		SetRange(table, 0x50, 0x5f, 0);
+		SetRange(table, 0x60, 0x61, OP_INVALID64);
+		SetRange(table, 0x62, 0x62, OP_SLOW); // BOUND or EVEX
+		SetRange(table, 0x63, 0x63, OP_MODRM);
+		SetRange(table, 0x68, 0x68, OP_IMMZ);
+		SetRange(table, 0x69, 0x69, OP_MODRM | OP_IMMZ);
+		SetRange(table, 0x6a, 0x6a, OP_IMM8);
+		SetRange(table, 0x6b, 0x6b, OP_MODRM | OP_IMM8);
+		SetRange(table, 0x6c, 0x6f, 0);
+		SetRange(table, 0x70, 0x7f, OP_REL8);
+		SetRange(table, 0x80, 0x80, OP_MODRM | OP_IMM8);
+		SetRange(table, 0x81, 0x81, OP_MODRM | OP_IMMZ);
+		SetRange(table, 0x82, 0x82, OP_MODRM | OP_IMM8 | OP_INVALID64);
+		SetRange(table, 0x83, 0x83, OP_MODRM | OP_IMM8);
+		SetRange(table, 0x84, 0x8b, OP_MODRM);
+		SetRange(table, 0x8c, 0x8f, OP_MODRM | OP_GROUP);
+		SetRange(table, 0x90, 0x99, 0);
+		SetRange(table, 0x9a, 0x9a, OP_SLOW); // call far
+		SetRange(table, 0x9b, 0x9f, 0);
+		SetRange(table, 0xa0, 0xa3, OP_MOFFS);
+		SetRange(table, 0xa4, 0xa7, 0);
+		SetRange(table, 0xa8, 0xa8, OP_IMM8);
+		SetRange(table, 0xa9, 0xa9, OP_IMMZ);
+		SetRange(table, 0xaa, 0xaf, 0);
+		SetRange(table, 0xb0, 0xb7, OP_IMM8);
+		SetRange(table, 0xb8, 0xbf, OP_IMMV);
+		SetRange(table, 0xc0, 0xc1, OP_MODRM | OP_IMM8);
+		SetRange(table, 0xc2, 0xc2, OP_IMM16);
+		SetRange(table, 0xc3, 0xc3, 0);
+		SetRange(table, 0xc4, 0xc5, OP_SLOW); // VEX or LES/LDS
+		SetRange(table, 0xc6, 0xc7, OP_MODRM | OP_GROUP);
+		SetRange(table, 0xc8, 0xc8, OP_IMM16 | OP_IMM8);
+		SetRange(table, 0xc9, 0xc9, 0);
+		SetRange(table, 0xca, 0xcb, OP_SLOW); // ret far
+		SetRange(table, 0xcc, 0xcc, 0);
+		SetRange(table, 0xcd, 0xcd, OP_IMM8);
+		SetRange(table, 0xce, 0xcf, OP_SLOW); // into, iret
+		SetRange(table, 0xd0, 0xd3, OP_MODRM);
+		SetRange(table, 0xd4, 0xd5, OP_IMM8 | OP_INVALID64);
+		SetRange(table, 0xd6, 0xd6, OP_SLOW); // salc
+		SetRange(table, 0xd7, 0xd7, 0);
+		SetRange(table, 0xd8, 0xdf, OP_SLOW); // x87
+		SetRange(table, 0xe0, 0xe3, OP_REL8);
+		SetRange(table, 0xe4, 0xe7, OP_IMM8);
+		SetRange(table, 0xe8, 0xe9, OP_RELZ);
+		SetRange(table, 0xea, 0xea, OP_SLOW); // jmp far
+		SetRange(table, 0xeb, 0xeb, OP_REL8);
+		SetRange(table, 0xec, 0xef, 0);
+		SetRange(table, 0xf1, 0xf1, OP_SLOW); // int1
+		SetRange(table, 0xf4, 0xf5, 0);
+		SetRange(table, 0xf6, 0xf7, OP_MODRM | OP_GROUP);
+		SetRange(table, 0xf8, 0xfd, 0);
+		SetRange(table, 0xfe, 0xff, OP_MODRM | OP_GROUP);
+		return table;
+	}
+
+	static constexpr OpcodeTable BuildTwoByteTable()
+	{
+		// Deliberately only a conservative subset of the 0F map. Mandatory prefix forms (66/F2/F3)
+		// select different instructions for most of the remaining opcodes and are left to XED.
+		OpcodeTable table {};
+		SetRange(table, 0x0b, 0x0b, 0); // ud2
+		SetRange(table, 0x10, 0x11, OP_MODRM);
+		SetRange(table, 0x1f, 0x1f, OP_MODRM | OP_GROUP | OP_OPSIZE_OK); // nop
+		SetRange(table, 0x28, 0x29, OP_MODRM);
+		SetRange(table, 0x31, 0x31, 0); // rdtsc
+		SetRange(table, 0x40, 0x4f, OP_MODRM | OP_OPSIZE_OK); // cmovcc
+		SetRange(table, 0x54, 0x59, OP_MODRM);
+		SetRange(table, 0x5c, 0x5f, OP_MODRM);
+		SetRange(table, 0x80, 0x8f, OP_RELZ); // jcc
+		SetRange(table, 0x90, 0x9f, OP_MODRM | OP_GROUP); // setcc
+		SetRange(table, 0xa0, 0xa2, 0); // push fs, pop fs, cpuid
+		SetRange(table, 0xa3, 0xa3, OP_MODRM | OP_OPSIZE_OK);
+		SetRange(table, 0xa4, 0xa4, OP_MODRM | OP_IMM8 | OP_OPSIZE_OK);
+		SetRange(table, 0xa5, 0xa5, OP_MODRM | OP_OPSIZE_OK);
+		SetRange(table, 0xa8, 0xa9, 0); // push gs, pop gs
+		SetRange(table, 0xab, 0xab, OP_MODRM | OP_OPSIZE_OK);
+		SetRange(table, 0xac, 0xac, OP_MODRM | OP_IMM8 | OP_OPSIZE_OK);
+		SetRange(table, 0xad, 0xad, OP_MODRM | OP_OPSIZE_OK);
+		SetRange(table, 0xaf, 0xaf, OP_MODRM | OP_OPSIZE_OK);
+		SetRange(table, 0xb0, 0xb1, OP_MODRM | OP_OPSIZE_OK);
+		SetRange(table, 0xb3, 0xb3, OP_MODRM | OP_OPSIZE_OK);
+		SetRange(table, 0xb6, 0xb7, OP_MODRM | OP_OPSIZE_OK);
+		SetRange(table, 0xbb, 0xbf, OP_MODRM | OP_OPSIZE_OK);
+		SetRange(table, 0xc0, 0xc1, OP_MODRM | OP_OPSIZE_OK);
+		SetRange(table, 0xc8, 0xcf, 0); // bswap
+		return table;
+	}
+
+	static constexpr OpcodeTable g_oneByteTable = BuildOneByteTable();
+	static constexpr OpcodeTable g_twoByteTable = BuildTwoByteTable();
+
+	static constexpr array<bool, 256> BuildPrefixTable()
+	{
+		array<bool, 256> table {};
+		for (size_t op : {0x26, 0x2e, 0x36, 0x3e, 0x64, 0x65, 0x66, 0x67, 0xf0, 0xf2, 0xf3})
+			table[op] = true;
+		return table;
+	}
+
+	static constexpr array<bool, 256> g_prefixTable = BuildPrefixTable();
+
+
+	static inline size_t CountPrefixBytes(const uint8_t* data, size_t maxLen, size_t bits)
+	{
+#ifdef FASTDECODE_SSE2
+		// Classify the first 16 bytes at once, then count the leading prefix bytes
+		if (maxLen >= 16)
+		{
+			const __m128i bytes = _mm_loadu_si128((const __m128i*)data);
+			__m128i match = _mm_or_si128(
+				_mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(0x26)), _mm_cmpeq_epi8(bytes, _mm_set1_epi8(0x2e))),
+				_mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(0x36)), _mm_cmpeq_epi8(bytes, _mm_set1_epi8(0x3e))));
+			// 64-67 are all prefixes
+			match = _mm_or_si128(match,
+				_mm_cmpeq_epi8(_mm_and_si128(bytes, _mm_set1_epi8((char)0xfc)), _mm_set1_epi8(0x64)));
+			match = _mm_or_si128(match,
+				_mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8((char)0xf0)),
+					_mm_cmpeq_epi8(_mm_and_si128(bytes, _mm_set1_epi8((char)0xfe)), _mm_set1_epi8((char)0xf2))));
+			if (bits == 64)
+				match = _mm_or_si128(match,
+					_mm_cmpeq_epi8(_mm_and_si128(bytes, _mm_set1_epi8((char)0xf0)), _mm_set1_epi8(0x40)));
+
+			const unsigned int nonPrefix = ~(unsigned int)_mm_movemask_epi8(match) & 0xffff;
+			if (!nonPrefix)
+				return 16;
+#ifdef _MSC_VER
+			unsigned long index;
+			_BitScanForward(&index, nonPrefix);
+			return index;
+#else
+			return __builtin_ctz(nonPrefix);
+#endif
+		}
+#endif
+		size_t count = 0;
+		while ((count < maxLen) && (g_prefixTable[data[count]] || ((bits == 64) && ((data[count] & 0xf0) == 0x40))))
+			count++;
+		return count;
+	}
+
+
+	static inline bool CheckGroup(bool twoByte, uint8_t opcode, uint8_t modrm, bool& hasImmediate)
+	{
+		const uint8_t mod = modrm >> 6;
+		const uint8_t reg = (modrm >> 3) & 7;
+		if (twoByte)
+		{
+			// nop and setcc, which ignore ModRM.reg in hardware but are not all accepted by every decoder
+			return reg == 0;
+		}
+
+		switch (opcode)
+		{
+		case 0x8c:
+			return reg <= 5;
+		case 0x8d:
+			return mod != 3;
+		case 0x8e:
+			return (reg <= 5) && (reg != 1);
+		case 0x8f:
+			return reg == 0; // Otherwise XOP
+		case 0xc6:
+		case 0xc7:
+			hasImmediate = true;
+			return reg == 0; // Otherwise xabort/xbegin
+		case 0xf6:
+		case 0xf7:
+			hasImmediate = (reg == 0);
+			return reg != 1;
+		case 0xfe:
+			return reg <= 1;
+		case 0xff:
+			if (reg == 7)
+				return false;
+			if ((reg == 3) || (reg == 5))
+				return mod != 3;
+			return true;
+		default:
+			return true;
+		}
+	}
+
+
+	bool DecodeInstructionLength(const uint8_t* data, size_t maxLen, size_t bits, InstructionLengthInfo& result)
+	{
+		if ((bits != 32) && (bits != 64))
+			return false;
+		const size_t prefixCount = CountPrefixBytes(data, maxLen, bits);
+		// Instructions are at most 15 bytes long
+		if (maxLen > 15)
+			maxLen = 15;
+		if (prefixCount >= maxLen)
+			return false;
+
+		bool opsize16 = false;
+		bool repPrefix = false;
+		bool rexW = false;
+		for (size_t i = 0; i < prefixCount; i++)
+		{
+			switch (data[i])
+			{
+			case 0x66:
+				opsize16 = true;
+				break;
+			case 0xf2:
+			case 0xf3:
+				repPrefix = true;
+				break;
+			case 0x67: // 16-bit addressing and address sized branches
+			case 0xf0: // lock validity depends on the operand
+				return false;
+			case 0x26:
+			case 0x2e:
+			case 0x36:
+			case 0x3e:
+			case 0x64:
+			case 0x65:
+				break;
+			default:
+				// REX is only meaningful directly before the opcode
+				if (i != prefixCount - 1)
+					return false;
+				rexW = (data[i] & 8) != 0;
+				break;
+			}
+		}
+
+		size_t offset = prefixCount;
+		bool twoByte = false;
+		uint8_t opcode = data[offset++];
+		uint16_t flags;
+		if (opcode == 0x0f)
+		{
+			if (offset >= maxLen)
+				return false;
+			twoByte = true;
+			opcode = data[offset++];
+			flags = g_twoByteTable[opcode];
+			if (repPrefix || (opsize16 && !(flags & OP_OPSIZE_OK)))
+				return false;
+		}
+		else
+		{
+			flags = g_oneByteTable[opcode];
+		}
+
+		if (!(flags & OP_VALID) || (flags & OP_SLOW) || ((bits == 64) && (flags & OP_INVALID64)))
+			return false;
+
+		size_t immediateSize = 0;
+		if (flags & OP_MODRM)
+		{
+			if (offset >= maxLen)
+				return false;
+			const uint8_t modrm = data[offset++];
+			const uint8_t mod = modrm >> 6;
+			const uint8_t rm = modrm & 7;
+
+			bool groupImmediate = false;
+			if ((flags & OP_GROUP) && !CheckGroup(twoByte, opcode, modrm, groupImmediate))
+				return false;
+			if (groupImmediate)
+				immediateSize = (opcode & 1) ? (opsize16 ? 2 : 4) : 1;
+
+			if (mod != 3)
+			{
+				if (rm == 4)
+				{
+					if (offset >= maxLen)
+						return false;
+					const uint8_t sib = data[offset++];
+					if ((mod == 0) && ((sib & 7) == 5))
+						offset += 4;
+				}
+				else if ((mod == 0) && (rm == 5))
+				{
+					offset += 4;
+				}
+
+				if (mod == 1)
+					offset += 1;
+				else if (mod == 2)
+					offset += 4;
+			}
+
+			// Indirect branches are the only branches that take a ModRM byte
+			if (!twoByte && (opcode == 0xff))
+			{
+				const uint8_t reg = (modrm >> 3) & 7;
+				if ((reg >= 2) && (opsize16 || repPrefix))
+					return false;
+				if (reg == 2 || reg == 3)
+					result.branch = IndirectCall;
+				else if (reg == 4 || reg == 5)
+					result.branch = IndirectJump;
+				else
+					result.branch = NoBranch;
+			}
+			else
+			{
+				result.branch = NoBranch;
+			}
+		}
+		else
+		{
+			result.branch = NoBranch;
+		}
+
+		if (flags & OP_IMM8)
+			immediateSize += 1;
+		if (flags & OP_IMM16)
+			immediateSize += 2;
+		if (flags & OP_IMMZ)
+			immediateSize += opsize16 ? 2 : 4;
+		if (flags & OP_IMMV)
+			immediateSize += rexW ? 8 : (opsize16 ? 2 : 4);
+		if (flags & OP_MOFFS)
+			immediateSize += bits / 8;
+
+		result.displacement = 0;
+		if (flags & (OP_REL8 | OP_RELZ))
+		{
+			// Operand size overrides truncate the target and F2 is a BND prefix, leave both to XED
+			if (opsize16 || repPrefix)
+				return false;
+
+			const size_t relSize = (flags & OP_REL8) ? 1 : 4;
+			if (offset + relSize > maxLen)
+				return false;
+			if (relSize == 1)
+				result.displacement = (int8_t)data[offset];
+			else
+				result.displacement = (int32_t)((uint32_t)data[offset] | ((uint32_t)data[offset + 1] << 8)
+					| ((uint32_t)data[offset + 2] << 16) | ((uint32_t)data[offset + 3] << 24));
+			offset += relSize;
+
+			// jcc rel32 in the 0F map, jcc rel8 (70-7F) and loop/jcxz (E0-E3) in the one byte map
+			if (twoByte || (opcode <= 0xe3))
+				result.branch = ConditionalJump;
+			else if (opcode == 0xe8)
+				result.branch = RelativeCall;
+			else
+				result.branch = RelativeJump;
+		}
+		else if (!twoByte)
+		{
+			switch (opcode)
+			{
+			case 0xc2:
+			case 0xc3:
+				if (opsize16 || repPrefix)
+					return false;
+				result.branch = Return;
+				break;
+			case 0xcc:
+				result.branch = ExceptionInstruction;
+				break;
+			case 0xcd:
+				if (offset >= maxLen)
+					return false;
+				if (data[offset] == 0x80)
+					result.branch = SystemCallInterrupt;
+				else if (data[offset] == 0x29)
+					result.branch = ExceptionInstruction;
+				break;
+			case 0xf4:
+				result.branch = ExceptionInstruction;
+				break;
+			default:
+				break;
+			}
+		}
+		else if (opcode == 0x0b)
+		{
+			result.branch = ExceptionInstruction;
+		}
+
+		offset += immediateSize;
+		if (offset > maxLen)
+			return false;
+
+		result.length = offset;
+		return true;
+	}
+}
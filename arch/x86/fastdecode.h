@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Table driven x86 length decoder used to answer GetInstructionInfo without a full XED decode.
+// It only understands the common legacy and 0F opcode maps in 32 and 64-bit mode. Anything it
+// is not certain about (VEX/EVEX/XOP, x87, AMX, 3DNow!, lock prefixes, address size overrides,
+// invalid or mode specific encodings, ...) is reported as unhandled so that the caller can fall
+// back to XED, which keeps the results identical to the XED based path.
+namespace X86FastDecode
+{
+	enum BranchClass : uint8_t
+	{
+		NoBranch,
+		RelativeJump,
+		IndirectJump,
+		ConditionalJump,
+		RelativeCall,
+		IndirectCall,
+		Return,
+		SystemCallInterrupt,
+		ExceptionInstruction
+	};
+
+	struct InstructionLengthInfo
+	{
+		size_t length;
+		BranchClass branch;
+		int64_t displacement; // Relative to the end of the instruction, valid for relative branches
+	};
+
+	// Returns false if the instruction must be decoded by XED instead
+	bool DecodeInstructionLength(const uint8_t* data, size_t maxLen, size_t bits, InstructionLengthInfo& result);
+}
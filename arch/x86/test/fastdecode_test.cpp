@@ -0,0 +1,263 @@
+// Differential test and throughput benchmark for the fast length decoder (fastdecode.cpp).
+//
+// Every instruction the fast decoder claims to handle must decode successfully with XED, with the
+// same length and the same branch classification that SetInstructionInfoForInstruction derives.
+//
+//   x86_fastdecode_test [iterations]     run the differential test
+//   x86_fastdecode_test --bench [bytes]  compare decode throughput against XED
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+#include "fastdecode.h"
+extern "C" {
+	#include "xed-interface.h"
+}
+
+using namespace std;
+using namespace X86FastDecode;
+
+// Common encodings, mutated below to reach nearby opcodes, prefixes and ModRM forms
+static const vector<vector<uint8_t>> g_seeds = {
+	{0x55},                                           // push rbp
+	{0x48, 0x89, 0xe5},                               // mov rbp, rsp
+	{0x48, 0x83, 0xec, 0x20},                         // sub rsp, 0x20
+	{0x8b, 0x44, 0x24, 0x08},                         // mov eax, [esp+8]
+	{0x48, 0x8b, 0x05, 0x10, 0x20, 0x30, 0x40},       // mov rax, [rip+...]
+	{0xc7, 0x84, 0x24, 0x80, 0, 0, 0, 1, 2, 3, 4},    // mov dword [rsp+0x80], imm32
+	{0x48, 0xb8, 1, 2, 3, 4, 5, 6, 7, 8},             // mov rax, imm64
+	{0xe8, 0x10, 0x00, 0x00, 0x00},                   // call rel32
+	{0xe9, 0xf0, 0xff, 0xff, 0xff},                   // jmp rel32
+	{0xeb, 0xfe},                                     // jmp rel8
+	{0x74, 0x10},                                     // je rel8
+	{0x0f, 0x85, 0x00, 0x01, 0x00, 0x00},             // jne rel32
+	{0xe2, 0xfe},                                     // loop
+	{0xff, 0x25, 0x00, 0x10, 0x00, 0x00},             // jmp [rip+...]
+	{0xff, 0xd0},                                     // call rax
+	{0xc3},                                           // ret
+	{0xc2, 0x08, 0x00},                               // ret 8
+	{0xcc},                                           // int3
+	{0xcd, 0x80},                                     // int 0x80
+	{0xcd, 0x29},                                     // int 0x29
+	{0x0f, 0x0b},                                     // ud2
+	{0xf4},                                           // hlt
+	{0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00},             // nop word [rax+rax]
+	{0x66, 0x2e, 0x0f, 0x1f, 0x84, 0, 0, 0, 0, 0},    // nop word cs:[rax+rax]
+	{0x0f, 0xb6, 0x04, 0x0a},                         // movzx eax, byte [rdx+rcx]
+	{0x0f, 0x28, 0xc1},                               // movaps xmm0, xmm1
+	{0xf3, 0xa4},                                     // rep movsb
+	{0xa1, 1, 2, 3, 4, 5, 6, 7, 8},                   // mov eax, moffs
+	{0xc8, 0x10, 0x00, 0x01},                         // enter
+	{0xf6, 0x05, 1, 2, 3, 4, 0x80},                   // test byte [rip+...], imm8
+	{0x62, 0xf1, 0x7c, 0x48, 0x28, 0xc1},             // vmovaps zmm0, zmm1
+	{0xc5, 0xf8, 0x77},                               // vzeroupper
+	{0xf3, 0x0f, 0x1e, 0xfa},                         // endbr64
+};
+
+static uint64_t g_rngState = 0x243f6a8885a308d3ULL;
+
+static uint64_t NextRandom()
+{
+	// xorshift64*
+	g_rngState ^= g_rngState >> 12;
+	g_rngState ^= g_rngState << 25;
+	g_rngState ^= g_rngState >> 27;
+	return g_rngState * 0x2545f4914f6cdd1dULL;
+}
+
+
+static bool DecodeWithXed(const uint8_t* data, size_t len, size_t bits, xed_decoded_inst_t* xedd)
+{
+	if (bits == 64)
+		xed_decoded_inst_set_mode(xedd, XED_MACHINE_MODE_LONG_64, XED_ADDRESS_WIDTH_64b);
+	else
+		xed_decoded_inst_set_mode(xedd, XED_MACHINE_MODE_LEGACY_32, XED_ADDRESS_WIDTH_32b);
+
+	// Same configuration as X86CommonArchitecture::Decode
+	xed_decoded_inst_zero_keep_mode(xedd);
+	xed3_operand_set_cet(xedd, 1);
+	xed3_operand_set_mpxmode(xedd, 1);
+	return xed_decode(xedd, data, (unsigned)len) == XED_ERROR_NONE;
+}
+
+
+// Mirrors X86CommonArchitecture::SetInstructionInfoForInstruction
+static BranchClass ClassifyWithXed(xed_decoded_inst_t* xedd)
+{
+	const xed_iform_enum_t iform = xed_decoded_inst_get_iform_enum(xedd);
+	const xed_iclass_enum_t iclass = xed_decoded_inst_get_iclass(xedd);
+	switch (xed_decoded_inst_get_category(xedd))
+	{
+	case XED_CATEGORY_CALL:
+		if ((iform == XED_IFORM_CALL_NEAR_RELBRz) || (iform == XED_IFORM_CALL_NEAR_RELBRd))
+			return RelativeCall;
+		return IndirectCall;
+	case XED_CATEGORY_UNCOND_BR:
+		if (xed_operand_name(xed_inst_operand(xed_decoded_inst_inst(xedd), 0)) == XED_OPERAND_RELBR)
+			return RelativeJump;
+		return IndirectJump;
+	case XED_CATEGORY_COND_BR:
+		return ConditionalJump;
+	case XED_CATEGORY_INTERRUPT:
+		if (xed_decoded_inst_get_unsigned_immediate(xedd) == 0x80)
+			return SystemCallInterrupt;
+		if ((iclass == XED_ICLASS_INT3) || ((iclass == XED_ICLASS_INT) && (xed_decoded_inst_get_unsigned_immediate(xedd) == 0x29)))
+			return ExceptionInstruction;
+		return NoBranch;
+	case XED_CATEGORY_SYSCALL:
+		return SystemCallInterrupt;
+	case XED_CATEGORY_SYSRET:
+	case XED_CATEGORY_RET:
+		return Return;
+	default:
+		if ((iclass == XED_ICLASS_UD2) || (iclass == XED_ICLASS_HLT))
+			return ExceptionInstruction;
+		return NoBranch;
+	}
+}
+
+
+static bool CheckInstruction(const uint8_t* data, size_t len, size_t bits, uint64_t& handled)
+{
+	InstructionLengthInfo fast;
+	if (!DecodeInstructionLength(data, len, bits, fast))
+		return true;
+	handled++;
+
+	xed_decoded_inst_t xedd;
+	if (!DecodeWithXed(data, len, bits, &xedd))
+	{
+		fprintf(stderr, "MISMATCH (%zu-bit): fast decoder accepted an instruction XED rejects:", bits);
+	}
+	else
+	{
+		const size_t xedLength = xed_decoded_inst_get_length(&xedd);
+		const BranchClass xedBranch = ClassifyWithXed(&xedd);
+		bool ok = (xedLength == fast.length) && (xedBranch == fast.branch);
+		if (ok && ((fast.branch == RelativeJump) || (fast.branch == ConditionalJump) || (fast.branch == RelativeCall)))
+			ok = (int64_t)xed_decoded_inst_get_branch_displacement(&xedd) == fast.displacement;
+		if (ok)
+			return true;
+		fprintf(stderr, "MISMATCH (%zu-bit): xed len %zu branch %d, fast len %zu branch %d disp %" PRId64 ":",
+			bits, xedLength, (int)xedBranch, fast.length, (int)fast.branch, fast.displacement);
+	}
+
+	for (size_t i = 0; i < len; i++)
+		fprintf(stderr, " %02x", data[i]);
+	fprintf(stderr, "\n");
+	return false;
+}
+
+
+static int RunDifferentialTest(uint64_t iterations)
+{
+	uint64_t checked = 0, handled = 0, failures = 0;
+	uint8_t buffer[16];
+	for (size_t bits : {32, 64})
+	{
+		for (const auto& seed : g_seeds)
+		{
+			memset(buffer, 0, sizeof(buffer));
+			memcpy(buffer, seed.data(), seed.size());
+			checked++;
+			if (!CheckInstruction(buffer, sizeof(buffer), bits, handled))
+				failures++;
+		}
+
+		for (uint64_t i = 0; i < iterations; i++)
+		{
+			// Alternate between fully random bytes and mutations of a seed
+			for (size_t j = 0; j < sizeof(buffer); j++)
+				buffer[j] = (uint8_t)NextRandom();
+			if (i & 1)
+			{
+				const auto& seed = g_seeds[NextRandom() % g_seeds.size()];
+				memcpy(buffer, seed.data(), seed.size());
+				buffer[NextRandom() % seed.size()] = (uint8_t)NextRandom();
+			}
+
+			// Also exercise truncated input
+			const size_t len = (i % 7 == 0) ? (1 + NextRandom() % sizeof(buffer)) : sizeof(buffer);
+			checked++;
+			if (!CheckInstruction(buffer, len, bits, handled))
+				failures++;
+		}
+	}
+
+	printf("checked %" PRIu64 " inputs, fast decoder handled %" PRIu64 ", %" PRIu64 " mismatches\n",
+		checked, handled, failures);
+	return failures ? 1 : 0;
+}
+
+
+static int RunBenchmark(size_t size)
+{
+	// Build a stream of valid instructions by concatenating seeds, as linear sweep would see them
+	vector<uint8_t> code;
+	while (code.size() < size)
+	{
+		const auto& seed = g_seeds[NextRandom() % g_seeds.size()];
+		code.insert(code.end(), seed.begin(), seed.end());
+	}
+	code.resize(code.size() + 16, 0x90);
+
+	for (size_t bits : {32, 64})
+	{
+		size_t fastCount = 0, fallbackCount = 0, xedCount = 0;
+		auto start = chrono::steady_clock::now();
+		for (size_t offset = 0; offset < size;)
+		{
+			InstructionLengthInfo info;
+			xed_decoded_inst_t xedd;
+			if (DecodeInstructionLength(&code[offset], 16, bits, info))
+			{
+				offset += info.length;
+				fastCount++;
+			}
+			else if (DecodeWithXed(&code[offset], 16, bits, &xedd))
+			{
+				offset += xed_decoded_inst_get_length(&xedd);
+				fallbackCount++;
+			}
+			else
+			{
+				offset++;
+			}
+		}
+		auto fastTime = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+		start = chrono::steady_clock::now();
+		for (size_t offset = 0; offset < size;)
+		{
+			xed_decoded_inst_t xedd;
+			if (DecodeWithXed(&code[offset], 16, bits, &xedd))
+			{
+				offset += xed_decoded_inst_get_length(&xedd);
+				xedCount++;
+			}
+			else
+			{
+				offset++;
+			}
+		}
+		auto xedTime = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+		printf("%zu-bit: fast decoder %.1f MB/s (%zu fast, %zu fallback), xed %.1f MB/s (%zu instructions)\n", bits,
+			size / fastTime / 1e6, fastCount, fallbackCount, size / xedTime / 1e6, xedCount);
+	}
+	return 0;
+}
+
+
+int main(int argc, char* argv[])
+{
+	xed_tables_init();
+
+	if ((argc >= 2) && (strcmp(argv[1], "--bench") == 0))
+		return RunBenchmark((argc >= 3) ? strtoull(argv[2], nullptr, 0) : (64 << 20));
+
+	return RunDifferentialTest((argc >= 2) ? strtoull(argv[1], nullptr, 0) : 1000000);
+}
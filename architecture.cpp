@@ -21,6 +21,8 @@
 #define _CRT_SECURE_NO_WARNINGS
 #include <cstdio>
 #include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <inttypes.h>
 #include <vector>
 #include "binaryninjaapi.h"
@@ -168,6 +170,64 @@ vector<InstructionTextToken> InstructionTextToken::ConvertInstructionTextTokenLi
 }
 
 
+BNInstructionTextToken* InstructionTextToken::CreateInstructionTextTokenArena(const vector<InstructionTextToken>& tokens)
+{
+	// Layout: token structures, then the type name pointer arrays, then the string data
+	size_t nameCount = 0;
+	size_t stringSize = 0;
+	for (const auto& token : tokens)
+	{
+		nameCount += token.typeNames.size();
+		stringSize += token.text.size() + 1;
+		for (const auto& name : token.typeNames)
+			stringSize += name.size() + 1;
+	}
+
+	const size_t tokenSize = sizeof(BNInstructionTextToken) * tokens.size();
+	const size_t namesSize = sizeof(char*) * nameCount;
+	uint8_t* block = (uint8_t*)malloc(tokenSize + namesSize + stringSize + 1);
+	if (!block)
+		throw std::bad_alloc();
+
+	BNInstructionTextToken* result = (BNInstructionTextToken*)block;
+	char** names = (char**)(block + tokenSize);
+	char* strings = (char*)(block + tokenSize + namesSize);
+
+	auto copyString = [&](const string& str) {
+		char* copy = strings;
+		memcpy(copy, str.c_str(), str.size() + 1);
+		strings += str.size() + 1;
+		return copy;
+	};
+
+	for (size_t i = 0; i < tokens.size(); i++)
+	{
+		const InstructionTextToken& token = tokens[i];
+		result[i].type = token.type;
+		result[i].text = copyString(token.text);
+		result[i].value = token.value;
+		result[i].width = token.width;
+		result[i].size = token.size;
+		result[i].operand = token.operand;
+		result[i].context = token.context;
+		result[i].confidence = token.confidence;
+		result[i].address = token.address;
+		result[i].typeNames = names;
+		for (const auto& name : token.typeNames)
+			*(names++) = copyString(name);
+		result[i].namesCount = token.typeNames.size();
+		result[i].exprIndex = token.exprIndex;
+	}
+	return result;
+}
+
+
+void InstructionTextToken::FreeInstructionTextTokenArena(BNInstructionTextToken* tokens)
+{
+	free(tokens);
+}
+
+
 Architecture::Architecture(BNArchitecture* arch)
 {
 	m_object = arch;
@@ -264,21 +324,14 @@ bool Architecture::GetInstructionTextCallback(
 	}
 
 	*count = tokens.size();
-	*result = InstructionTextToken::CreateInstructionTextTokenList(tokens);
+	*result = InstructionTextToken::CreateInstructionTextTokenArena(tokens);
 	return true;
 }
 
 
-void Architecture::FreeInstructionTextCallback(BNInstructionTextToken* tokens, size_t count)
+void Architecture::FreeInstructionTextCallback(BNInstructionTextToken* tokens, size_t)
 {
-	for (size_t i = 0; i < count; i++)
-	{
-		BNFreeString(tokens[i].text);
-		for (size_t j = 0; j < tokens[j].namesCount; j++)
-			BNFreeString(tokens[i].typeNames[j]);
-		delete[] tokens[i].typeNames;
-	}
-	delete[] tokens;
+	InstructionTextToken::FreeInstructionTextTokenArena(tokens);
 }
 
 
@@ -902,6 +955,24 @@ Ref<Architecture> Architecture::GetAssociatedArchitectureByAddress(uint64_t&)
 }
 
 
+size_t Architecture::GetInstructionInfoBatch(
+    const uint8_t* data, uint64_t addr, size_t len, vector<InstructionInfo>& result)
+{
+	result.clear();
+	size_t offset = 0;
+	while (offset < len)
+	{
+		InstructionInfo info;
+		if (!GetInstructionInfo(data + offset, addr + offset, len - offset, info) || (info.length == 0)
+		    || (info.length > (len - offset)))
+			break;
+		result.push_back(info);
+		offset += info.length;
+	}
+	return offset;
+}
+
+
 bool Architecture::GetInstructionLowLevelIL(const uint8_t*, uint64_t, size_t&, LowLevelILFunction& il)
 {
 	il.AddInstruction(il.Undefined());
@@ -2433,7 +2504,7 @@ bool DisassemblyTextRenderer::GetInstructionText(uint64_t addr, size_t& len, vec
 		line.highlight = result[i].highlight;
 		line.tokens = InstructionTextToken::ConvertInstructionTextTokenList(result[i].tokens, result[i].count);
 		line.tags = Tag::ConvertTagList(result[i].tags, result[i].tagCount);
-		lines.push_back(line);
+		lines.push_back(std::move(line));
 	}
 
 	BNFreeDisassemblyTextLines(result, count);
@@ -2450,7 +2521,7 @@ vector<DisassemblyTextLine> DisassemblyTextRenderer::PostProcessInstructionTextL
 		inLines[i].addr = lines[i].addr;
 		inLines[i].instrIndex = lines[i].instrIndex;
 		inLines[i].highlight = lines[i].highlight;
-		inLines[i].tokens = InstructionTextToken::CreateInstructionTextTokenList(lines[i].tokens);
+		inLines[i].tokens = InstructionTextToken::CreateInstructionTextTokenArena(lines[i].tokens);
 		inLines[i].count = lines[i].tokens.size();
 		inLines[i].tags = Tag::CreateTagList(lines[i].tags, &inLines[i].tagCount);
 	}
@@ -2462,7 +2533,7 @@ vector<DisassemblyTextLine> DisassemblyTextRenderer::PostProcessInstructionTextL
 
 	for (size_t i = 0; i < lines.size(); i++)
 	{
-		InstructionTextToken::FreeInstructionTextTokenList(inLines[i].tokens, inLines[i].count);
+		InstructionTextToken::FreeInstructionTextTokenArena(inLines[i].tokens);
 		Tag::FreeTagList(inLines[i].tags, inLines[i].tagCount);
 	}
 	delete[] inLines;
@@ -2476,7 +2547,7 @@ vector<DisassemblyTextLine> DisassemblyTextRenderer::PostProcessInstructionTextL
 		line.highlight = result[i].highlight;
 		line.tokens = InstructionTextToken::ConvertInstructionTextTokenList(result[i].tokens, result[i].count);
 		line.tags = Tag::ConvertTagList(result[i].tags, result[i].tagCount);
-		outLines.push_back(line);
+		outLines.push_back(std::move(line));
 	}
 
 	BNFreeDisassemblyTextLines(result, count);
@@ -2499,7 +2570,7 @@ bool DisassemblyTextRenderer::GetDisassemblyText(uint64_t addr, size_t& len, vec
 		line.highlight = result[i].highlight;
 		line.tokens = InstructionTextToken::ConvertInstructionTextTokenList(result[i].tokens, result[i].count);
 		line.tags = Tag::ConvertTagList(result[i].tags, result[i].tagCount);
-		lines.push_back(line);
+		lines.push_back(std::move(line));
 	}
 
 	BNFreeDisassemblyTextLines(result, count);
@@ -2559,21 +2630,17 @@ bool DisassemblyTextRenderer::IsIntegerToken(BNInstructionTextTokenType type)
 void DisassemblyTextRenderer::AddIntegerToken(
     vector<InstructionTextToken>& tokens, const InstructionTextToken& token, Architecture* arch, uint64_t addr)
 {
-	BNInstructionTextToken inToken;
-	ConvertInstructionTextToken(token, &inToken);
+	BNInstructionTextToken* inToken = InstructionTextToken::CreateInstructionTextTokenArena({token});
 
 	size_t count = 0;
 	BNInstructionTextToken* result =
-	    BNGetDisassemblyTextRendererIntegerTokens(m_object, &inToken, arch ? arch->GetObject() : nullptr, addr, &count);
+	    BNGetDisassemblyTextRendererIntegerTokens(m_object, inToken, arch ? arch->GetObject() : nullptr, addr, &count);
 
 	vector<InstructionTextToken> newTokens =
 	    InstructionTextToken::ConvertAndFreeInstructionTextTokenList(result, count);
 	tokens.insert(tokens.end(), newTokens.begin(), newTokens.end());
 
-	BNFreeString(inToken.text);
-	for (size_t i = 0; i < inToken.namesCount; i++)
-		BNFreeString(inToken.typeNames[i]);
-	delete[] inToken.typeNames;
+	InstructionTextToken::FreeInstructionTextTokenArena(inToken);
 }
 
 
@@ -2585,7 +2652,7 @@ void DisassemblyTextRenderer::WrapComment(DisassemblyTextLine& line, vector<Disa
 	inLine.instrIndex = line.instrIndex;
 	inLine.highlight = line.highlight;
 	inLine.count = line.tokens.size();
-	inLine.tokens = InstructionTextToken::CreateInstructionTextTokenList(line.tokens);
+	inLine.tokens = InstructionTextToken::CreateInstructionTextTokenArena(line.tokens);
 	inLine.tags = Tag::CreateTagList(line.tags, &inLine.tagCount);
 
 	size_t count = 0;
@@ -2600,9 +2667,10 @@ void DisassemblyTextRenderer::WrapComment(DisassemblyTextLine& line, vector<Disa
 		line.highlight = result[i].highlight;
 		line.tokens = InstructionTextToken::ConvertInstructionTextTokenList(result[i].tokens, result[i].count);
 		line.tags = Tag::ConvertTagList(result[i].tags, result[i].tagCount);
-		lines.push_back(line);
+		lines.push_back(std::move(line));
 	}
 
 	BNFreeDisassemblyTextLines(result, count);
-	BNFreeInstructionText(inLine.tokens, inLine.count);
+	InstructionTextToken::FreeInstructionTextTokenArena(inLine.tokens);
+	Tag::FreeTagList(inLine.tags, inLine.tagCount);
 }
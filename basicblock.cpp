@@ -360,7 +360,7 @@ vector<DisassemblyTextLine> BasicBlock::GetDisassemblyText(DisassemblySettings*
 		line.highlight = lines[i].highlight;
 		line.tokens = InstructionTextToken::ConvertInstructionTextTokenList(lines[i].tokens, lines[i].count);
 		line.tags = Tag::ConvertTagList(lines[i].tags, lines[i].tagCount);
-		result.push_back(line);
+		result.push_back(std::move(line));
 	}
 
 	BNFreeDisassemblyTextLines(lines, count);
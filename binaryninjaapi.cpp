@@ -20,6 +20,7 @@
 
 #include "binaryninjaapi.h"
 #include <numeric>
+#include <condition_variable>
 
 using namespace BinaryNinja;
 using namespace std;
@@ -361,6 +362,70 @@ void BinaryNinja::SetWorkerThreadCount(size_t count)
 }
 
 
+void BinaryNinja::ParallelForRanges(size_t count, size_t minRangeSize, const function<void(size_t, size_t)>& func)
+{
+	size_t rangeCount = min<size_t>(GetWorkerThreadCount() + 1, count / max<size_t>(minRangeSize, 1));
+	if (rangeCount <= 1)
+	{
+		func(0, count);
+		return;
+	}
+
+	// Ranges are claimed from a shared counter by the caller and by the queued workers alike. A worker that
+	// only starts once every range has been claimed does nothing, so the caller never waits for tasks that
+	// are still queued behind it, and func is only used while the caller is waiting.
+	struct State
+	{
+		const function<void(size_t, size_t)>* func;
+		size_t count;
+		size_t rangeSize;
+		size_t rangeCount;
+		atomic<size_t> next {0};
+		mutex lock;
+		condition_variable finished;
+		size_t done = 0;
+		exception_ptr error;
+
+		void Run()
+		{
+			for (size_t range = next++; range < rangeCount; range = next++)
+			{
+				exception_ptr rangeError;
+				try
+				{
+					size_t begin = range * rangeSize;
+					(*func)(begin, min(begin + rangeSize, count));
+				}
+				catch (...)
+				{
+					rangeError = current_exception();
+				}
+
+				unique_lock<mutex> guard(lock);
+				if (rangeError && !error)
+					error = rangeError;
+				if (++done == rangeCount)
+					finished.notify_all();
+			}
+		}
+	};
+
+	auto state = make_shared<State>();
+	state->func = &func;
+	state->count = count;
+	state->rangeSize = (count + rangeCount - 1) / rangeCount;
+	state->rangeCount = (count + state->rangeSize - 1) / state->rangeSize;
+	for (size_t i = 1; i < state->rangeCount; i++)
+		WorkerPriorityEnqueue([state]() { state->Run(); }, "ParallelForRanges");
+	state->Run();
+
+	unique_lock<mutex> guard(state->lock);
+	state->finished.wait(guard, [&]() { return state->done == state->rangeCount; });
+	if (state->error)
+		rethrow_exception(state->error);
+}
+
+
 string BinaryNinja::GetUniqueIdentifierString()
 {
 	char* str = BNGetUniqueIdentifierString();
@@ -1696,6 +1696,17 @@ namespace BinaryNinja {
 	*/
 	void SetWorkerThreadCount(size_t count);
 
+	/*! Call func(begin, end) on contiguous ranges covering [0, count), splitting the work across the worker
+		thread pool when there is enough of it for more than one range of at least minRangeSize items.
+
+		The calling thread also processes ranges and this returns once all of them are done, so it may be called
+		from a worker thread. If func throws, the first exception is rethrown on the calling thread.
+
+		@threadsafe
+		\ingroup mainthread
+	*/
+	void ParallelForRanges(size_t count, size_t minRangeSize, const std::function<void(size_t, size_t)>& func);
+
 	/*!
 	    @threadsafe
 	*/
@@ -2247,6 +2258,27 @@ namespace BinaryNinja {
 		std::string GetId();
 	};
 
+	/*! StringInternTable is a table of immutable strings, local to the module that uses it.
+
+		Interning a string returns a single shared copy of it that stays valid for the lifetime of the process.
+		It is meant for caches of small, fixed vocabularies that are rendered over and over, such as register and
+		mnemonic names, which can then hold references to the interned copies instead of their own strings.
+		Entries are never removed. Interning does not avoid the copy each InstructionTextToken makes of its text.
+
+		The table lives in the API library, which is linked statically into each plugin and application. Every
+		module therefore has its own table.
+	*/
+	class StringInternTable
+	{
+	  public:
+		/*! Intern a string and return the shared copy of it
+
+			\param str String to intern
+			\return The interned string, valid for the lifetime of the process
+		*/
+		static const std::string& InternString(const std::string& str);
+	};
+
 	/*! `InstructionTextToken` is used to tell the core about the various components in the disassembly views.
 
 		The below table is provided for documentation purposes but the complete list of TokenTypes is available at
@@ -2335,6 +2367,12 @@ namespace BinaryNinja {
 		    BNInstructionTextToken* tokens, size_t count);
 		static std::vector<InstructionTextToken> ConvertInstructionTextTokenList(
 		    const BNInstructionTextToken* tokens, size_t count);
+
+		/*! Creates a token list in a single allocation holding the token structures, type name arrays and all
+		    strings. Lists created this way must only be freed with FreeInstructionTextTokenArena.
+		*/
+		static BNInstructionTextToken* CreateInstructionTextTokenArena(const std::vector<InstructionTextToken>& tokens);
+		static void FreeInstructionTextTokenArena(BNInstructionTextToken* tokens);
 	};
 
 	class UndoEntry;
@@ -6961,6 +6999,26 @@ namespace BinaryNinja {
 		virtual Ref<Settings> GetLoadSettingsForData(BinaryView* data) override;
 	};
 
+	/*! Convert an array of integers between the given byte order and the host byte order, in place
+
+		\param data Array to convert
+		\param count Number of elements in the array
+		\param elementSize Size of each element in bytes, elements of a size other than 2, 4 or 8 are left unchanged
+		\param endian Byte order of the data on the other side of the conversion
+		\ingroup binaryview
+	*/
+	void ConvertEndianness(void* data, size_t count, size_t elementSize, BNEndianness endian);
+
+	/*! Convert an array of packed structures between the given byte order and the host byte order, in place
+
+		\param data Array to convert
+		\param count Number of structures in the array
+		\param fieldSizes Sizes of the fields of a structure in order, the structure size is their sum
+		\param endian Byte order of the data on the other side of the conversion
+		\ingroup binaryview
+	*/
+	void ConvertStructEndianness(void* data, size_t count, const std::vector<size_t>& fieldSizes, BNEndianness endian);
+
 	/*! Thrown whenever a read is performed out of bounds.
 
 		\ingroup binaryview
@@ -6976,8 +7034,16 @@ namespace BinaryNinja {
 	*/
 	class BinaryReader
 	{
+		struct ReadBuffer;
+
 		Ref<BinaryView> m_view;
 		BNBinaryReader* m_stream;
+		std::unique_ptr<ReadBuffer> m_buffer;
+
+		bool ReadBuffered(void* dest, size_t len);
+		template <typename T>
+		bool ReadBufferedInteger(T& result, BNEndianness endian);
+		void SyncBufferedOffset() const;
 
 	  public:
 		/*! Create a BinaryReader instance given a BinaryView and endianness.
@@ -7250,6 +7316,86 @@ namespace BinaryNinja {
 		*/
 		bool TryReadBEPointer(uint64_t& result);
 
+		/*! Check whether an array fits between the cursor and the end of the view
+
+			Array counts usually come from the file being parsed, so this is checked before allocating space for them.
+			It does not check that every byte in the range is backed by data.
+
+			\param count Number of elements
+			\param elementSize Size of each element in bytes
+			\return False if the size of the array overflows or it extends past the end of the view
+		*/
+		bool CanReadArray(size_t count, size_t elementSize) const;
+
+		/*! Read an array of integers and convert them from the endianness of the reader
+
+			\throws ReadException
+			\param dest Address to write the elements to
+			\param count Number of elements to read
+			\param elementSize Size of each element in bytes
+		*/
+		void ReadArray(void* dest, size_t count, size_t elementSize);
+
+		/*! Read an array of integers into a vector and convert them from the endianness of the reader
+
+			\throws ReadException
+			\param count Number of elements to read
+			\return The elements read
+		*/
+		template <typename T>
+		std::vector<T> ReadArray(size_t count)
+		{
+			static_assert(std::is_integral_v<T> || std::is_enum_v<T>, "ReadArray requires an integer element type");
+			if (!CanReadArray(count, sizeof(T)))
+				throw ReadException();
+			std::vector<T> result(count);
+			ReadArray(result.data(), count, sizeof(T));
+			return result;
+		}
+
+		/*! Read an array of packed structures and convert each field from the endianness of the reader
+
+			\throws ReadException
+			\param dest Address to write the structures to
+			\param count Number of structures to read
+			\param fieldSizes Sizes of the fields of a structure in order
+		*/
+		void ReadStructArray(void* dest, size_t count, const std::vector<size_t>& fieldSizes);
+
+		/*! Try reading an array of integers and convert them from the endianness of the reader
+
+			\param dest Address to write the elements to
+			\param count Number of elements to read
+			\param elementSize Size of each element in bytes
+			\return Whether the read succeeded.
+		*/
+		bool TryReadArray(void* dest, size_t count, size_t elementSize);
+
+		/*! Try reading an array of integers into a vector and convert them from the endianness of the reader
+
+			\param dest Vector to store the elements in
+			\param count Number of elements to read
+			\return Whether the read succeeded.
+		*/
+		template <typename T>
+		bool TryReadArray(std::vector<T>& dest, size_t count)
+		{
+			static_assert(std::is_integral_v<T> || std::is_enum_v<T>, "TryReadArray requires an integer element type");
+			if (!CanReadArray(count, sizeof(T)))
+				return false;
+			dest.resize(count);
+			return TryReadArray(dest.data(), count, sizeof(T));
+		}
+
+		/*! Try reading an array of packed structures and convert each field from the endianness of the reader
+
+			\param dest Address to write the structures to
+			\param count Number of structures to read
+			\param fieldSizes Sizes of the fields of a structure in order
+			\return Whether the read succeeded.
+		*/
+		bool TryReadStructArray(void* dest, size_t count, const std::vector<size_t>& fieldSizes);
+
 		/*! Get the current cursor position
 
 			\return The current cursor position
@@ -7284,6 +7430,27 @@ namespace BinaryNinja {
 
 		*/
 		bool IsEndOfFile() const;
+
+		/*! Enable or disable read-ahead buffering
+
+			When enabled, reads are served from a window of up to `windowSize` bytes that is fetched from
+			the view at once, instead of going to the core for every value. Seeking within the window is
+			free. The window is discarded when the view reports that its data was written, inserted or
+			removed. Buffering is disabled by default.
+
+			\param windowSize Size of the read-ahead window in bytes, or 0 to disable buffering
+		*/
+		void SetBufferSize(size_t windowSize = 0x10000);
+
+		/*! Get the size of the read-ahead window
+
+			\return The window size in bytes, or 0 if buffering is disabled
+		*/
+		size_t GetBufferSize() const;
+
+		/*! Discard any data buffered by the reader, the next read fetches a new window from the view
+		*/
+		void InvalidateBuffer();
 	};
 
 	/*! Raised whenever a write is performed out of bounds.
@@ -7475,6 +7642,54 @@ namespace BinaryNinja {
 		bool TryWriteBE32(uint32_t val);
 		bool TryWriteBE64(uint64_t val);
 
+		/*! Write an array of integers to the current cursor position in the endianness of the writer
+
+		    \throws WriteException on out of bounds write
+			\param src Address of the elements to write
+			\param count Number of elements to write
+			\param elementSize Size of each element in bytes
+		*/
+		void WriteArray(const void* src, size_t count, size_t elementSize);
+
+		/*! Write a vector of integers to the current cursor position in the endianness of the writer
+
+		    \throws WriteException on out of bounds write
+			\param values Elements to write
+		*/
+		template <typename T>
+		void WriteArray(const std::vector<T>& values)
+		{
+			static_assert(std::is_integral_v<T> || std::is_enum_v<T>, "WriteArray requires an integer element type");
+			WriteArray(values.data(), values.size(), sizeof(T));
+		}
+
+		/*! Write an array of packed structures to the current cursor position in the endianness of the writer
+
+		    \throws WriteException on out of bounds write
+			\param src Address of the structures to write
+			\param count Number of structures to write
+			\param fieldSizes Sizes of the fields of a structure in order
+		*/
+		void WriteStructArray(const void* src, size_t count, const std::vector<size_t>& fieldSizes);
+
+		/*! Write an array of integers to the current cursor position in the endianness of the writer
+
+			\param src Address of the elements to write
+			\param count Number of elements to write
+			\param elementSize Size of each element in bytes
+			\return Whether the write succeeded
+		*/
+		bool TryWriteArray(const void* src, size_t count, size_t elementSize);
+
+		/*! Write an array of packed structures to the current cursor position in the endianness of the writer
+
+			\param src Address of the structures to write
+			\param count Number of structures to write
+			\param fieldSizes Sizes of the fields of a structure in order
+			\return Whether the write succeeded
+		*/
+		bool TryWriteStructArray(const void* src, size_t count, const std::vector<size_t>& fieldSizes);
+
 		/*! Get the current cursor position
 
 			\return The current cursor position
@@ -7786,6 +8001,22 @@ namespace BinaryNinja {
 		*/
 		virtual bool GetInstructionInfo(const uint8_t* data, uint64_t addr, size_t maxLen, InstructionInfo& result) = 0;
 
+		/*! Retrieves InstructionInfo structs for a run of consecutive instructions starting at the given virtual address
+
+			This is a convenience helper for API users that scan runs of code. It calls GetInstructionInfo once per
+			instruction, so it is not a batch interface to the core, which neither calls nor provides it. Decoding
+			stops at the end of the data, or at the first instruction that can't be decoded.
+
+			\param[in] data pointer to the instruction data to retrieve info for
+			\param[in] addr address of the first instruction
+			\param[in] len Length of the instruction data
+			\param[out] result Retrieved instruction info, one entry per decoded instruction, in address order. Any
+			previous contents are cleared.
+			\return Number of bytes covered by the decoded instructions
+		*/
+		size_t GetInstructionInfoBatch(
+		    const uint8_t* data, uint64_t addr, size_t len, std::vector<InstructionInfo>& result);
+
 		/*! Retrieves a list of InstructionTextTokens
 
 			\param[in] data pointer to the instruction data to retrieve text for
@@ -11239,6 +11470,7 @@ namespace BinaryNinja {
 	};
 
 	struct LowLevelILInstruction;
+	class LowLevelILExprSnapshot;
 	struct RegisterOrFlag;
 	struct SSARegister;
 	struct SSARegisterStack;
@@ -12543,6 +12775,7 @@ namespace BinaryNinja {
 		size_t GetInstructionForExpr(size_t expr) const;
 		size_t GetInstructionCount() const;
 		size_t GetExprCount() const;
+		LowLevelILExprSnapshot GetExprSnapshot();
 
 		void UpdateInstructionOperand(size_t i, size_t operandIndex, ExprId value);
 		void ReplaceExpr(size_t expr, size_t newExpr);
@@ -12664,6 +12897,7 @@ namespace BinaryNinja {
 	};
 
 	struct MediumLevelILInstruction;
+	class MediumLevelILExprSnapshot;
 
 	/*!
 		\ingroup mediumlevelil
@@ -12918,6 +13152,7 @@ namespace BinaryNinja {
 		size_t GetInstructionForExpr(size_t expr) const;
 		size_t GetInstructionCount() const;
 		size_t GetExprCount() const;
+		MediumLevelILExprSnapshot GetExprSnapshot();
 
 		void UpdateInstructionOperand(size_t i, size_t operandIndex, ExprId value);
 		void MarkInstructionForRemoval(size_t i);
@@ -13035,6 +13270,7 @@ namespace BinaryNinja {
 	};
 
 	struct HighLevelILInstruction;
+	class HighLevelILExprSnapshot;
 
 	/*!
 		\ingroup highlevelil
@@ -13249,6 +13485,7 @@ namespace BinaryNinja {
 		size_t GetInstructionForExpr(size_t expr) const;
 		size_t GetInstructionCount() const;
 		size_t GetExprCount() const;
+		HighLevelILExprSnapshot GetExprSnapshot(bool asFullAst = true);
 
 		std::vector<Ref<BasicBlock>> GetBasicBlocks() const;
 		Ref<BasicBlock> GetBasicBlockForInstruction(size_t i) const;
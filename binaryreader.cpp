@@ -18,12 +18,34 @@
 // FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
 // IN THE SOFTWARE.
 
+#include <cstring>
 #include "binaryninjaapi.h"
 
 using namespace BinaryNinja;
 using namespace std;
 
 
+// Read-ahead window used when buffering is enabled. It is registered as a notification on the view so
+// that the window can be discarded whenever the underlying data changes.
+struct BinaryReader::ReadBuffer : public BinaryDataNotification
+{
+	vector<uint8_t> data;
+	uint64_t start = 0;
+	size_t length = 0;
+	uint64_t offset;
+	BNEndianness endian;
+	atomic<bool> stale {false};
+
+	ReadBuffer(size_t windowSize, uint64_t cursor, BNEndianness endianness) :
+	    BinaryDataNotification(BinaryDataUpdates), data(windowSize), offset(cursor), endian(endianness)
+	{}
+
+	void OnBinaryDataWritten(BinaryView*, uint64_t, size_t) override { stale = true; }
+	void OnBinaryDataInserted(BinaryView*, uint64_t, size_t) override { stale = true; }
+	void OnBinaryDataRemoved(BinaryView*, uint64_t, uint64_t) override { stale = true; }
+};
+
+
 BinaryReader::BinaryReader(BinaryView* data, BNEndianness endian) : m_view(data)
 {
 	m_stream = BNCreateBinaryReader(data->GetObject());
@@ -33,25 +55,101 @@ BinaryReader::BinaryReader(BinaryView* data, BNEndianness endian) : m_view(data)
 
 BinaryReader::~BinaryReader()
 {
+	SetBufferSize(0);
 	BNFreeBinaryReader(m_stream);
 }
 
 
 BNEndianness BinaryReader::GetEndianness() const
 {
+	if (m_buffer)
+		return m_buffer->endian;
 	return BNGetBinaryReaderEndianness(m_stream);
 }
 
 
 void BinaryReader::SetEndianness(BNEndianness endian)
 {
+	if (m_buffer)
+		m_buffer->endian = endian;
 	BNSetBinaryReaderEndianness(m_stream, endian);
 }
 
 
+bool BinaryReader::ReadBuffered(void* dest, size_t len)
+{
+	ReadBuffer& buffer = *m_buffer;
+	if (buffer.stale.exchange(false))
+		buffer.length = 0;
+
+	uint64_t relative = buffer.offset - buffer.start;
+	if ((buffer.offset >= buffer.start) && (relative <= buffer.length) && (len <= (buffer.length - relative)))
+	{
+		memcpy(dest, &buffer.data[relative], len);
+		buffer.offset += len;
+		return true;
+	}
+
+	BNSeekBinaryReader(m_stream, buffer.offset);
+	if (len > buffer.data.size())
+	{
+		// Larger than the window, read directly into the destination
+		if (!BNReadData(m_stream, dest, len))
+			return false;
+		buffer.offset += len;
+		return true;
+	}
+
+	// Fetch a new window starting at the cursor. Near the end of the readable data a full window
+	// is not available, so shrink the window until the read succeeds.
+	buffer.length = 0;
+	for (size_t size = buffer.data.size();; size = max(size / 2, len))
+	{
+		if (BNReadData(m_stream, buffer.data.data(), size))
+		{
+			buffer.start = buffer.offset;
+			buffer.length = size;
+			break;
+		}
+		BNSeekBinaryReader(m_stream, buffer.offset);
+		if (size == len)
+			return false;
+	}
+
+	memcpy(dest, buffer.data.data(), len);
+	buffer.offset += len;
+	return true;
+}
+
+
+template <typename T>
+bool BinaryReader::ReadBufferedInteger(T& result, BNEndianness endian)
+{
+	uint8_t bytes[sizeof(T)];
+	if (!ReadBuffered(bytes, sizeof(T)))
+		return false;
+	result = 0;
+	for (size_t i = 0; i < sizeof(T); i++)
+	{
+		size_t shift = (endian == LittleEndian) ? (i * 8) : ((sizeof(T) - 1 - i) * 8);
+		result |= (T)bytes[i] << shift;
+	}
+	return true;
+}
+
+
+void BinaryReader::SyncBufferedOffset() const
+{
+	// The core reader position is only updated when a window is fetched, move it to the cursor
+	// before calling into the core for anything that depends on it
+	if (m_buffer)
+		BNSeekBinaryReader(m_stream, m_buffer->offset);
+}
+
+
 void BinaryReader::Read(void* dest, size_t len)
 {
-	if (!BNReadData(m_stream, dest, len))
+	if (!TryRead(dest, len))
 		throw ReadException();
 }
 
@@ -74,7 +172,7 @@ string BinaryReader::ReadString(size_t len)
 uint8_t BinaryReader::Read8()
 {
 	uint8_t result;
-	if (!BNRead8(m_stream, &result))
+	if (!TryRead8(result))
 		throw ReadException();
 	return result;
 }
@@ -83,7 +181,7 @@ uint8_t BinaryReader::Read8()
 uint16_t BinaryReader::Read16()
 {
 	uint16_t result;
-	if (!BNRead16(m_stream, &result))
+	if (!TryRead16(result))
 		throw ReadException();
 	return result;
 }
@@ -92,7 +190,7 @@ uint16_t BinaryReader::Read16()
 uint32_t BinaryReader::Read32()
 {
 	uint32_t result;
-	if (!BNRead32(m_stream, &result))
+	if (!TryRead32(result))
 		throw ReadException();
 	return result;
 }
@@ -101,7 +199,7 @@ uint32_t BinaryReader::Read32()
 uint64_t BinaryReader::Read64()
 {
 	uint64_t result;
-	if (!BNRead64(m_stream, &result))
+	if (!TryRead64(result))
 		throw ReadException();
 	return result;
 }
@@ -123,7 +221,7 @@ uint64_t BinaryReader::ReadPointer()
 uint16_t BinaryReader::ReadLE16()
 {
 	uint16_t result;
-	if (!BNReadLE16(m_stream, &result))
+	if (!TryReadLE16(result))
 		throw ReadException();
 	return result;
 }
@@ -132,7 +230,7 @@ uint16_t BinaryReader::ReadLE16()
 uint32_t BinaryReader::ReadLE32()
 {
 	uint32_t result;
-	if (!BNReadLE32(m_stream, &result))
+	if (!TryReadLE32(result))
 		throw ReadException();
 	return result;
 }
@@ -141,7 +239,7 @@ uint32_t BinaryReader::ReadLE32()
 uint64_t BinaryReader::ReadLE64()
 {
 	uint64_t result;
-	if (!BNReadLE64(m_stream, &result))
+	if (!TryReadLE64(result))
 		throw ReadException();
 	return result;
 }
@@ -149,45 +247,8 @@ uint64_t BinaryReader::ReadLE64()
 uint64_t BinaryReader::ReadLEPointer()
 {
 	uint64_t result;
-	size_t addressSize = m_view->GetAddressSize();
-	switch (addressSize)
-	{
-		case 1:
-		{
-			uint8_t r;
-			if (!BNRead8(m_stream, &r))
-				throw ReadException();
-			result = r;
-			break;
-		}
-		case 2:
-		{
-			uint16_t r;
-			if (!BNReadLE16(m_stream, &r))
-				throw ReadException();
-			result = r;
-			break;
-		}
-		case 4:
-		{
-			uint32_t r;
-			if (!BNReadLE32(m_stream, &r))
-				throw ReadException();
-			result = r;
-			break;
-		}
-		case 8:
-		{
-			if (!BNReadLE64(m_stream, &result))
-				throw ReadException();
-			break;
-		}
-		default:
-		{
-			throw ReadException();
-			break;
-		}
-	}
+	if (!TryReadLEPointer(result))
+		throw ReadException();
 	return result;
 }
 
@@ -195,7 +256,7 @@ uint64_t BinaryReader::ReadLEPointer()
 uint16_t BinaryReader::ReadBE16()
 {
 	uint16_t result;
-	if (!BNReadBE16(m_stream, &result))
+	if (!TryReadBE16(result))
 		throw ReadException();
 	return result;
 }
@@ -204,7 +265,7 @@ uint16_t BinaryReader::ReadBE16()
 uint32_t BinaryReader::ReadBE32()
 {
 	uint32_t result;
-	if (!BNReadBE32(m_stream, &result))
+	if (!TryReadBE32(result))
 		throw ReadException();
 	return result;
 }
@@ -213,7 +274,7 @@ uint32_t BinaryReader::ReadBE32()
 uint64_t BinaryReader::ReadBE64()
 {
 	uint64_t result;
-	if (!BNReadBE64(m_stream, &result))
+	if (!TryReadBE64(result))
 		throw ReadException();
 	return result;
 }
@@ -222,51 +283,16 @@ uint64_t BinaryReader::ReadBE64()
 uint64_t BinaryReader::ReadBEPointer()
 {
 	uint64_t result;
-	size_t addressSize = m_view->GetAddressSize();
-	switch (addressSize)
-	{
-		case 1:
-		{
-			uint8_t r;
-			if (!BNRead8(m_stream, &r))
-				throw ReadException();
-			result = r;
-			break;
-		}
-		case 2:
-		{
-			uint16_t r;
-			if (!BNReadBE16(m_stream, &r))
-				throw ReadException();
-			result = r;
-			break;
-		}
-		case 4:
-		{
-			uint32_t r;
-			if (!BNReadBE32(m_stream, &r))
-				throw ReadException();
-			result = r;
-			break;
-		}
-		case 8:
-		{
-			if (!BNReadBE64(m_stream, &result))
-				throw ReadException();
-			break;
-		}
-		default:
-		{
-			throw ReadException();
-			break;
-		}
-	}
+	if (!TryReadBEPointer(result))
+		throw ReadException();
 	return result;
 }
 
 
 bool BinaryReader::TryRead(void* dest, size_t len)
 {
+	if (m_buffer)
+		return ReadBuffered(dest, len);
 	return BNReadData(m_stream, dest, len);
 }
 
@@ -290,48 +316,68 @@ bool BinaryReader::TryReadString(string& dest, size_t len)
 
 bool BinaryReader::TryRead8(uint8_t& result)
 {
+	if (m_buffer)
+		return ReadBuffered(&result, 1);
 	return BNRead8(m_stream, &result);
 }
 
 
 bool BinaryReader::TryRead16(uint16_t& result)
 {
+	if (m_buffer)
+		return ReadBufferedInteger(result, m_buffer->endian);
 	return BNRead16(m_stream, &result);
 }
 
 
 bool BinaryReader::TryRead32(uint32_t& result)
 {
+	if (m_buffer)
+		return ReadBufferedInteger(result, m_buffer->endian);
 	return BNRead32(m_stream, &result);
 }
 
 
 bool BinaryReader::TryRead64(uint64_t& result)
 {
+	if (m_buffer)
+		return ReadBufferedInteger(result, m_buffer->endian);
 	return BNRead64(m_stream, &result);
 }
 
 
 bool BinaryReader::TryReadPointer(uint64_t& result)
 {
+	if (m_buffer)
+	{
+		if (m_buffer->endian == BigEndian)
+			return TryReadBEPointer(result);
+		return TryReadLEPointer(result);
+	}
 	return BNReadPointer(m_view->GetObject(), m_stream, &result);
 }
 
 
 bool BinaryReader::TryReadLE16(uint16_t& result)
 {
+	if (m_buffer)
+		return ReadBufferedInteger(result, LittleEndian);
 	return BNReadLE16(m_stream, &result);
 }
 
 
 bool BinaryReader::TryReadLE32(uint32_t& result)
 {
+	if (m_buffer)
+		return ReadBufferedInteger(result, LittleEndian);
 	return BNReadLE32(m_stream, &result);
 }
 
 
 bool BinaryReader::TryReadLE64(uint64_t& result)
 {
+	if (m_buffer)
+		return ReadBufferedInteger(result, LittleEndian);
 	return BNReadLE64(m_stream, &result);
 }
 
@@ -344,7 +390,7 @@ bool BinaryReader::TryReadLEPointer(uint64_t& result)
 		case 1:
 		{
 			uint8_t r;
-			if (!BNRead8(m_stream, &r))
+			if (!TryRead8(r))
 				return false;
 			result = r;
 			break;
@@ -352,7 +398,7 @@ bool BinaryReader::TryReadLEPointer(uint64_t& result)
 		case 2:
 		{
 			uint16_t r;
-			if (!BNReadLE16(m_stream, &r))
+			if (!TryReadLE16(r))
 				return false;
 			result = r;
 			break;
@@ -360,14 +406,14 @@ bool BinaryReader::TryReadLEPointer(uint64_t& result)
 		case 4:
 		{
 			uint32_t r;
-			if (!BNReadLE32(m_stream, &r))
+			if (!TryReadLE32(r))
 				return false;
 			result = r;
 			break;
 		}
 		case 8:
 		{
-			if (!BNReadLE64(m_stream, &result))
+			if (!TryReadLE64(result))
 				return false;
 			break;
 		}
@@ -382,23 +428,28 @@ bool BinaryReader::TryReadLEPointer(uint64_t& result)
 
 bool BinaryReader::TryReadBE16(uint16_t& result)
 {
+	if (m_buffer)
+		return ReadBufferedInteger(result, BigEndian);
 	return BNReadBE16(m_stream, &result);
 }
 
 
 bool BinaryReader::TryReadBE32(uint32_t& result)
 {
+	if (m_buffer)
+		return ReadBufferedInteger(result, BigEndian);
 	return BNReadBE32(m_stream, &result);
 }
 
 
 bool BinaryReader::TryReadBE64(uint64_t& result)
 {
+	if (m_buffer)
+		return ReadBufferedInteger(result, BigEndian);
 	return BNReadBE64(m_stream, &result);
 }
 
 
-
 bool BinaryReader::TryReadBEPointer(uint64_t& result)
 {
 	size_t addressSize = m_view->GetAddressSize();
@@ -407,7 +458,7 @@ bool BinaryReader::TryReadBEPointer(uint64_t& result)
 		case 1:
 		{
 			uint8_t r;
-			if (!BNRead8(m_stream, &r))
+			if (!TryRead8(r))
 				return false;
 			result = r;
 			break;
@@ -415,7 +466,7 @@ bool BinaryReader::TryReadBEPointer(uint64_t& result)
 		case 2:
 		{
 			uint16_t r;
-			if (!BNReadBE16(m_stream, &r))
+			if (!TryReadBE16(r))
 				return false;
 			result = r;
 			break;
@@ -423,14 +474,14 @@ bool BinaryReader::TryReadBEPointer(uint64_t& result)
 		case 4:
 		{
 			uint32_t r;
-			if (!BNReadBE32(m_stream, &r))
+			if (!TryReadBE32(r))
 				return false;
 			result = r;
 			break;
 		}
 		case 8:
 		{
-			if (!BNReadBE64(m_stream, &result))
+			if (!TryReadBE64(result))
 				return false;
 			break;
 		}
@@ -443,20 +494,83 @@ bool BinaryReader::TryReadBEPointer(uint64_t& result)
 }
 
 
+void BinaryReader::ReadArray(void* dest, size_t count, size_t elementSize)
+{
+	if (!TryReadArray(dest, count, elementSize))
+		throw ReadException();
+}
+
+
+void BinaryReader::ReadStructArray(void* dest, size_t count, const vector<size_t>& fieldSizes)
+{
+	if (!TryReadStructArray(dest, count, fieldSizes))
+		throw ReadException();
+}
+
+
+bool BinaryReader::CanReadArray(size_t count, size_t elementSize) const
+{
+	if (elementSize && (count > (SIZE_MAX / elementSize)))
+		return false;
+	const uint64_t address = BNGetBinaryReaderVirtualBase(m_stream) + GetOffset();
+	const uint64_t end = m_view->GetEnd();
+	if (address > end)
+		return (count * elementSize) == 0;
+	return (uint64_t)(count * elementSize) <= (end - address);
+}
+
+
+bool BinaryReader::TryReadArray(void* dest, size_t count, size_t elementSize)
+{
+	if (!CanReadArray(count, elementSize))
+		return false;
+	if (!TryRead(dest, count * elementSize))
+		return false;
+	ConvertEndianness(dest, count, elementSize, GetEndianness());
+	return true;
+}
+
+
+bool BinaryReader::TryReadStructArray(void* dest, size_t count, const vector<size_t>& fieldSizes)
+{
+	size_t structSize = 0;
+	for (size_t size : fieldSizes)
+		structSize += size;
+	if (!CanReadArray(count, structSize))
+		return false;
+	if (!TryRead(dest, count * structSize))
+		return false;
+	ConvertStructEndianness(dest, count, fieldSizes, GetEndianness());
+	return true;
+}
+
+
 uint64_t BinaryReader::GetOffset() const
 {
+	if (m_buffer)
+		return m_buffer->offset;
 	return BNGetReaderPosition(m_stream);
 }
 
 
 void BinaryReader::Seek(uint64_t offset)
 {
+	if (m_buffer)
+	{
+		m_buffer->offset = offset;
+		return;
+	}
 	BNSeekBinaryReader(m_stream, offset);
 }
 
 
 void BinaryReader::SeekRelative(int64_t offset)
 {
+	if (m_buffer)
+	{
+		m_buffer->offset += offset;
+		return;
+	}
 	BNSeekBinaryReaderRelative(m_stream, offset);
 }
 
@@ -468,16 +582,55 @@ uint64_t BinaryReader::GetVirtualBase()
 
 void BinaryReader::SetVirtualBase(uint64_t base)
 {
+	SyncBufferedOffset();
 	BNSetBinaryReaderVirtualBase(m_stream, base);
+	if (m_buffer)
+	{
+		// The cursor is relative to the virtual base, so the buffered window no longer applies
+		m_buffer->offset = BNGetReaderPosition(m_stream);
+		m_buffer->length = 0;
+	}
 }
 
 
 bool BinaryReader::IsEndOfFile() const
 {
+	SyncBufferedOffset();
 	return BNIsEndOfFile(m_stream);
 }
 
 
+void BinaryReader::SetBufferSize(size_t windowSize)
+{
+	if (m_buffer)
+	{
+		SyncBufferedOffset();
+		m_view->UnregisterNotification(m_buffer.get());
+		m_buffer.reset();
+	}
+	if (windowSize == 0)
+		return;
+
+	m_buffer = make_unique<ReadBuffer>(windowSize, BNGetReaderPosition(m_stream), BNGetBinaryReaderEndianness(m_stream));
+	m_view->RegisterNotification(m_buffer.get());
+}
+
+
+size_t BinaryReader::GetBufferSize() const
+{
+	if (m_buffer)
+		return m_buffer->data.size();
+	return 0;
+}
+
+
+void BinaryReader::InvalidateBuffer()
+{
+	if (m_buffer)
+		m_buffer->length = 0;
+}
+
+
 template <typename T>
 T BinaryReader::Read()
 {
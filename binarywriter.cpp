@@ -216,6 +216,40 @@ bool BinaryWriter::TryWriteBE64(uint64_t val)
 }
 
 
+void BinaryWriter::WriteArray(const void* src, size_t count, size_t elementSize)
+{
+	if (!TryWriteArray(src, count, elementSize))
+		throw WriteException();
+}
+
+
+void BinaryWriter::WriteStructArray(const void* src, size_t count, const vector<size_t>& fieldSizes)
+{
+	if (!TryWriteStructArray(src, count, fieldSizes))
+		throw WriteException();
+}
+
+
+bool BinaryWriter::TryWriteArray(const void* src, size_t count, size_t elementSize)
+{
+	// Convert a copy so that the caller's data is left in host byte order
+	vector<uint8_t> data((const uint8_t*)src, (const uint8_t*)src + count * elementSize);
+	ConvertEndianness(data.data(), count, elementSize, GetEndianness());
+	return BNWriteData(m_stream, data.data(), data.size());
+}
+
+
+bool BinaryWriter::TryWriteStructArray(const void* src, size_t count, const vector<size_t>& fieldSizes)
+{
+	size_t structSize = 0;
+	for (size_t size : fieldSizes)
+		structSize += size;
+	vector<uint8_t> data((const uint8_t*)src, (const uint8_t*)src + count * structSize);
+	ConvertStructEndianness(data.data(), count, fieldSizes, GetEndianness());
+	return BNWriteData(m_stream, data.data(), data.size());
+}
+
+
 uint64_t BinaryWriter::GetOffset() const
 {
 	return BNGetWriterPosition(m_stream);
@@ -89,7 +89,7 @@ BNDisassemblyTextLine* DataRenderer::GetLinesForDataCallback(void* ctxt, BNBinar
 		buf[i].addr = line.addr;
 		buf[i].instrIndex = line.instrIndex;
 		buf[i].highlight = line.highlight;
-		buf[i].tokens = InstructionTextToken::CreateInstructionTextTokenList(line.tokens);
+		buf[i].tokens = InstructionTextToken::CreateInstructionTextTokenArena(line.tokens);
 		buf[i].count = line.tokens.size();
 		buf[i].tags = Tag::CreateTagList(line.tags, &(buf[i].tagCount));
 	}
@@ -109,6 +109,11 @@ void DataRenderer::FreeCallback(void* ctxt)
 
 void DataRenderer::FreeLinesCallback(void* ctxt, BNDisassemblyTextLine* lines, size_t count)
 {
+	for (size_t i = 0; i < count; i++)
+	{
+		InstructionTextToken::FreeInstructionTextTokenArena(lines[i].tokens);
+		Tag::FreeTagList(lines[i].tags, lines[i].tagCount);
+	}
 	delete[] lines;
 }
 
@@ -0,0 +1,290 @@
+// Copyright (c) 2015-2024 Vector 35 Inc
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include <cstring>
+#include "binaryninjaapi.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+	#define ENDIAN_SIMD_X86
+	#include <immintrin.h>
+	#ifdef _MSC_VER
+		#include <intrin.h>
+		#define SIMD_TARGET(features)
+	#else
+		#define SIMD_TARGET(features) __attribute__((target(features)))
+	#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+	#define ENDIAN_SIMD_NEON
+	#include <arm_neon.h>
+#endif
+
+using namespace BinaryNinja;
+using namespace std;
+
+
+static inline uint16_t Swap16(uint16_t value)
+{
+	return (uint16_t)((value >> 8) | (value << 8));
+}
+
+
+static inline uint32_t Swap32(uint32_t value)
+{
+	return ((uint32_t)Swap16((uint16_t)value) << 16) | Swap16((uint16_t)(value >> 16));
+}
+
+
+static inline uint64_t Swap64(uint64_t value)
+{
+	return ((uint64_t)Swap32((uint32_t)value) << 32) | Swap32((uint32_t)(value >> 32));
+}
+
+
+template <size_t N>
+static void SwapScalar(uint8_t* data, size_t count)
+{
+	for (size_t i = 0; i < count; i++, data += N)
+	{
+		if constexpr (N == 2)
+		{
+			uint16_t value;
+			memcpy(&value, data, sizeof(value));
+			value = Swap16(value);
+			memcpy(data, &value, sizeof(value));
+		}
+		else if constexpr (N == 4)
+		{
+			uint32_t value;
+			memcpy(&value, data, sizeof(value));
+			value = Swap32(value);
+			memcpy(data, &value, sizeof(value));
+		}
+		else
+		{
+			uint64_t value;
+			memcpy(&value, data, sizeof(value));
+			value = Swap64(value);
+			memcpy(data, &value, sizeof(value));
+		}
+	}
+}
+
+
+#ifdef ENDIAN_SIMD_X86
+// Byte shuffle that reverses each N byte element of a 16 byte vector
+template <size_t N>
+static inline __m128i SwapMask128()
+{
+	if constexpr (N == 2)
+		return _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+	else if constexpr (N == 4)
+		return _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+	else
+		return _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+}
+
+
+template <size_t N>
+SIMD_TARGET("ssse3") static void SwapSSSE3(uint8_t* data, size_t count)
+{
+	const __m128i mask = SwapMask128<N>();
+	size_t bytes = count * N;
+	size_t i = 0;
+	for (; i + 16 <= bytes; i += 16)
+	{
+		__m128i v = _mm_loadu_si128((const __m128i*)(data + i));
+		_mm_storeu_si128((__m128i*)(data + i), _mm_shuffle_epi8(v, mask));
+	}
+	SwapScalar<N>(data + i, (bytes - i) / N);
+}
+
+
+template <size_t N>
+SIMD_TARGET("avx2") static void SwapAVX2(uint8_t* data, size_t count)
+{
+	// vpshufb shuffles within each 128-bit lane, so the same mask is used for both lanes
+	const __m128i half = SwapMask128<N>();
+	const __m256i mask = _mm256_inserti128_si256(_mm256_castsi128_si256(half), half, 1);
+	size_t bytes = count * N;
+	size_t i = 0;
+	for (; i + 32 <= bytes; i += 32)
+	{
+		__m256i v = _mm256_loadu_si256((const __m256i*)(data + i));
+		_mm256_storeu_si256((__m256i*)(data + i), _mm256_shuffle_epi8(v, mask));
+	}
+	SwapSSSE3<N>(data + i, (bytes - i) / N);
+}
+
+
+enum X86SwapLevel
+{
+	X86SwapScalar,
+	X86SwapSSSE3,
+	X86SwapAVX2
+};
+
+
+static X86SwapLevel DetectX86SwapLevel()
+{
+#ifdef _MSC_VER
+	int info[4];
+	__cpuid(info, 0);
+	int maxLeaf = info[0];
+	__cpuid(info, 1);
+	bool ssse3 = (info[2] & (1 << 9)) != 0;
+	bool osAvx = ((info[2] & (1 << 27)) != 0) && ((_xgetbv(0) & 6) == 6);
+	bool avx2 = false;
+	if (osAvx && (maxLeaf >= 7))
+	{
+		__cpuidex(info, 7, 0);
+		avx2 = (info[1] & (1 << 5)) != 0;
+	}
+#else
+	__builtin_cpu_init();
+	bool ssse3 = __builtin_cpu_supports("ssse3");
+	bool avx2 = __builtin_cpu_supports("avx2");
+#endif
+	if (avx2)
+		return X86SwapAVX2;
+	if (ssse3)
+		return X86SwapSSSE3;
+	return X86SwapScalar;
+}
+#endif
+
+
+#ifdef ENDIAN_SIMD_NEON
+template <size_t N>
+static void SwapNEON(uint8_t* data, size_t count)
+{
+	size_t bytes = count * N;
+	size_t i = 0;
+	for (; i + 16 <= bytes; i += 16)
+	{
+		uint8x16_t v = vld1q_u8(data + i);
+		if constexpr (N == 2)
+			v = vrev16q_u8(v);
+		else if constexpr (N == 4)
+			v = vrev32q_u8(v);
+		else
+			v = vrev64q_u8(v);
+		vst1q_u8(data + i, v);
+	}
+	SwapScalar<N>(data + i, (bytes - i) / N);
+}
+#endif
+
+
+template <size_t N>
+static void SwapElements(uint8_t* data, size_t count)
+{
+#if defined(ENDIAN_SIMD_X86)
+	static const X86SwapLevel level = DetectX86SwapLevel();
+	switch (level)
+	{
+		case X86SwapAVX2:
+			SwapAVX2<N>(data, count);
+			return;
+		case X86SwapSSSE3:
+			SwapSSSE3<N>(data, count);
+			return;
+		default:
+			SwapScalar<N>(data, count);
+			return;
+	}
+#elif defined(ENDIAN_SIMD_NEON)
+	SwapNEON<N>(data, count);
+#else
+	SwapScalar<N>(data, count);
+#endif
+}
+
+
+static bool IsHostEndianness(BNEndianness endian)
+{
+	return (ToLE16(1) == 1) == (endian == LittleEndian);
+}
+
+
+void BinaryNinja::ConvertEndianness(void* data, size_t count, size_t elementSize, BNEndianness endian)
+{
+	if (IsHostEndianness(endian))
+		return;
+
+	switch (elementSize)
+	{
+		case 2:
+			SwapElements<2>((uint8_t*)data, count);
+			break;
+		case 4:
+			SwapElements<4>((uint8_t*)data, count);
+			break;
+		case 8:
+			SwapElements<8>((uint8_t*)data, count);
+			break;
+		default:
+			break;
+	}
+}
+
+
+void BinaryNinja::ConvertStructEndianness(
+    void* data, size_t count, const std::vector<size_t>& fieldSizes, BNEndianness endian)
+{
+	if (IsHostEndianness(endian) || fieldSizes.empty())
+		return;
+
+	// Arrays of structures with uniformly sized fields are just arrays of that element size
+	size_t structSize = 0;
+	bool uniform = true;
+	for (size_t size : fieldSizes)
+	{
+		structSize += size;
+		uniform = uniform && (size == fieldSizes[0]);
+	}
+	if (uniform)
+	{
+		ConvertEndianness(data, count * fieldSizes.size(), fieldSizes[0], endian);
+		return;
+	}
+
+	uint8_t* cur = (uint8_t*)data;
+	for (size_t i = 0; i < count; i++)
+	{
+		for (size_t size : fieldSizes)
+		{
+			switch (size)
+			{
+				case 2:
+					SwapScalar<2>(cur, 1);
+					break;
+				case 4:
+					SwapScalar<4>(cur, 1);
+					break;
+				case 8:
+					SwapScalar<8>(cur, 1);
+					break;
+				default:
+					break;
+			}
+			cur += size;
+		}
+	}
+}
@@ -108,7 +108,7 @@ const vector<DisassemblyTextLine>& FlowGraphNode::GetLines()
 		line.highlight = lines[i].highlight;
 		line.tokens = InstructionTextToken::ConvertInstructionTextTokenList(lines[i].tokens, lines[i].count);
 		line.tags = Tag::ConvertTagList(lines[i].tags, lines[i].tagCount);
-		result.push_back(line);
+		result.push_back(std::move(line));
 	}
 
 	BNFreeDisassemblyTextLines(lines, count);
@@ -125,7 +125,7 @@ void FlowGraphNode::SetLines(const vector<DisassemblyTextLine>& lines)
 		buf[i].addr = lines[i].addr;
 		buf[i].instrIndex = lines[i].instrIndex;
 		buf[i].highlight = lines[i].highlight;
-		buf[i].tokens = InstructionTextToken::CreateInstructionTextTokenList(lines[i].tokens);
+		buf[i].tokens = InstructionTextToken::CreateInstructionTextTokenArena(lines[i].tokens);
 		buf[i].count = lines[i].tokens.size();
 		buf[i].tags = Tag::CreateTagList(lines[i].tags, &(buf[i].tagCount));
 	}
@@ -134,7 +134,7 @@ void FlowGraphNode::SetLines(const vector<DisassemblyTextLine>& lines)
 
 	for (size_t i = 0; i < lines.size(); i++)
 	{
-		InstructionTextToken::FreeInstructionTextTokenList(buf[i].tokens, buf[i].count);
+		InstructionTextToken::FreeInstructionTextTokenArena(buf[i].tokens);
 		Tag::FreeTagList(buf[i].tags, buf[i].tagCount);
 	}
 	delete[] buf;
@@ -217,6 +217,63 @@ size_t HighLevelILFunction::GetExprCount() const
 }
 
 
+HighLevelILExprSnapshot HighLevelILFunction::GetExprSnapshot(bool asFullAst)
+{
+	return HighLevelILExprSnapshot(this, asFullAst);
+}
+
+
+HighLevelILExprSnapshot::HighLevelILExprSnapshot(HighLevelILFunction* func, bool asFullAst) :
+    m_function(func), m_asFullAst(asFullAst)
+{
+	size_t count = func->GetExprCount();
+	m_operations.resize(count);
+	m_attributes.resize(count);
+	m_sizes.resize(count);
+	m_sourceOperands.resize(count);
+	m_addresses.resize(count);
+	m_parents.resize(count);
+	for (auto& operands : m_operands)
+		operands.resize(count);
+
+	for (size_t i = 0; i < count; i++)
+	{
+		BNHighLevelILInstruction instr = asFullAst ? func->GetRawExpr(i) : func->GetRawNonASTExpr(i);
+		m_operations[i] = instr.operation;
+		m_attributes[i] = instr.attributes;
+		m_sizes[i] = instr.size;
+		m_sourceOperands[i] = instr.sourceOperand;
+		m_addresses[i] = instr.address;
+		m_parents[i] = instr.parent;
+		for (size_t j = 0; j < 5; j++)
+			m_operands[j][i] = instr.operands[j];
+	}
+}
+
+
+BNHighLevelILInstruction HighLevelILSnapshotExpr::GetRawExpr() const
+{
+	BNHighLevelILInstruction result;
+	result.operation = GetOperation();
+	result.attributes = GetAttributes();
+	result.size = GetSize();
+	result.sourceOperand = GetSourceOperand();
+	result.address = GetAddress();
+	result.parent = GetParent();
+	for (size_t i = 0; i < 5; i++)
+		result.operands[i] = GetRawOperand(i);
+	return result;
+}
+
+
+HighLevelILInstruction HighLevelILSnapshotExpr::GetInstruction() const
+{
+	HighLevelILFunction* func = m_snapshot->GetFunction();
+	return HighLevelILInstruction(
+	    func, GetRawExpr(), m_exprIndex, m_snapshot->IsFullAst(), func->GetInstructionForExpr(m_exprIndex));
+}
+
+
 vector<Ref<BasicBlock>> HighLevelILFunction::GetBasicBlocks() const
 {
 	size_t count;
@@ -37,203 +37,54 @@ using namespace std;
 #endif
 
 
-unordered_map<HighLevelILOperandUsage, HighLevelILOperandType> HighLevelILInstructionBase::operandTypeForUsage = {
-    {SourceExprHighLevelOperandUsage, ExprHighLevelOperand},
-    {VariableHighLevelOperandUsage, VariableHighLevelOperand},
-    {DestVariableHighLevelOperandUsage, VariableHighLevelOperand},
-    {SSAVariableHighLevelOperandUsage, SSAVariableHighLevelOperand},
-    {DestSSAVariableHighLevelOperandUsage, SSAVariableHighLevelOperand},
-    {DestExprHighLevelOperandUsage, ExprHighLevelOperand},
-    {LeftExprHighLevelOperandUsage, ExprHighLevelOperand},
-    {RightExprHighLevelOperandUsage, ExprHighLevelOperand},
-    {CarryExprHighLevelOperandUsage, ExprHighLevelOperand},
-    {IndexExprHighLevelOperandUsage, ExprHighLevelOperand},
-    {ConditionExprHighLevelOperandUsage, ExprHighLevelOperand},
-    {ConditionPhiExprHighLevelOperandUsage, ExprHighLevelOperand},
-    {TrueExprHighLevelOperandUsage, ExprHighLevelOperand},
-    {FalseExprHighLevelOperandUsage, ExprHighLevelOperand},
-    {LoopExprHighLevelOperandUsage, ExprHighLevelOperand},
-    {InitExprHighLevelOperandUsage, ExprHighLevelOperand},
-    {UpdateExprHighLevelOperandUsage, ExprHighLevelOperand},
-    {DefaultExprHighLevelOperandUsage, ExprHighLevelOperand},
-    {HighExprHighLevelOperandUsage, ExprHighLevelOperand},
-    {LowExprHighLevelOperandUsage, ExprHighLevelOperand},
-    {OffsetHighLevelOperandUsage, IntegerHighLevelOperand},
-    {MemberIndexHighLevelOperandUsage, IndexHighLevelOperand},
-    {ConstantHighLevelOperandUsage, IntegerHighLevelOperand},
-    {ConstantDataHighLevelOperandUsage, ConstantDataHighLevelOperand},
-    {VectorHighLevelOperandUsage, IntegerHighLevelOperand},
-    {IntrinsicHighLevelOperandUsage, IntrinsicHighLevelOperand},
-    {TargetHighLevelOperandUsage, IndexHighLevelOperand},
-    {ParameterExprsHighLevelOperandUsage, ExprListHighLevelOperand},
-    {SourceExprsHighLevelOperandUsage, ExprListHighLevelOperand},
-    {DestExprsHighLevelOperandUsage, ExprListHighLevelOperand},
-    {BlockExprsHighLevelOperandUsage, ExprListHighLevelOperand},
-    {CasesHighLevelOperandUsage, ExprListHighLevelOperand},
-    {ValueExprsHighLevelOperandUsage, ExprListHighLevelOperand},
-    {SourceSSAVariablesHighLevelOperandUsage, SSAVariableListHighLevelOperand},
-    {SourceMemoryVersionHighLevelOperandUsage, IndexHighLevelOperand},
-    {SourceMemoryVersionsHighLevelOperandUsage, IndexListHighLevelOperand},
-    {DestMemoryVersionHighLevelOperandUsage, IndexHighLevelOperand}};
-
-
-unordered_map<BNHighLevelILOperation, vector<HighLevelILOperandUsage>>
-    HighLevelILInstructionBase::operationOperandUsage = {{HLIL_NOP, {}}, {HLIL_BREAK, {}}, {HLIL_CONTINUE, {}},
-        {HLIL_NORET, {}}, {HLIL_BP, {}}, {HLIL_UNDEF, {}}, {HLIL_UNIMPL, {}}, {HLIL_UNREACHABLE, {}},
-        {HLIL_BLOCK, {BlockExprsHighLevelOperandUsage}},
-        {HLIL_IF, {ConditionExprHighLevelOperandUsage, TrueExprHighLevelOperandUsage, FalseExprHighLevelOperandUsage}},
-        {HLIL_WHILE, {ConditionExprHighLevelOperandUsage, LoopExprHighLevelOperandUsage}},
-        {HLIL_WHILE_SSA,
-            {ConditionPhiExprHighLevelOperandUsage, ConditionExprHighLevelOperandUsage, LoopExprHighLevelOperandUsage}},
-        {HLIL_DO_WHILE, {LoopExprHighLevelOperandUsage, ConditionExprHighLevelOperandUsage}},
-        {HLIL_DO_WHILE_SSA,
-            {LoopExprHighLevelOperandUsage, ConditionPhiExprHighLevelOperandUsage, ConditionExprHighLevelOperandUsage}},
-        {HLIL_FOR, {InitExprHighLevelOperandUsage, ConditionExprHighLevelOperandUsage, UpdateExprHighLevelOperandUsage,
-                       LoopExprHighLevelOperandUsage}},
-        {HLIL_FOR_SSA,
-            {InitExprHighLevelOperandUsage, ConditionPhiExprHighLevelOperandUsage, ConditionExprHighLevelOperandUsage,
-                UpdateExprHighLevelOperandUsage, LoopExprHighLevelOperandUsage}},
-        {HLIL_SWITCH,
-            {ConditionExprHighLevelOperandUsage, DefaultExprHighLevelOperandUsage, CasesHighLevelOperandUsage}},
-        {HLIL_CASE, {ValueExprsHighLevelOperandUsage, TrueExprHighLevelOperandUsage}},
-        {HLIL_JUMP, {DestExprHighLevelOperandUsage}}, {HLIL_RET, {SourceExprsHighLevelOperandUsage}},
-        {HLIL_GOTO, {TargetHighLevelOperandUsage}}, {HLIL_LABEL, {TargetHighLevelOperandUsage}},
-        {HLIL_VAR_DECLARE, {VariableHighLevelOperandUsage}},
-        {HLIL_VAR_INIT, {DestVariableHighLevelOperandUsage, SourceExprHighLevelOperandUsage}},
-        {HLIL_VAR_INIT_SSA, {DestSSAVariableHighLevelOperandUsage, SourceExprHighLevelOperandUsage}},
-        {HLIL_ASSIGN, {DestExprHighLevelOperandUsage, SourceExprHighLevelOperandUsage}},
-        {HLIL_ASSIGN_UNPACK, {DestExprsHighLevelOperandUsage, SourceExprHighLevelOperandUsage}},
-        {HLIL_ASSIGN_MEM_SSA, {DestExprHighLevelOperandUsage, DestMemoryVersionHighLevelOperandUsage,
-                                  SourceExprHighLevelOperandUsage, SourceMemoryVersionHighLevelOperandUsage}},
-        {HLIL_ASSIGN_UNPACK_MEM_SSA, {DestExprsHighLevelOperandUsage, DestMemoryVersionHighLevelOperandUsage,
-                                 SourceExprHighLevelOperandUsage, SourceMemoryVersionHighLevelOperandUsage}},
-        {HLIL_VAR, {VariableHighLevelOperandUsage}}, {HLIL_VAR_SSA, {SSAVariableHighLevelOperandUsage}},
-        {HLIL_VAR_PHI, {DestSSAVariableHighLevelOperandUsage, SourceSSAVariablesHighLevelOperandUsage}},
-        {HLIL_MEM_PHI, {DestMemoryVersionHighLevelOperandUsage, SourceMemoryVersionsHighLevelOperandUsage}},
-        {HLIL_STRUCT_FIELD,
-            {SourceExprHighLevelOperandUsage, OffsetHighLevelOperandUsage, MemberIndexHighLevelOperandUsage}},
-        {HLIL_ARRAY_INDEX, {SourceExprHighLevelOperandUsage, IndexExprHighLevelOperandUsage}},
-        {HLIL_ARRAY_INDEX_SSA, {SourceExprHighLevelOperandUsage, SourceMemoryVersionHighLevelOperandUsage,
-                                   IndexExprHighLevelOperandUsage}},
-        {HLIL_SPLIT, {HighExprHighLevelOperandUsage, LowExprHighLevelOperandUsage}},
-        {HLIL_DEREF, {SourceExprHighLevelOperandUsage}},
-        {HLIL_DEREF_FIELD,
-            {SourceExprHighLevelOperandUsage, OffsetHighLevelOperandUsage, MemberIndexHighLevelOperandUsage}},
-        {HLIL_DEREF_SSA, {SourceExprHighLevelOperandUsage, SourceMemoryVersionHighLevelOperandUsage}},
-        {HLIL_DEREF_FIELD_SSA, {SourceExprHighLevelOperandUsage, SourceMemoryVersionHighLevelOperandUsage,
-                                   OffsetHighLevelOperandUsage, MemberIndexHighLevelOperandUsage}},
-        {HLIL_ADDRESS_OF, {SourceExprHighLevelOperandUsage}},
-        {HLIL_CALL, {DestExprHighLevelOperandUsage, ParameterExprsHighLevelOperandUsage}},
-        {HLIL_SYSCALL, {ParameterExprsHighLevelOperandUsage}},
-        {HLIL_TAILCALL, {DestExprHighLevelOperandUsage, ParameterExprsHighLevelOperandUsage}},
-        {HLIL_INTRINSIC, {IntrinsicHighLevelOperandUsage, ParameterExprsHighLevelOperandUsage}},
-        {HLIL_CALL_SSA, {DestExprHighLevelOperandUsage, ParameterExprsHighLevelOperandUsage,
-                            DestMemoryVersionHighLevelOperandUsage, SourceMemoryVersionHighLevelOperandUsage}},
-        {HLIL_SYSCALL_SSA, {ParameterExprsHighLevelOperandUsage, DestMemoryVersionHighLevelOperandUsage,
-                               SourceMemoryVersionHighLevelOperandUsage}},
-        {HLIL_INTRINSIC_SSA, {IntrinsicHighLevelOperandUsage, ParameterExprsHighLevelOperandUsage,
-                                 DestMemoryVersionHighLevelOperandUsage, SourceMemoryVersionHighLevelOperandUsage}},
-        {HLIL_TRAP, {VectorHighLevelOperandUsage}},
-        {HLIL_CONST, {ConstantHighLevelOperandUsage}},
-        {HLIL_CONST_PTR, {ConstantHighLevelOperandUsage}},
-        {HLIL_EXTERN_PTR, {ConstantHighLevelOperandUsage, OffsetHighLevelOperandUsage}},
-        {HLIL_FLOAT_CONST, {ConstantHighLevelOperandUsage}}, {HLIL_IMPORT, {ConstantHighLevelOperandUsage}},
-        {HLIL_CONST_DATA, {ConstantDataHighLevelOperandUsage}},
-        {HLIL_ADD, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_SUB, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_AND, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_OR, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_XOR, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_LSL, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_LSR, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_ASR, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_ROL, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_ROR, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_MUL, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_MULU_DP, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_MULS_DP, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_DIVU, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_DIVS, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_MODU, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_MODS, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_CMP_E, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_CMP_NE, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_CMP_SLT, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_CMP_ULT, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_CMP_SLE, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_CMP_ULE, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_CMP_SGE, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_CMP_UGE, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_CMP_SGT, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_CMP_UGT, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_TEST_BIT, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_ADD_OVERFLOW, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_ADC, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage, CarryExprHighLevelOperandUsage}},
-        {HLIL_SBB, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage, CarryExprHighLevelOperandUsage}},
-        {HLIL_RLC, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage, CarryExprHighLevelOperandUsage}},
-        {HLIL_RRC, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage, CarryExprHighLevelOperandUsage}},
-        {HLIL_DIVU_DP, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_DIVS_DP, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_MODU_DP, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_MODS_DP, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_NEG, {SourceExprHighLevelOperandUsage}}, {HLIL_NOT, {SourceExprHighLevelOperandUsage}},
-        {HLIL_SX, {SourceExprHighLevelOperandUsage}}, {HLIL_ZX, {SourceExprHighLevelOperandUsage}},
-        {HLIL_LOW_PART, {SourceExprHighLevelOperandUsage}}, {HLIL_BOOL_TO_INT, {SourceExprHighLevelOperandUsage}},
-        {HLIL_UNIMPL_MEM, {SourceExprHighLevelOperandUsage}},
-        {HLIL_FADD, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_FSUB, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_FMUL, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_FDIV, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_FSQRT, {SourceExprHighLevelOperandUsage}}, {HLIL_FNEG, {SourceExprHighLevelOperandUsage}},
-        {HLIL_FABS, {SourceExprHighLevelOperandUsage}}, {HLIL_FLOAT_TO_INT, {SourceExprHighLevelOperandUsage}},
-        {HLIL_INT_TO_FLOAT, {SourceExprHighLevelOperandUsage}}, {HLIL_FLOAT_CONV, {SourceExprHighLevelOperandUsage}},
-        {HLIL_ROUND_TO_INT, {SourceExprHighLevelOperandUsage}}, {HLIL_FLOOR, {SourceExprHighLevelOperandUsage}},
-        {HLIL_CEIL, {SourceExprHighLevelOperandUsage}}, {HLIL_FTRUNC, {SourceExprHighLevelOperandUsage}},
-        {HLIL_FCMP_E, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_FCMP_NE, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_FCMP_LT, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_FCMP_LE, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_FCMP_GE, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_FCMP_GT, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_FCMP_O, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
-        {HLIL_FCMP_UO, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}}};
+static unordered_map<HighLevelILOperandUsage, HighLevelILOperandType> GetOperandTypeForUsages()
+{
+	unordered_map<HighLevelILOperandUsage, HighLevelILOperandType> result;
+	result.reserve(sizeof(HighLevelILOperandTypeForUsage) / sizeof(HighLevelILOperandTypeForUsage[0]));
+	for (auto& i : HighLevelILOperandTypeForUsage)
+		result[i.usage] = i.type;
+	return result;
+}
+
+
+static unordered_map<BNHighLevelILOperation, vector<HighLevelILOperandUsage>> GetOperationOperandUsages()
+{
+	unordered_map<BNHighLevelILOperation, vector<HighLevelILOperandUsage>> result;
+	result.reserve(sizeof(HighLevelILOperationOperandUsage) / sizeof(HighLevelILOperationOperandUsage[0]));
+	for (auto& i : HighLevelILOperationOperandUsage)
+		result[i.operation] = vector<HighLevelILOperandUsage>(i.usages);
+	return result;
+}
 
 
 static unordered_map<BNHighLevelILOperation, unordered_map<HighLevelILOperandUsage, size_t>>
     GetOperandIndexForOperandUsages()
 {
 	unordered_map<BNHighLevelILOperation, unordered_map<HighLevelILOperandUsage, size_t>> result;
-	result.reserve(HighLevelILInstructionBase::operationOperandUsage.size());
-	for (auto& operation : HighLevelILInstructionBase::operationOperandUsage)
+	result.reserve(sizeof(HighLevelILOperationOperandUsage) / sizeof(HighLevelILOperationOperandUsage[0]));
+	for (auto& i : HighLevelILOperationOperandUsage)
 	{
-		result[operation.first] = unordered_map<HighLevelILOperandUsage, size_t>();
-		result[operation.first].reserve(operation.second.size());
-		size_t operand = 0;
-		for (auto usage : operation.second)
-		{
-			result[operation.first][usage] = operand;
-			switch (HighLevelILInstructionBase::operandTypeForUsage[usage])
-			{
-			case SSAVariableHighLevelOperand:
-			case SSAVariableListHighLevelOperand:
-			case ExprListHighLevelOperand:
-			case IndexListHighLevelOperand:
-				// SSA variables and lists take two operand slots
-				operand += 2;
-				break;
-			default:
-				operand++;
-				break;
-			}
-		}
+		auto& operandIndex = result[i.operation];
+		operandIndex.reserve(i.usages.size());
+		for (auto usage : i.usages)
+			operandIndex[usage] = GetHighLevelILOperandIndex(i.operation, usage);
 	}
 	return result;
 }
 
 
+unordered_map<HighLevelILOperandUsage, HighLevelILOperandType> HighLevelILInstructionBase::operandTypeForUsage = GetOperandTypeForUsages();
+unordered_map<BNHighLevelILOperation, vector<HighLevelILOperandUsage>> HighLevelILInstructionBase::operationOperandUsage =
+    GetOperationOperandUsages();
+
+
 unordered_map<BNHighLevelILOperation, unordered_map<HighLevelILOperandUsage, size_t>>
     HighLevelILInstructionBase::operationOperandIndex = GetOperandIndexForOperandUsages();
 
+// The dense tables must agree with the operand layout used by the templated accessors
+static_assert(GetHighLevelILOperandIndex(HLIL_FOR_SSA, ConditionExprHighLevelOperandUsage) == 2);
+static_assert(GetHighLevelILOperandIndex(HLIL_FOR_SSA, LoopExprHighLevelOperandUsage) == 4);
+
 
 bool HighLevelILIntegerList::ListIterator::operator==(const ListIterator& a) const
 {
@@ -509,10 +360,9 @@ HighLevelILOperand::HighLevelILOperand(
     m_instr(instr),
     m_usage(usage), m_operandIndex(operandIndex)
 {
-	auto i = HighLevelILInstructionBase::operandTypeForUsage.find(m_usage);
-	if (i == HighLevelILInstructionBase::operandTypeForUsage.end())
+	if (((size_t)m_usage >= HighLevelILOperandUsageCount) || (HighLevelILOperandTable.operandType[m_usage] == HighLevelILInvalidOperandType))
 		throw HighLevelILInstructionAccessException();
-	m_type = i->second;
+	m_type = (HighLevelILOperandType)HighLevelILOperandTable.operandType[m_usage];
 }
 
 
@@ -1039,249 +889,11 @@ HighLevelILInstruction HighLevelILInstructionBase::GetParent() const
 
 void HighLevelILInstruction::CollectSubExprs(stack<size_t>& toProcess) const
 {
-	vector<HighLevelILInstruction> exprs;
-	switch (operation)
-	{
-	case HLIL_BLOCK:
-		exprs = GetBlockExprs<HLIL_BLOCK>();
-		for (auto i = exprs.rbegin(); i != exprs.rend(); ++i)
-			toProcess.push(i->exprIndex);
-		break;
-	case HLIL_IF:
-		if (ast)
-		{
-			toProcess.push(GetFalseExpr<HLIL_IF>().exprIndex);
-			toProcess.push(GetTrueExpr<HLIL_IF>().exprIndex);
-		}
-		toProcess.push(GetConditionExpr<HLIL_IF>().exprIndex);
-		break;
-	case HLIL_WHILE:
-		if (ast)
-			toProcess.push(GetLoopExpr<HLIL_WHILE>().exprIndex);
-		toProcess.push(GetConditionExpr<HLIL_WHILE>().exprIndex);
-		break;
-	case HLIL_WHILE_SSA:
-		if (ast)
-			toProcess.push(GetLoopExpr<HLIL_WHILE_SSA>().exprIndex);
-		toProcess.push(GetConditionExpr<HLIL_WHILE_SSA>().exprIndex);
-		toProcess.push(GetConditionPhiExpr<HLIL_WHILE_SSA>().exprIndex);
-		break;
-	case HLIL_DO_WHILE:
-		toProcess.push(GetConditionExpr<HLIL_DO_WHILE>().exprIndex);
-		if (ast)
-			toProcess.push(GetLoopExpr<HLIL_DO_WHILE>().exprIndex);
-		break;
-	case HLIL_DO_WHILE_SSA:
-		toProcess.push(GetConditionExpr<HLIL_DO_WHILE_SSA>().exprIndex);
-		toProcess.push(GetConditionPhiExpr<HLIL_DO_WHILE_SSA>().exprIndex);
-		if (ast)
-			toProcess.push(GetLoopExpr<HLIL_DO_WHILE_SSA>().exprIndex);
-		break;
-	case HLIL_FOR:
-		if (ast)
-			toProcess.push(GetLoopExpr<HLIL_FOR>().exprIndex);
-		toProcess.push(GetUpdateExpr<HLIL_FOR>().exprIndex);
-		toProcess.push(GetConditionExpr<HLIL_FOR>().exprIndex);
-		toProcess.push(GetInitExpr<HLIL_FOR>().exprIndex);
-		break;
-	case HLIL_FOR_SSA:
-		if (ast)
-			toProcess.push(GetLoopExpr<HLIL_FOR_SSA>().exprIndex);
-		toProcess.push(GetUpdateExpr<HLIL_FOR_SSA>().exprIndex);
-		toProcess.push(GetConditionExpr<HLIL_FOR_SSA>().exprIndex);
-		toProcess.push(GetConditionPhiExpr<HLIL_FOR_SSA>().exprIndex);
-		toProcess.push(GetInitExpr<HLIL_FOR_SSA>().exprIndex);
-		break;
-	case HLIL_SWITCH:
-		if (ast)
-		{
-			exprs = GetCases<HLIL_SWITCH>();
-			for (auto i = exprs.rbegin(); i != exprs.rend(); ++i)
-				toProcess.push(i->exprIndex);
-			toProcess.push(GetDefaultExpr<HLIL_SWITCH>().exprIndex);
-		}
-		toProcess.push(GetConditionExpr<HLIL_SWITCH>().exprIndex);
-		break;
-	case HLIL_CASE:
-		toProcess.push(GetTrueExpr<HLIL_CASE>().exprIndex);
-		exprs = GetValueExprs<HLIL_CASE>();
-		for (auto i = exprs.rbegin(); i != exprs.rend(); ++i)
-			toProcess.push(i->exprIndex);
-		break;
-	case HLIL_VAR_INIT:
-		toProcess.push(GetSourceExpr<HLIL_VAR_INIT>().exprIndex);
-		break;
-	case HLIL_VAR_INIT_SSA:
-		toProcess.push(GetSourceExpr<HLIL_VAR_INIT_SSA>().exprIndex);
-		break;
-	case HLIL_ASSIGN:
-		toProcess.push(GetDestExpr<HLIL_ASSIGN>().exprIndex);
-		toProcess.push(GetSourceExpr<HLIL_ASSIGN>().exprIndex);
-		break;
-	case HLIL_ASSIGN_UNPACK:
-		exprs = GetDestExprs<HLIL_ASSIGN_UNPACK>();
-		for (auto i = exprs.rbegin(); i != exprs.rend(); ++i)
-			toProcess.push(i->exprIndex);
-		toProcess.push(GetSourceExpr<HLIL_ASSIGN_UNPACK>().exprIndex);
-		break;
-	case HLIL_ASSIGN_MEM_SSA:
-		toProcess.push(GetDestExpr<HLIL_ASSIGN_MEM_SSA>().exprIndex);
-		toProcess.push(GetSourceExpr<HLIL_ASSIGN_MEM_SSA>().exprIndex);
-		break;
-	case HLIL_ASSIGN_UNPACK_MEM_SSA:
-		exprs = GetDestExprs<HLIL_ASSIGN_UNPACK_MEM_SSA>();
-		for (auto i = exprs.rbegin(); i != exprs.rend(); ++i)
-			toProcess.push(i->exprIndex);
-		toProcess.push(GetSourceExpr<HLIL_ASSIGN_UNPACK_MEM_SSA>().exprIndex);
-		break;
-	case HLIL_STRUCT_FIELD:
-		toProcess.push(GetSourceExpr<HLIL_STRUCT_FIELD>().exprIndex);
-		break;
-	case HLIL_ARRAY_INDEX:
-		toProcess.push(GetSourceExpr<HLIL_ARRAY_INDEX>().exprIndex);
-		toProcess.push(GetIndexExpr<HLIL_ARRAY_INDEX>().exprIndex);
-		break;
-	case HLIL_ARRAY_INDEX_SSA:
-		toProcess.push(GetSourceExpr<HLIL_ARRAY_INDEX_SSA>().exprIndex);
-		toProcess.push(GetIndexExpr<HLIL_ARRAY_INDEX_SSA>().exprIndex);
-		break;
-	case HLIL_SPLIT:
-		toProcess.push(GetLowExpr<HLIL_SPLIT>().exprIndex);
-		toProcess.push(GetHighExpr<HLIL_SPLIT>().exprIndex);
-		break;
-	case HLIL_DEREF_FIELD:
-		toProcess.push(GetSourceExpr<HLIL_DEREF_FIELD>().exprIndex);
-		break;
-	case HLIL_DEREF_SSA:
-		toProcess.push(GetSourceExpr<HLIL_DEREF_SSA>().exprIndex);
-		break;
-	case HLIL_DEREF_FIELD_SSA:
-		toProcess.push(GetSourceExpr<HLIL_DEREF_FIELD_SSA>().exprIndex);
-		break;
-	case HLIL_CALL:
-		toProcess.push(GetDestExpr<HLIL_CALL>().exprIndex);
-		exprs = GetParameterExprs<HLIL_CALL>();
-		for (auto i = exprs.rbegin(); i != exprs.rend(); ++i)
-			toProcess.push(i->exprIndex);
-		break;
-	case HLIL_SYSCALL:
-		exprs = GetParameterExprs<HLIL_SYSCALL>();
-		for (auto i = exprs.rbegin(); i != exprs.rend(); ++i)
-			toProcess.push(i->exprIndex);
-		break;
-	case HLIL_TAILCALL:
-		toProcess.push(GetDestExpr<HLIL_TAILCALL>().exprIndex);
-		exprs = GetParameterExprs<HLIL_TAILCALL>();
-		for (auto i = exprs.rbegin(); i != exprs.rend(); ++i)
-			toProcess.push(i->exprIndex);
-		break;
-	case HLIL_CALL_SSA:
-		toProcess.push(GetDestExpr<HLIL_CALL_SSA>().exprIndex);
-		exprs = GetParameterExprs<HLIL_CALL_SSA>();
-		for (auto i = exprs.rbegin(); i != exprs.rend(); ++i)
-			toProcess.push(i->exprIndex);
-		break;
-	case HLIL_SYSCALL_SSA:
-		exprs = GetParameterExprs<HLIL_SYSCALL_SSA>();
-		for (auto i = exprs.rbegin(); i != exprs.rend(); ++i)
-			toProcess.push(i->exprIndex);
-		break;
-	case HLIL_RET:
-		exprs = GetSourceExprs<HLIL_RET>();
-		for (auto i = exprs.rbegin(); i != exprs.rend(); ++i)
-			toProcess.push(i->exprIndex);
-		break;
-	case HLIL_DEREF:
-	case HLIL_ADDRESS_OF:
-	case HLIL_NEG:
-	case HLIL_NOT:
-	case HLIL_SX:
-	case HLIL_ZX:
-	case HLIL_LOW_PART:
-	case HLIL_BOOL_TO_INT:
-	case HLIL_JUMP:
-	case HLIL_UNIMPL_MEM:
-	case HLIL_FSQRT:
-	case HLIL_FNEG:
-	case HLIL_FABS:
-	case HLIL_FLOAT_TO_INT:
-	case HLIL_INT_TO_FLOAT:
-	case HLIL_FLOAT_CONV:
-	case HLIL_ROUND_TO_INT:
-	case HLIL_FLOOR:
-	case HLIL_CEIL:
-	case HLIL_FTRUNC:
-		toProcess.push(AsOneOperand().GetSourceExpr().exprIndex);
-		break;
-	case HLIL_ADD:
-	case HLIL_SUB:
-	case HLIL_AND:
-	case HLIL_OR:
-	case HLIL_XOR:
-	case HLIL_LSL:
-	case HLIL_LSR:
-	case HLIL_ASR:
-	case HLIL_ROL:
-	case HLIL_ROR:
-	case HLIL_MUL:
-	case HLIL_MULU_DP:
-	case HLIL_MULS_DP:
-	case HLIL_DIVU:
-	case HLIL_DIVS:
-	case HLIL_MODU:
-	case HLIL_MODS:
-	case HLIL_DIVU_DP:
-	case HLIL_DIVS_DP:
-	case HLIL_MODU_DP:
-	case HLIL_MODS_DP:
-	case HLIL_CMP_E:
-	case HLIL_CMP_NE:
-	case HLIL_CMP_SLT:
-	case HLIL_CMP_ULT:
-	case HLIL_CMP_SLE:
-	case HLIL_CMP_ULE:
-	case HLIL_CMP_SGE:
-	case HLIL_CMP_UGE:
-	case HLIL_CMP_SGT:
-	case HLIL_CMP_UGT:
-	case HLIL_TEST_BIT:
-	case HLIL_ADD_OVERFLOW:
-	case HLIL_FADD:
-	case HLIL_FSUB:
-	case HLIL_FMUL:
-	case HLIL_FDIV:
-	case HLIL_FCMP_E:
-	case HLIL_FCMP_NE:
-	case HLIL_FCMP_LT:
-	case HLIL_FCMP_LE:
-	case HLIL_FCMP_GE:
-	case HLIL_FCMP_GT:
-	case HLIL_FCMP_O:
-	case HLIL_FCMP_UO:
-		toProcess.push(AsTwoOperand().GetRightExpr().exprIndex);
-		toProcess.push(AsTwoOperand().GetLeftExpr().exprIndex);
-		break;
-	case HLIL_ADC:
-	case HLIL_SBB:
-	case HLIL_RLC:
-	case HLIL_RRC:
-		toProcess.push(AsTwoOperandWithCarry().GetCarryExpr().exprIndex);
-		toProcess.push(AsTwoOperandWithCarry().GetRightExpr().exprIndex);
-		toProcess.push(AsTwoOperandWithCarry().GetLeftExpr().exprIndex);
-		break;
-	case HLIL_INTRINSIC:
-		exprs = GetParameterExprs<HLIL_INTRINSIC>();
-		for (auto i = exprs.rbegin(); i != exprs.rend(); ++i)
-			toProcess.push(i->exprIndex);
-		break;
-	case HLIL_INTRINSIC_SSA:
-		exprs = GetParameterExprs<HLIL_INTRINSIC_SSA>();
-		for (auto i = exprs.rbegin(); i != exprs.rend(); ++i)
-			toProcess.push(i->exprIndex);
-		break;
-	default:
-		break;
-	}
+	// Pushed in reverse so that the sub-expressions are popped in visit order
+	ILWalkStack<size_t, 16> subExprs;
+	ForEachSubExpr([&](const HighLevelILInstruction& subExpr) { subExprs.push(subExpr.exprIndex); });
+	while (!subExprs.empty())
+		toProcess.push(subExprs.pop());
 }
 
 
@@ -2135,13 +1747,10 @@ bool HighLevelILInstruction::operator!=(const HighLevelILInstruction& other) con
 
 bool HighLevelILInstruction::GetOperandIndexForUsage(HighLevelILOperandUsage usage, size_t& operandIndex) const
 {
-	auto operationIter = HighLevelILInstructionBase::operationOperandIndex.find(operation);
-	if (operationIter == HighLevelILInstructionBase::operationOperandIndex.end())
-		return false;
-	auto usageIter = operationIter->second.find(usage);
-	if (usageIter == operationIter->second.end())
+	size_t index = GetHighLevelILOperandIndex(operation, usage);
+	if (index == HighLevelILInvalidOperandIndex)
 		return false;
-	operandIndex = usageIter->second;
+	operandIndex = index;
 	return true;
 }
 
@@ -21,6 +21,7 @@
 #pragma once
 
 #include <functional>
+#include <initializer_list>
 #include <unordered_map>
 #include <vector>
 #ifdef BINARYNINJACORE_LIBRARY
@@ -28,6 +29,7 @@
 #else
 	#include "binaryninjaapi.h"
 #endif
+#include "ilwalk.h"
 #include "mediumlevelilinstruction.h"
 #include <fmt/core.h>
 
@@ -118,6 +120,277 @@ namespace BinaryNinja
 		SourceMemoryVersionsHighLevelOperandUsage,
 		DestMemoryVersionHighLevelOperandUsage
 	};
+
+	/*!
+		\ingroup highlevelil
+	*/
+	struct HighLevelILOperandUsageType
+	{
+		HighLevelILOperandUsage usage;
+		HighLevelILOperandType type;
+	};
+
+	/*!
+		\ingroup highlevelil
+	*/
+	struct HighLevelILOperationOperandUsages
+	{
+		BNHighLevelILOperation operation;
+		std::initializer_list<HighLevelILOperandUsage> usages;
+	};
+
+	// Operand layout of every operation. The lookup maps in HighLevelILInstructionBase and the dense
+	// tables below are both derived from these.
+	inline constexpr HighLevelILOperandUsageType HighLevelILOperandTypeForUsage[] = {
+		{SourceExprHighLevelOperandUsage, ExprHighLevelOperand},
+		{VariableHighLevelOperandUsage, VariableHighLevelOperand},
+		{DestVariableHighLevelOperandUsage, VariableHighLevelOperand},
+		{SSAVariableHighLevelOperandUsage, SSAVariableHighLevelOperand},
+		{DestSSAVariableHighLevelOperandUsage, SSAVariableHighLevelOperand},
+		{DestExprHighLevelOperandUsage, ExprHighLevelOperand},
+		{LeftExprHighLevelOperandUsage, ExprHighLevelOperand},
+		{RightExprHighLevelOperandUsage, ExprHighLevelOperand},
+		{CarryExprHighLevelOperandUsage, ExprHighLevelOperand},
+		{IndexExprHighLevelOperandUsage, ExprHighLevelOperand},
+		{ConditionExprHighLevelOperandUsage, ExprHighLevelOperand},
+		{ConditionPhiExprHighLevelOperandUsage, ExprHighLevelOperand},
+		{TrueExprHighLevelOperandUsage, ExprHighLevelOperand},
+		{FalseExprHighLevelOperandUsage, ExprHighLevelOperand},
+		{LoopExprHighLevelOperandUsage, ExprHighLevelOperand},
+		{InitExprHighLevelOperandUsage, ExprHighLevelOperand},
+		{UpdateExprHighLevelOperandUsage, ExprHighLevelOperand},
+		{DefaultExprHighLevelOperandUsage, ExprHighLevelOperand},
+		{HighExprHighLevelOperandUsage, ExprHighLevelOperand},
+		{LowExprHighLevelOperandUsage, ExprHighLevelOperand},
+		{OffsetHighLevelOperandUsage, IntegerHighLevelOperand},
+		{MemberIndexHighLevelOperandUsage, IndexHighLevelOperand},
+		{ConstantHighLevelOperandUsage, IntegerHighLevelOperand},
+		{ConstantDataHighLevelOperandUsage, ConstantDataHighLevelOperand},
+		{VectorHighLevelOperandUsage, IntegerHighLevelOperand},
+		{IntrinsicHighLevelOperandUsage, IntrinsicHighLevelOperand},
+		{TargetHighLevelOperandUsage, IndexHighLevelOperand},
+		{ParameterExprsHighLevelOperandUsage, ExprListHighLevelOperand},
+		{SourceExprsHighLevelOperandUsage, ExprListHighLevelOperand},
+		{DestExprsHighLevelOperandUsage, ExprListHighLevelOperand},
+		{BlockExprsHighLevelOperandUsage, ExprListHighLevelOperand},
+		{CasesHighLevelOperandUsage, ExprListHighLevelOperand},
+		{ValueExprsHighLevelOperandUsage, ExprListHighLevelOperand},
+		{SourceSSAVariablesHighLevelOperandUsage, SSAVariableListHighLevelOperand},
+		{SourceMemoryVersionHighLevelOperandUsage, IndexHighLevelOperand},
+		{SourceMemoryVersionsHighLevelOperandUsage, IndexListHighLevelOperand},
+		{DestMemoryVersionHighLevelOperandUsage, IndexHighLevelOperand}
+	};
+
+	inline constexpr HighLevelILOperationOperandUsages HighLevelILOperationOperandUsage[] = {
+		{HLIL_NOP, {}},
+		{HLIL_BREAK, {}},
+		{HLIL_CONTINUE, {}},
+		{HLIL_NORET, {}},
+		{HLIL_BP, {}},
+		{HLIL_UNDEF, {}},
+		{HLIL_UNIMPL, {}},
+		{HLIL_UNREACHABLE, {}},
+		{HLIL_BLOCK, {BlockExprsHighLevelOperandUsage}},
+		{HLIL_IF, {ConditionExprHighLevelOperandUsage, TrueExprHighLevelOperandUsage, FalseExprHighLevelOperandUsage}},
+		{HLIL_WHILE, {ConditionExprHighLevelOperandUsage, LoopExprHighLevelOperandUsage}},
+		{HLIL_WHILE_SSA,
+			{ConditionPhiExprHighLevelOperandUsage, ConditionExprHighLevelOperandUsage, LoopExprHighLevelOperandUsage}},
+		{HLIL_DO_WHILE, {LoopExprHighLevelOperandUsage, ConditionExprHighLevelOperandUsage}},
+		{HLIL_DO_WHILE_SSA,
+			{LoopExprHighLevelOperandUsage, ConditionPhiExprHighLevelOperandUsage, ConditionExprHighLevelOperandUsage}},
+		{HLIL_FOR,
+			{InitExprHighLevelOperandUsage, ConditionExprHighLevelOperandUsage, UpdateExprHighLevelOperandUsage,
+				LoopExprHighLevelOperandUsage}},
+		{HLIL_FOR_SSA,
+			{InitExprHighLevelOperandUsage, ConditionPhiExprHighLevelOperandUsage,
+				ConditionExprHighLevelOperandUsage, UpdateExprHighLevelOperandUsage, LoopExprHighLevelOperandUsage}},
+		{HLIL_SWITCH,
+			{ConditionExprHighLevelOperandUsage, DefaultExprHighLevelOperandUsage, CasesHighLevelOperandUsage}},
+		{HLIL_CASE, {ValueExprsHighLevelOperandUsage, TrueExprHighLevelOperandUsage}},
+		{HLIL_JUMP, {DestExprHighLevelOperandUsage}},
+		{HLIL_RET, {SourceExprsHighLevelOperandUsage}},
+		{HLIL_GOTO, {TargetHighLevelOperandUsage}},
+		{HLIL_LABEL, {TargetHighLevelOperandUsage}},
+		{HLIL_VAR_DECLARE, {VariableHighLevelOperandUsage}},
+		{HLIL_VAR_INIT, {DestVariableHighLevelOperandUsage, SourceExprHighLevelOperandUsage}},
+		{HLIL_VAR_INIT_SSA, {DestSSAVariableHighLevelOperandUsage, SourceExprHighLevelOperandUsage}},
+		{HLIL_ASSIGN, {DestExprHighLevelOperandUsage, SourceExprHighLevelOperandUsage}},
+		{HLIL_ASSIGN_UNPACK, {DestExprsHighLevelOperandUsage, SourceExprHighLevelOperandUsage}},
+		{HLIL_ASSIGN_MEM_SSA,
+			{DestExprHighLevelOperandUsage, DestMemoryVersionHighLevelOperandUsage, SourceExprHighLevelOperandUsage,
+				SourceMemoryVersionHighLevelOperandUsage}},
+		{HLIL_ASSIGN_UNPACK_MEM_SSA,
+			{DestExprsHighLevelOperandUsage, DestMemoryVersionHighLevelOperandUsage, SourceExprHighLevelOperandUsage,
+				SourceMemoryVersionHighLevelOperandUsage}},
+		{HLIL_VAR, {VariableHighLevelOperandUsage}},
+		{HLIL_VAR_SSA, {SSAVariableHighLevelOperandUsage}},
+		{HLIL_VAR_PHI, {DestSSAVariableHighLevelOperandUsage, SourceSSAVariablesHighLevelOperandUsage}},
+		{HLIL_MEM_PHI, {DestMemoryVersionHighLevelOperandUsage, SourceMemoryVersionsHighLevelOperandUsage}},
+		{HLIL_STRUCT_FIELD,
+			{SourceExprHighLevelOperandUsage, OffsetHighLevelOperandUsage, MemberIndexHighLevelOperandUsage}},
+		{HLIL_ARRAY_INDEX, {SourceExprHighLevelOperandUsage, IndexExprHighLevelOperandUsage}},
+		{HLIL_ARRAY_INDEX_SSA,
+			{SourceExprHighLevelOperandUsage, SourceMemoryVersionHighLevelOperandUsage,
+				IndexExprHighLevelOperandUsage}},
+		{HLIL_SPLIT, {HighExprHighLevelOperandUsage, LowExprHighLevelOperandUsage}},
+		{HLIL_DEREF, {SourceExprHighLevelOperandUsage}},
+		{HLIL_DEREF_FIELD,
+			{SourceExprHighLevelOperandUsage, OffsetHighLevelOperandUsage, MemberIndexHighLevelOperandUsage}},
+		{HLIL_DEREF_SSA, {SourceExprHighLevelOperandUsage, SourceMemoryVersionHighLevelOperandUsage}},
+		{HLIL_DEREF_FIELD_SSA,
+			{SourceExprHighLevelOperandUsage, SourceMemoryVersionHighLevelOperandUsage, OffsetHighLevelOperandUsage,
+				MemberIndexHighLevelOperandUsage}},
+		{HLIL_ADDRESS_OF, {SourceExprHighLevelOperandUsage}},
+		{HLIL_CALL, {DestExprHighLevelOperandUsage, ParameterExprsHighLevelOperandUsage}},
+		{HLIL_SYSCALL, {ParameterExprsHighLevelOperandUsage}},
+		{HLIL_TAILCALL, {DestExprHighLevelOperandUsage, ParameterExprsHighLevelOperandUsage}},
+		{HLIL_INTRINSIC, {IntrinsicHighLevelOperandUsage, ParameterExprsHighLevelOperandUsage}},
+		{HLIL_CALL_SSA,
+			{DestExprHighLevelOperandUsage, ParameterExprsHighLevelOperandUsage,
+				DestMemoryVersionHighLevelOperandUsage, SourceMemoryVersionHighLevelOperandUsage}},
+		{HLIL_SYSCALL_SSA,
+			{ParameterExprsHighLevelOperandUsage, DestMemoryVersionHighLevelOperandUsage,
+				SourceMemoryVersionHighLevelOperandUsage}},
+		{HLIL_INTRINSIC_SSA,
+			{IntrinsicHighLevelOperandUsage, ParameterExprsHighLevelOperandUsage,
+				DestMemoryVersionHighLevelOperandUsage, SourceMemoryVersionHighLevelOperandUsage}},
+		{HLIL_TRAP, {VectorHighLevelOperandUsage}},
+		{HLIL_CONST, {ConstantHighLevelOperandUsage}},
+		{HLIL_CONST_PTR, {ConstantHighLevelOperandUsage}},
+		{HLIL_EXTERN_PTR, {ConstantHighLevelOperandUsage, OffsetHighLevelOperandUsage}},
+		{HLIL_FLOAT_CONST, {ConstantHighLevelOperandUsage}},
+		{HLIL_IMPORT, {ConstantHighLevelOperandUsage}},
+		{HLIL_CONST_DATA, {ConstantDataHighLevelOperandUsage}},
+		{HLIL_ADD, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_SUB, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_AND, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_OR, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_XOR, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_LSL, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_LSR, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_ASR, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_ROL, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_ROR, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_MUL, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_MULU_DP, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_MULS_DP, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_DIVU, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_DIVS, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_MODU, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_MODS, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_CMP_E, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_CMP_NE, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_CMP_SLT, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_CMP_ULT, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_CMP_SLE, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_CMP_ULE, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_CMP_SGE, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_CMP_UGE, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_CMP_SGT, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_CMP_UGT, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_TEST_BIT, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_ADD_OVERFLOW, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_ADC, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage, CarryExprHighLevelOperandUsage}},
+		{HLIL_SBB, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage, CarryExprHighLevelOperandUsage}},
+		{HLIL_RLC, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage, CarryExprHighLevelOperandUsage}},
+		{HLIL_RRC, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage, CarryExprHighLevelOperandUsage}},
+		{HLIL_DIVU_DP, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_DIVS_DP, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_MODU_DP, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_MODS_DP, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_NEG, {SourceExprHighLevelOperandUsage}},
+		{HLIL_NOT, {SourceExprHighLevelOperandUsage}},
+		{HLIL_SX, {SourceExprHighLevelOperandUsage}},
+		{HLIL_ZX, {SourceExprHighLevelOperandUsage}},
+		{HLIL_LOW_PART, {SourceExprHighLevelOperandUsage}},
+		{HLIL_BOOL_TO_INT, {SourceExprHighLevelOperandUsage}},
+		{HLIL_UNIMPL_MEM, {SourceExprHighLevelOperandUsage}},
+		{HLIL_FADD, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_FSUB, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_FMUL, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_FDIV, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_FSQRT, {SourceExprHighLevelOperandUsage}},
+		{HLIL_FNEG, {SourceExprHighLevelOperandUsage}},
+		{HLIL_FABS, {SourceExprHighLevelOperandUsage}},
+		{HLIL_FLOAT_TO_INT, {SourceExprHighLevelOperandUsage}},
+		{HLIL_INT_TO_FLOAT, {SourceExprHighLevelOperandUsage}},
+		{HLIL_FLOAT_CONV, {SourceExprHighLevelOperandUsage}},
+		{HLIL_ROUND_TO_INT, {SourceExprHighLevelOperandUsage}},
+		{HLIL_FLOOR, {SourceExprHighLevelOperandUsage}},
+		{HLIL_CEIL, {SourceExprHighLevelOperandUsage}},
+		{HLIL_FTRUNC, {SourceExprHighLevelOperandUsage}},
+		{HLIL_FCMP_E, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_FCMP_NE, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_FCMP_LT, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_FCMP_LE, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_FCMP_GE, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_FCMP_GT, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_FCMP_O, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}},
+		{HLIL_FCMP_UO, {LeftExprHighLevelOperandUsage, RightExprHighLevelOperandUsage}}
+	};
+
+	constexpr size_t HighLevelILOperationCount = HLIL_MEM_PHI + 1;
+	constexpr size_t HighLevelILOperandUsageCount = DestMemoryVersionHighLevelOperandUsage + 1;
+	constexpr uint8_t HighLevelILInvalidOperandType = 0xff;
+	constexpr uint8_t HighLevelILInvalidOperandIndex = 0xff;
+
+	/*!
+		Dense operand lookup tables indexed by operation and operand usage, built at compile time
+		so that operand accessors do not need any hash lookups.
+
+		\ingroup highlevelil
+	*/
+	struct HighLevelILOperandTables
+	{
+		uint8_t operandType[HighLevelILOperandUsageCount];
+		uint8_t operandIndex[HighLevelILOperationCount][HighLevelILOperandUsageCount];
+	};
+
+	constexpr HighLevelILOperandTables BuildHighLevelILOperandTables()
+	{
+		HighLevelILOperandTables result {};
+		for (auto& type : result.operandType)
+			type = HighLevelILInvalidOperandType;
+		for (auto& operation : result.operandIndex)
+			for (auto& index : operation)
+				index = HighLevelILInvalidOperandIndex;
+
+		for (auto& i : HighLevelILOperandTypeForUsage)
+			result.operandType[i.usage] = (uint8_t)i.type;
+
+		for (auto& i : HighLevelILOperationOperandUsage)
+		{
+			size_t operand = 0;
+			for (auto usage : i.usages)
+			{
+				result.operandIndex[i.operation][usage] = (uint8_t)operand;
+				switch (result.operandType[usage])
+				{
+				case SSAVariableHighLevelOperand:
+				case SSAVariableListHighLevelOperand:
+				case ExprListHighLevelOperand:
+				case IndexListHighLevelOperand:
+					// SSA variables and lists take two operand slots
+					operand += 2;
+					break;
+				default:
+					operand++;
+					break;
+				}
+			}
+		}
+		return result;
+	}
+
+	inline constexpr HighLevelILOperandTables HighLevelILOperandTable = BuildHighLevelILOperandTables();
+
+	// Returns HighLevelILInvalidOperandIndex if the operation does not have an operand with the given usage
+	constexpr size_t GetHighLevelILOperandIndex(BNHighLevelILOperation operation, HighLevelILOperandUsage usage)
+	{
+		if (((size_t)operation >= HighLevelILOperationCount) || ((size_t)usage >= HighLevelILOperandUsageCount))
+			return HighLevelILInvalidOperandIndex;
+		return HighLevelILOperandTable.operandIndex[operation][usage];
+	}
 }  // namespace BinaryNinjaCore
 
 namespace std {
@@ -447,6 +720,16 @@ namespace BinaryNinja
 		void VisitExprs(const std::function<bool(const HighLevelILInstruction& expr)>& preFunc,
 			const std::function<void(const HighLevelILInstruction& expr)>& postFunc) const;
 
+		// Calls func with each direct sub-expression, in the order VisitExprs visits them
+		template <typename T>
+		void ForEachSubExpr(T&& func) const;
+
+		// Non-recursive, allocation free alternative to VisitExprs, see LowLevelILInstruction::WalkExprs
+		template <typename PreFunc>
+		bool WalkExprs(PreFunc&& preFunc) const;
+		template <typename PreFunc, typename PostFunc>
+		bool WalkExprs(PreFunc&& preFunc, PostFunc&& postFunc) const;
+
 		ExprId CopyTo(HighLevelILFunction* dest) const;
 		ExprId CopyTo(HighLevelILFunction* dest,
 		    const std::function<ExprId(const HighLevelILInstruction& subExpr)>& subExprHandler) const;
@@ -833,6 +1116,125 @@ namespace BinaryNinja
 		operator _STD_VECTOR<HighLevelILOperand>() const;
 	};
 
+#ifndef BINARYNINJACORE_LIBRARY
+	class HighLevelILExprSnapshot;
+
+	/*!
+		A single expression within a HighLevelILExprSnapshot. Reads directly from the snapshot
+		columns, call GetInstruction to obtain a full HighLevelILInstruction when needed.
+
+		\ingroup highlevelil
+	*/
+	class HighLevelILSnapshotExpr
+	{
+		const HighLevelILExprSnapshot* m_snapshot;
+		size_t m_exprIndex;
+
+	  public:
+		HighLevelILSnapshotExpr(const HighLevelILExprSnapshot* snapshot, size_t expr) :
+		    m_snapshot(snapshot), m_exprIndex(expr)
+		{}
+
+		size_t GetExprIndex() const { return m_exprIndex; }
+		inline BNHighLevelILOperation GetOperation() const;
+		inline uint32_t GetAttributes() const;
+		inline size_t GetSize() const;
+		inline uint32_t GetSourceOperand() const;
+		inline uint64_t GetAddress() const;
+		inline size_t GetParent() const;
+		inline uint64_t GetRawOperand(size_t operand) const;
+
+		BNHighLevelILInstruction GetRawExpr() const;
+		HighLevelILInstruction GetInstruction() const;
+	};
+
+	/*!
+		Copy of every expression of a HighLevelILFunction, stored as one contiguous array per field.
+		Scanning a snapshot avoids constructing a HighLevelILInstruction (and the associated
+		reference counting) for every expression of the function.
+
+		\ingroup highlevelil
+	*/
+	class HighLevelILExprSnapshot
+	{
+		struct ListIterator
+		{
+			const HighLevelILExprSnapshot* owner;
+			size_t index;
+			bool operator==(const ListIterator& a) const { return index == a.index; }
+			bool operator!=(const ListIterator& a) const { return index != a.index; }
+			bool operator<(const ListIterator& a) const { return index < a.index; }
+			ListIterator& operator++()
+			{
+				++index;
+				return *this;
+			}
+			HighLevelILSnapshotExpr operator*() const { return HighLevelILSnapshotExpr(owner, index); }
+		};
+
+		Ref<HighLevelILFunction> m_function;
+		bool m_asFullAst;
+		std::vector<BNHighLevelILOperation> m_operations;
+		std::vector<uint32_t> m_attributes;
+		std::vector<size_t> m_sizes;
+		std::vector<uint32_t> m_sourceOperands;
+		std::vector<uint64_t> m_addresses;
+		std::vector<size_t> m_parents;
+		std::vector<uint64_t> m_operands[5];
+
+	  public:
+		typedef ListIterator const_iterator;
+
+		HighLevelILExprSnapshot(HighLevelILFunction* func, bool asFullAst = true);
+
+		HighLevelILFunction* GetFunction() const { return m_function; }
+		bool IsFullAst() const { return m_asFullAst; }
+
+		const_iterator begin() const { return const_iterator {this, 0}; }
+		const_iterator end() const { return const_iterator {this, m_operations.size()}; }
+		size_t size() const { return m_operations.size(); }
+		HighLevelILSnapshotExpr operator[](size_t i) const { return HighLevelILSnapshotExpr(this, i); }
+
+		// Column access, each array has size() entries indexed by expression index
+		const BNHighLevelILOperation* GetOperations() const { return m_operations.data(); }
+		const uint32_t* GetAttributes() const { return m_attributes.data(); }
+		const size_t* GetSizes() const { return m_sizes.data(); }
+		const uint32_t* GetSourceOperands() const { return m_sourceOperands.data(); }
+		const uint64_t* GetAddresses() const { return m_addresses.data(); }
+		const size_t* GetParents() const { return m_parents.data(); }
+		const uint64_t* GetOperands(size_t operand) const { return m_operands[operand].data(); }
+	};
+
+	BNHighLevelILOperation HighLevelILSnapshotExpr::GetOperation() const
+	{
+		return m_snapshot->GetOperations()[m_exprIndex];
+	}
+	uint32_t HighLevelILSnapshotExpr::GetAttributes() const
+	{
+		return m_snapshot->GetAttributes()[m_exprIndex];
+	}
+	size_t HighLevelILSnapshotExpr::GetSize() const
+	{
+		return m_snapshot->GetSizes()[m_exprIndex];
+	}
+	uint32_t HighLevelILSnapshotExpr::GetSourceOperand() const
+	{
+		return m_snapshot->GetSourceOperands()[m_exprIndex];
+	}
+	uint64_t HighLevelILSnapshotExpr::GetAddress() const
+	{
+		return m_snapshot->GetAddresses()[m_exprIndex];
+	}
+	size_t HighLevelILSnapshotExpr::GetParent() const
+	{
+		return m_snapshot->GetParents()[m_exprIndex];
+	}
+	uint64_t HighLevelILSnapshotExpr::GetRawOperand(size_t operand) const
+	{
+		return m_snapshot->GetOperands(operand)[m_exprIndex];
+	}
+#endif
+
 	/*!
 		\ingroup highlevelil
 	*/
@@ -1416,6 +1818,253 @@ namespace BinaryNinja
 	struct HighLevelILInstructionAccessor<HLIL_FTRUNC> : public HighLevelILOneOperandInstruction
 	{};
 
+	template <typename T>
+	void HighLevelILInstruction::ForEachSubExpr(T&& func) const
+	{
+		switch (operation)
+		{
+		case HLIL_BLOCK:
+			for (auto i : GetBlockExprs<HLIL_BLOCK>())
+				func(i);
+			break;
+		case HLIL_IF:
+			func(GetConditionExpr<HLIL_IF>());
+			if (ast)
+			{
+				func(GetTrueExpr<HLIL_IF>());
+				func(GetFalseExpr<HLIL_IF>());
+			}
+			break;
+		case HLIL_WHILE:
+			func(GetConditionExpr<HLIL_WHILE>());
+			if (ast)
+				func(GetLoopExpr<HLIL_WHILE>());
+			break;
+		case HLIL_WHILE_SSA:
+			func(GetConditionPhiExpr<HLIL_WHILE_SSA>());
+			func(GetConditionExpr<HLIL_WHILE_SSA>());
+			if (ast)
+				func(GetLoopExpr<HLIL_WHILE_SSA>());
+			break;
+		case HLIL_DO_WHILE:
+			if (ast)
+				func(GetLoopExpr<HLIL_DO_WHILE>());
+			func(GetConditionExpr<HLIL_DO_WHILE>());
+			break;
+		case HLIL_DO_WHILE_SSA:
+			if (ast)
+				func(GetLoopExpr<HLIL_DO_WHILE_SSA>());
+			func(GetConditionPhiExpr<HLIL_DO_WHILE_SSA>());
+			func(GetConditionExpr<HLIL_DO_WHILE_SSA>());
+			break;
+		case HLIL_FOR:
+			func(GetInitExpr<HLIL_FOR>());
+			func(GetConditionExpr<HLIL_FOR>());
+			func(GetUpdateExpr<HLIL_FOR>());
+			if (ast)
+				func(GetLoopExpr<HLIL_FOR>());
+			break;
+		case HLIL_FOR_SSA:
+			func(GetInitExpr<HLIL_FOR_SSA>());
+			func(GetConditionPhiExpr<HLIL_FOR_SSA>());
+			func(GetConditionExpr<HLIL_FOR_SSA>());
+			func(GetUpdateExpr<HLIL_FOR_SSA>());
+			if (ast)
+				func(GetLoopExpr<HLIL_FOR_SSA>());
+			break;
+		case HLIL_SWITCH:
+			func(GetConditionExpr<HLIL_SWITCH>());
+			if (ast)
+			{
+				func(GetDefaultExpr<HLIL_SWITCH>());
+				for (auto i : GetCases<HLIL_SWITCH>())
+					func(i);
+			}
+			break;
+		case HLIL_CASE:
+			for (auto i : GetValueExprs<HLIL_CASE>())
+				func(i);
+			func(GetTrueExpr<HLIL_CASE>());
+			break;
+		case HLIL_VAR_INIT:
+			func(GetSourceExpr<HLIL_VAR_INIT>());
+			break;
+		case HLIL_VAR_INIT_SSA:
+			func(GetSourceExpr<HLIL_VAR_INIT_SSA>());
+			break;
+		case HLIL_ASSIGN:
+			func(GetSourceExpr<HLIL_ASSIGN>());
+			func(GetDestExpr<HLIL_ASSIGN>());
+			break;
+		case HLIL_ASSIGN_UNPACK:
+			func(GetSourceExpr<HLIL_ASSIGN_UNPACK>());
+			for (auto i : GetDestExprs<HLIL_ASSIGN_UNPACK>())
+				func(i);
+			break;
+		case HLIL_ASSIGN_MEM_SSA:
+			func(GetSourceExpr<HLIL_ASSIGN_MEM_SSA>());
+			func(GetDestExpr<HLIL_ASSIGN_MEM_SSA>());
+			break;
+		case HLIL_ASSIGN_UNPACK_MEM_SSA:
+			func(GetSourceExpr<HLIL_ASSIGN_UNPACK_MEM_SSA>());
+			for (auto i : GetDestExprs<HLIL_ASSIGN_UNPACK_MEM_SSA>())
+				func(i);
+			break;
+		case HLIL_STRUCT_FIELD:
+			func(GetSourceExpr<HLIL_STRUCT_FIELD>());
+			break;
+		case HLIL_ARRAY_INDEX:
+			func(GetIndexExpr<HLIL_ARRAY_INDEX>());
+			func(GetSourceExpr<HLIL_ARRAY_INDEX>());
+			break;
+		case HLIL_ARRAY_INDEX_SSA:
+			func(GetIndexExpr<HLIL_ARRAY_INDEX_SSA>());
+			func(GetSourceExpr<HLIL_ARRAY_INDEX_SSA>());
+			break;
+		case HLIL_SPLIT:
+			func(GetHighExpr<HLIL_SPLIT>());
+			func(GetLowExpr<HLIL_SPLIT>());
+			break;
+		case HLIL_DEREF_FIELD:
+			func(GetSourceExpr<HLIL_DEREF_FIELD>());
+			break;
+		case HLIL_DEREF_SSA:
+			func(GetSourceExpr<HLIL_DEREF_SSA>());
+			break;
+		case HLIL_DEREF_FIELD_SSA:
+			func(GetSourceExpr<HLIL_DEREF_FIELD_SSA>());
+			break;
+		case HLIL_CALL:
+			for (auto i : GetParameterExprs<HLIL_CALL>())
+				func(i);
+			func(GetDestExpr<HLIL_CALL>());
+			break;
+		case HLIL_SYSCALL:
+			for (auto i : GetParameterExprs<HLIL_SYSCALL>())
+				func(i);
+			break;
+		case HLIL_TAILCALL:
+			for (auto i : GetParameterExprs<HLIL_TAILCALL>())
+				func(i);
+			func(GetDestExpr<HLIL_TAILCALL>());
+			break;
+		case HLIL_CALL_SSA:
+			for (auto i : GetParameterExprs<HLIL_CALL_SSA>())
+				func(i);
+			func(GetDestExpr<HLIL_CALL_SSA>());
+			break;
+		case HLIL_SYSCALL_SSA:
+			for (auto i : GetParameterExprs<HLIL_SYSCALL_SSA>())
+				func(i);
+			break;
+		case HLIL_RET:
+			for (auto i : GetSourceExprs<HLIL_RET>())
+				func(i);
+			break;
+		case HLIL_DEREF:
+		case HLIL_ADDRESS_OF:
+		case HLIL_NEG:
+		case HLIL_NOT:
+		case HLIL_SX:
+		case HLIL_ZX:
+		case HLIL_LOW_PART:
+		case HLIL_BOOL_TO_INT:
+		case HLIL_JUMP:
+		case HLIL_UNIMPL_MEM:
+		case HLIL_FSQRT:
+		case HLIL_FNEG:
+		case HLIL_FABS:
+		case HLIL_FLOAT_TO_INT:
+		case HLIL_INT_TO_FLOAT:
+		case HLIL_FLOAT_CONV:
+		case HLIL_ROUND_TO_INT:
+		case HLIL_FLOOR:
+		case HLIL_CEIL:
+		case HLIL_FTRUNC:
+			func(AsOneOperand().GetSourceExpr());
+			break;
+		case HLIL_ADD:
+		case HLIL_SUB:
+		case HLIL_AND:
+		case HLIL_OR:
+		case HLIL_XOR:
+		case HLIL_LSL:
+		case HLIL_LSR:
+		case HLIL_ASR:
+		case HLIL_ROL:
+		case HLIL_ROR:
+		case HLIL_MUL:
+		case HLIL_MULU_DP:
+		case HLIL_MULS_DP:
+		case HLIL_DIVU:
+		case HLIL_DIVS:
+		case HLIL_MODU:
+		case HLIL_MODS:
+		case HLIL_DIVU_DP:
+		case HLIL_DIVS_DP:
+		case HLIL_MODU_DP:
+		case HLIL_MODS_DP:
+		case HLIL_CMP_E:
+		case HLIL_CMP_NE:
+		case HLIL_CMP_SLT:
+		case HLIL_CMP_ULT:
+		case HLIL_CMP_SLE:
+		case HLIL_CMP_ULE:
+		case HLIL_CMP_SGE:
+		case HLIL_CMP_UGE:
+		case HLIL_CMP_SGT:
+		case HLIL_CMP_UGT:
+		case HLIL_TEST_BIT:
+		case HLIL_ADD_OVERFLOW:
+		case HLIL_FADD:
+		case HLIL_FSUB:
+		case HLIL_FMUL:
+		case HLIL_FDIV:
+		case HLIL_FCMP_E:
+		case HLIL_FCMP_NE:
+		case HLIL_FCMP_LT:
+		case HLIL_FCMP_LE:
+		case HLIL_FCMP_GE:
+		case HLIL_FCMP_GT:
+		case HLIL_FCMP_O:
+		case HLIL_FCMP_UO:
+			func(AsTwoOperand().GetLeftExpr());
+			func(AsTwoOperand().GetRightExpr());
+			break;
+		case HLIL_ADC:
+		case HLIL_SBB:
+		case HLIL_RLC:
+		case HLIL_RRC:
+			func(AsTwoOperandWithCarry().GetLeftExpr());
+			func(AsTwoOperandWithCarry().GetRightExpr());
+			func(AsTwoOperandWithCarry().GetCarryExpr());
+			break;
+		case HLIL_INTRINSIC:
+			for (auto i : GetParameterExprs<HLIL_INTRINSIC>())
+				func(i);
+			break;
+		case HLIL_INTRINSIC_SSA:
+			for (auto i : GetParameterExprs<HLIL_INTRINSIC_SSA>())
+				func(i);
+			break;
+		default:
+			break;
+		}
+	}
+
+	template <typename PreFunc>
+	bool HighLevelILInstruction::WalkExprs(PreFunc&& preFunc) const
+	{
+		auto postFunc = [](const HighLevelILInstruction&) {};
+		return WalkILExprs<false>(*this, preFunc, postFunc);
+	}
+
+	template <typename PreFunc, typename PostFunc>
+	bool HighLevelILInstruction::WalkExprs(PreFunc&& preFunc, PostFunc&& postFunc) const
+	{
+		return WalkILExprs<true>(*this, preFunc, postFunc);
+	}
+
 #undef _STD_VECTOR
 #undef _STD_SET
 #undef _STD_UNORDERED_MAP
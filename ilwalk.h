@@ -0,0 +1,149 @@
+// Copyright (c) 2015-2024 Vector 35 Inc
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#pragma once
+
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef BINARYNINJACORE_LIBRARY
+namespace BinaryNinjaCore
+#else
+namespace BinaryNinja
+#endif
+{
+	/*!
+		Result of a WalkExprs callback. Callbacks may also return bool, where false skips the
+		sub-expressions of the current expression in the same way as VisitExprs.
+	*/
+	enum ILWalkAction
+	{
+		WalkContinue,
+		WalkSkipChildren,
+		WalkStop
+	};
+
+	inline ILWalkAction GetILWalkAction(ILWalkAction action)
+	{
+		return action;
+	}
+
+	inline ILWalkAction GetILWalkAction(bool result)
+	{
+		return result ? WalkContinue : WalkSkipChildren;
+	}
+
+	/*!
+		Stack with inline storage for the first N entries, so that walking typical expression trees
+		does not touch the heap.
+	*/
+	template <typename T, size_t N>
+	class ILWalkStack
+	{
+		T m_inline[N];
+		std::vector<T> m_overflow;
+		size_t m_size = 0;
+
+	  public:
+		bool empty() const { return m_size == 0; }
+		size_t size() const { return m_size; }
+		T& operator[](size_t i) { return (i < N) ? m_inline[i] : m_overflow[i - N]; }
+		T& top() { return (*this)[m_size - 1]; }
+
+		void push(T value)
+		{
+			if (m_size < N)
+				m_inline[m_size] = std::move(value);
+			else
+				m_overflow.push_back(std::move(value));
+			m_size++;
+		}
+
+		T pop()
+		{
+			T result = std::move(top());
+			if (m_size > N)
+				m_overflow.pop_back();
+			m_size--;
+			return result;
+		}
+
+		// Reverses the order of the entries from index first to the top of the stack
+		void reverse(size_t first)
+		{
+			for (size_t last = m_size; first + 1 < last; first++, last--)
+				std::swap((*this)[first], (*this)[last - 1]);
+		}
+	};
+
+	// Shared implementation of the WalkExprs methods of the IL instruction types
+	template <bool HasPost, typename Instr, typename PreFunc, typename PostFunc>
+	bool WalkILExprs(const Instr& root, PreFunc& preFunc, PostFunc& postFunc)
+	{
+		struct Entry
+		{
+			Instr expr;
+			bool post;
+		};
+
+		ILWalkStack<Entry, 32> pending;
+		pending.push(Entry {root, false});
+		while (!pending.empty())
+		{
+			Entry entry = pending.pop();
+			if constexpr (HasPost)
+			{
+				if (entry.post)
+				{
+					if constexpr (std::is_same_v<std::invoke_result_t<PostFunc&, const Instr&>, bool>)
+					{
+						if (!postFunc(entry.expr))
+							return false;
+					}
+					else
+					{
+						postFunc(entry.expr);
+					}
+					continue;
+				}
+			}
+
+			switch (GetILWalkAction(preFunc(entry.expr)))
+			{
+			case WalkStop:
+				return false;
+			case WalkSkipChildren:
+				continue;
+			default:
+				break;
+			}
+
+			if constexpr (HasPost)
+				pending.push(Entry {entry.expr, true});
+
+			// Sub-expressions are pushed in visit order and then reversed so they are popped in order
+			size_t first = pending.size();
+			entry.expr.ForEachSubExpr([&](const Instr& subExpr) { pending.push(Entry {subExpr, false}); });
+			pending.reverse(first);
+		}
+		return true;
+	}
+}  // namespace BinaryNinjaCore
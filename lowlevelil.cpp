@@ -581,6 +581,61 @@ size_t LowLevelILFunction::GetExprCount() const
 }
 
 
+LowLevelILExprSnapshot LowLevelILFunction::GetExprSnapshot()
+{
+	return LowLevelILExprSnapshot(this);
+}
+
+
+LowLevelILExprSnapshot::LowLevelILExprSnapshot(LowLevelILFunction* func) : m_function(func)
+{
+	size_t count = func->GetExprCount();
+	m_operations.resize(count);
+	m_attributes.resize(count);
+	m_sizes.resize(count);
+	m_flags.resize(count);
+	m_sourceOperands.resize(count);
+	m_addresses.resize(count);
+	for (auto& operands : m_operands)
+		operands.resize(count);
+
+	for (size_t i = 0; i < count; i++)
+	{
+		BNLowLevelILInstruction instr = func->GetRawExpr(i);
+		m_operations[i] = instr.operation;
+		m_attributes[i] = instr.attributes;
+		m_sizes[i] = instr.size;
+		m_flags[i] = instr.flags;
+		m_sourceOperands[i] = instr.sourceOperand;
+		m_addresses[i] = instr.address;
+		for (size_t j = 0; j < 4; j++)
+			m_operands[j][i] = instr.operands[j];
+	}
+}
+
+
+BNLowLevelILInstruction LowLevelILSnapshotExpr::GetRawExpr() const
+{
+	BNLowLevelILInstruction result;
+	result.operation = GetOperation();
+	result.attributes = GetAttributes();
+	result.size = GetSize();
+	result.flags = GetFlags();
+	result.sourceOperand = GetSourceOperand();
+	result.address = GetAddress();
+	for (size_t i = 0; i < 4; i++)
+		result.operands[i] = GetRawOperand(i);
+	return result;
+}
+
+
+LowLevelILInstruction LowLevelILSnapshotExpr::GetInstruction() const
+{
+	LowLevelILFunction* func = m_snapshot->GetFunction();
+	return LowLevelILInstruction(func, GetRawExpr(), m_exprIndex, func->GetInstructionForExpr(m_exprIndex));
+}
+
+
 void LowLevelILFunction::UpdateInstructionOperand(size_t i, size_t operandIndex, ExprId value)
 {
 	BNUpdateLowLevelILOperand(m_object, i, operandIndex, value);
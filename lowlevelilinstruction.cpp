@@ -36,275 +36,56 @@ using namespace std;
 #endif
 
 
-unordered_map<LowLevelILOperandUsage, LowLevelILOperandType> LowLevelILInstructionBase::operandTypeForUsage = {
-    {SourceExprLowLevelOperandUsage, ExprLowLevelOperand},
-    {SourceRegisterLowLevelOperandUsage, RegisterLowLevelOperand},
-    {SourceRegisterStackLowLevelOperandUsage, RegisterStackLowLevelOperand},
-    {SourceFlagLowLevelOperandUsage, FlagLowLevelOperand},
-    {SourceSSARegisterLowLevelOperandUsage, SSARegisterLowLevelOperand},
-    {SourceSSARegisterStackLowLevelOperandUsage, SSARegisterStackLowLevelOperand},
-    {SourceSSAFlagLowLevelOperandUsage, SSAFlagLowLevelOperand}, {DestExprLowLevelOperandUsage, ExprLowLevelOperand},
-    {DestRegisterLowLevelOperandUsage, RegisterLowLevelOperand},
-    {DestRegisterStackLowLevelOperandUsage, RegisterStackLowLevelOperand},
-    {DestFlagLowLevelOperandUsage, FlagLowLevelOperand},
-    {DestSSARegisterLowLevelOperandUsage, SSARegisterLowLevelOperand},
-    {DestSSARegisterStackLowLevelOperandUsage, SSARegisterStackLowLevelOperand},
-    {DestSSAFlagLowLevelOperandUsage, SSAFlagLowLevelOperand},
-    {SemanticFlagClassLowLevelOperandUsage, SemanticFlagClassLowLevelOperand},
-    {SemanticFlagGroupLowLevelOperandUsage, SemanticFlagGroupLowLevelOperand},
-    {PartialRegisterLowLevelOperandUsage, RegisterLowLevelOperand},
-    {PartialSSARegisterStackSourceLowLevelOperandUsage, SSARegisterStackLowLevelOperand},
-    {StackSSARegisterLowLevelOperandUsage, SSARegisterLowLevelOperand},
-    {StackMemoryVersionLowLevelOperandUsage, IndexLowLevelOperand},
-    {TopSSARegisterLowLevelOperandUsage, SSARegisterLowLevelOperand},
-    {LeftExprLowLevelOperandUsage, ExprLowLevelOperand}, {RightExprLowLevelOperandUsage, ExprLowLevelOperand},
-    {CarryExprLowLevelOperandUsage, ExprLowLevelOperand}, {ConditionExprLowLevelOperandUsage, ExprLowLevelOperand},
-    {HighRegisterLowLevelOperandUsage, RegisterLowLevelOperand},
-    {HighSSARegisterLowLevelOperandUsage, SSARegisterLowLevelOperand},
-    {LowRegisterLowLevelOperandUsage, RegisterLowLevelOperand},
-    {LowSSARegisterLowLevelOperandUsage, SSARegisterLowLevelOperand},
-    {IntrinsicLowLevelOperandUsage, IntrinsicLowLevelOperand}, {ConstantLowLevelOperandUsage, IntegerLowLevelOperand},
-    {VectorLowLevelOperandUsage, IntegerLowLevelOperand}, {StackAdjustmentLowLevelOperandUsage, IntegerLowLevelOperand},
-    {TargetLowLevelOperandUsage, IndexLowLevelOperand}, {TrueTargetLowLevelOperandUsage, IndexLowLevelOperand},
-    {FalseTargetLowLevelOperandUsage, IndexLowLevelOperand}, {BitIndexLowLevelOperandUsage, IndexLowLevelOperand},
-    {SourceMemoryVersionLowLevelOperandUsage, IndexLowLevelOperand},
-    {DestMemoryVersionLowLevelOperandUsage, IndexLowLevelOperand},
-    {FlagConditionLowLevelOperandUsage, FlagConditionLowLevelOperand},
-    {OutputSSARegistersLowLevelOperandUsage, SSARegisterListLowLevelOperand},
-    {OutputMemoryVersionLowLevelOperandUsage, IndexLowLevelOperand},
-    {ParameterExprsLowLevelOperandUsage, ExprListLowLevelOperand},
-    {SourceSSARegistersLowLevelOperandUsage, SSARegisterListLowLevelOperand},
-    {SourceSSARegisterStacksLowLevelOperandUsage, SSARegisterStackListLowLevelOperand},
-    {SourceSSAFlagsLowLevelOperandUsage, SSAFlagListLowLevelOperand},
-    {OutputRegisterOrFlagListLowLevelOperandUsage, RegisterOrFlagListLowLevelOperand},
-    {OutputSSARegisterOrFlagListLowLevelOperandUsage, SSARegisterOrFlagListLowLevelOperand},
-    {OutputMemoryIntrinsicLowLevelOperandUsage, SSARegisterOrFlagListLowLevelOperand},
-    {SourceMemoryVersionsLowLevelOperandUsage, IndexListLowLevelOperand},
-    {TargetsLowLevelOperandUsage, IndexMapLowLevelOperand},
-    {RegisterStackAdjustmentsLowLevelOperandUsage, RegisterStackAdjustmentsLowLevelOperand}};
+static unordered_map<LowLevelILOperandUsage, LowLevelILOperandType> GetOperandTypeForUsages()
+{
+	unordered_map<LowLevelILOperandUsage, LowLevelILOperandType> result;
+	result.reserve(sizeof(LowLevelILOperandTypeForUsage) / sizeof(LowLevelILOperandTypeForUsage[0]));
+	for (auto& i : LowLevelILOperandTypeForUsage)
+		result[i.usage] = i.type;
+	return result;
+}
 
 
-unordered_map<BNLowLevelILOperation, vector<LowLevelILOperandUsage>> LowLevelILInstructionBase::operationOperandUsage =
-    {{LLIL_NOP, {}}, {LLIL_POP, {}}, {LLIL_NORET, {}}, {LLIL_SYSCALL, {}}, {LLIL_BP, {}}, {LLIL_UNDEF, {}},
-        {LLIL_UNIMPL, {}}, {LLIL_SET_REG, {DestRegisterLowLevelOperandUsage, SourceExprLowLevelOperandUsage}},
-        {LLIL_SET_REG_SPLIT,
-            {HighRegisterLowLevelOperandUsage, LowRegisterLowLevelOperandUsage, SourceExprLowLevelOperandUsage}},
-        {LLIL_SET_REG_SSA, {DestSSARegisterLowLevelOperandUsage, SourceExprLowLevelOperandUsage}},
-        {LLIL_SET_REG_SSA_PARTIAL,
-            {DestSSARegisterLowLevelOperandUsage, PartialRegisterLowLevelOperandUsage, SourceExprLowLevelOperandUsage}},
-        {LLIL_SET_REG_SPLIT_SSA,
-            {HighSSARegisterLowLevelOperandUsage, LowSSARegisterLowLevelOperandUsage, SourceExprLowLevelOperandUsage}},
-        {LLIL_SET_REG_STACK_REL,
-            {DestRegisterStackLowLevelOperandUsage, DestExprLowLevelOperandUsage, SourceExprLowLevelOperandUsage}},
-        {LLIL_REG_STACK_PUSH, {DestRegisterStackLowLevelOperandUsage, SourceExprLowLevelOperandUsage}},
-        {LLIL_SET_REG_STACK_REL_SSA,
-            {DestSSARegisterStackLowLevelOperandUsage, PartialSSARegisterStackSourceLowLevelOperandUsage,
-                DestExprLowLevelOperandUsage, TopSSARegisterLowLevelOperandUsage, SourceExprLowLevelOperandUsage}},
-        {LLIL_SET_REG_STACK_ABS_SSA,
-            {DestSSARegisterStackLowLevelOperandUsage, PartialSSARegisterStackSourceLowLevelOperandUsage,
-                DestRegisterLowLevelOperandUsage, SourceExprLowLevelOperandUsage}},
-        {LLIL_SET_FLAG, {DestFlagLowLevelOperandUsage, SourceExprLowLevelOperandUsage}},
-        {LLIL_SET_FLAG_SSA, {DestSSAFlagLowLevelOperandUsage, SourceExprLowLevelOperandUsage}},
-        {LLIL_LOAD, {SourceExprLowLevelOperandUsage}},
-        {LLIL_LOAD_SSA, {SourceExprLowLevelOperandUsage, SourceMemoryVersionLowLevelOperandUsage}},
-        {LLIL_STORE, {DestExprLowLevelOperandUsage, SourceExprLowLevelOperandUsage}},
-        {LLIL_STORE_SSA, {DestExprLowLevelOperandUsage, DestMemoryVersionLowLevelOperandUsage,
-                             SourceMemoryVersionLowLevelOperandUsage, SourceExprLowLevelOperandUsage}},
-        {LLIL_REG, {SourceRegisterLowLevelOperandUsage}}, {LLIL_REG_SSA, {SourceSSARegisterLowLevelOperandUsage}},
-        {LLIL_REG_SSA_PARTIAL, {SourceSSARegisterLowLevelOperandUsage, PartialRegisterLowLevelOperandUsage}},
-        {LLIL_REG_SPLIT, {HighRegisterLowLevelOperandUsage, LowRegisterLowLevelOperandUsage}},
-        {LLIL_REG_SPLIT_SSA, {HighSSARegisterLowLevelOperandUsage, LowSSARegisterLowLevelOperandUsage}},
-        {LLIL_REG_STACK_REL, {SourceRegisterStackLowLevelOperandUsage, SourceExprLowLevelOperandUsage}},
-        {LLIL_REG_STACK_POP, {SourceRegisterStackLowLevelOperandUsage}},
-        {LLIL_REG_STACK_FREE_REG, {DestRegisterLowLevelOperandUsage}},
-        {LLIL_REG_STACK_FREE_REL, {DestRegisterStackLowLevelOperandUsage, DestExprLowLevelOperandUsage}},
-        {LLIL_REG_STACK_REL_SSA, {SourceSSARegisterStackLowLevelOperandUsage, TopSSARegisterLowLevelOperandUsage,
-                                     SourceExprLowLevelOperandUsage}},
-        {LLIL_REG_STACK_ABS_SSA, {SourceSSARegisterStackLowLevelOperandUsage, SourceRegisterLowLevelOperandUsage}},
-        {LLIL_REG_STACK_FREE_REL_SSA,
-            {DestSSARegisterStackLowLevelOperandUsage, PartialSSARegisterStackSourceLowLevelOperandUsage,
-                DestExprLowLevelOperandUsage, TopSSARegisterLowLevelOperandUsage}},
-        {LLIL_REG_STACK_FREE_ABS_SSA,
-            {DestSSARegisterStackLowLevelOperandUsage, PartialSSARegisterStackSourceLowLevelOperandUsage,
-                DestRegisterLowLevelOperandUsage}},
-        {LLIL_FLAG, {SourceFlagLowLevelOperandUsage}},
-        {LLIL_FLAG_BIT, {SourceFlagLowLevelOperandUsage, BitIndexLowLevelOperandUsage}},
-        {LLIL_FLAG_SSA, {SourceSSAFlagLowLevelOperandUsage}},
-        {LLIL_FLAG_BIT_SSA, {SourceSSAFlagLowLevelOperandUsage, BitIndexLowLevelOperandUsage}},
-        {LLIL_JUMP, {DestExprLowLevelOperandUsage}},
-        {LLIL_JUMP_TO, {DestExprLowLevelOperandUsage, TargetsLowLevelOperandUsage}},
-        {LLIL_CALL, {DestExprLowLevelOperandUsage}},
-        {LLIL_CALL_STACK_ADJUST, {DestExprLowLevelOperandUsage, StackAdjustmentLowLevelOperandUsage,
-                                     RegisterStackAdjustmentsLowLevelOperandUsage}},
-        {LLIL_TAILCALL, {DestExprLowLevelOperandUsage}}, {LLIL_RET, {DestExprLowLevelOperandUsage}},
-        {LLIL_IF, {ConditionExprLowLevelOperandUsage, TrueTargetLowLevelOperandUsage, FalseTargetLowLevelOperandUsage}},
-        {LLIL_GOTO, {TargetLowLevelOperandUsage}},
-        {LLIL_FLAG_COND, {FlagConditionLowLevelOperandUsage, SemanticFlagClassLowLevelOperandUsage}},
-        {LLIL_FLAG_GROUP, {SemanticFlagGroupLowLevelOperandUsage}}, {LLIL_TRAP, {VectorLowLevelOperandUsage}},
-        {LLIL_CALL_SSA, {OutputSSARegistersLowLevelOperandUsage, OutputMemoryVersionLowLevelOperandUsage,
-                            DestExprLowLevelOperandUsage, StackSSARegisterLowLevelOperandUsage,
-                            StackMemoryVersionLowLevelOperandUsage, ParameterExprsLowLevelOperandUsage}},
-        {LLIL_SYSCALL_SSA, {OutputSSARegistersLowLevelOperandUsage, OutputMemoryVersionLowLevelOperandUsage,
-                               StackSSARegisterLowLevelOperandUsage, StackMemoryVersionLowLevelOperandUsage,
-                               ParameterExprsLowLevelOperandUsage}},
-        {LLIL_TAILCALL_SSA, {OutputSSARegistersLowLevelOperandUsage, OutputMemoryVersionLowLevelOperandUsage,
-                                DestExprLowLevelOperandUsage, StackSSARegisterLowLevelOperandUsage,
-                                StackMemoryVersionLowLevelOperandUsage, ParameterExprsLowLevelOperandUsage}},
-		{LLIL_SEPARATE_PARAM_LIST_SSA, {ParameterExprsLowLevelOperandUsage}},
-		{LLIL_SHARED_PARAM_SLOT_SSA, {ParameterExprsLowLevelOperandUsage}},
-        {LLIL_REG_PHI, {DestSSARegisterLowLevelOperandUsage, SourceSSARegistersLowLevelOperandUsage}},
-        {LLIL_REG_STACK_PHI, {DestSSARegisterStackLowLevelOperandUsage, SourceSSARegisterStacksLowLevelOperandUsage}},
-        {LLIL_FLAG_PHI, {DestSSAFlagLowLevelOperandUsage, SourceSSAFlagsLowLevelOperandUsage}},
-        {LLIL_MEM_PHI, {DestMemoryVersionLowLevelOperandUsage, SourceMemoryVersionsLowLevelOperandUsage}},
-        {LLIL_CONST, {ConstantLowLevelOperandUsage}}, {LLIL_CONST_PTR, {ConstantLowLevelOperandUsage}},
-        {LLIL_EXTERN_PTR, {ConstantLowLevelOperandUsage, OffsetLowLevelOperandUsage}},
-        {LLIL_FLOAT_CONST, {ConstantLowLevelOperandUsage}},
-        {LLIL_ADD, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_SUB, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_AND, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_OR, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_XOR, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_LSL, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_LSR, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_ASR, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_ROL, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_ROR, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_MUL, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_MULU_DP, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_MULS_DP, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_DIVU, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_DIVS, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_MODU, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_MODS, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_CMP_E, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_CMP_NE, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_CMP_SLT, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_CMP_ULT, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_CMP_SLE, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_CMP_ULE, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_CMP_SGE, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_CMP_UGE, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_CMP_SGT, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_CMP_UGT, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_TEST_BIT, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_ADD_OVERFLOW, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_ADC, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage, CarryExprLowLevelOperandUsage}},
-        {LLIL_SBB, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage, CarryExprLowLevelOperandUsage}},
-        {LLIL_RLC, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage, CarryExprLowLevelOperandUsage}},
-        {LLIL_RRC, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage, CarryExprLowLevelOperandUsage}},
-        {LLIL_DIVU_DP, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_DIVS_DP, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_MODU_DP, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_MODS_DP, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_PUSH, {SourceExprLowLevelOperandUsage}}, {LLIL_NEG, {SourceExprLowLevelOperandUsage}},
-        {LLIL_NOT, {SourceExprLowLevelOperandUsage}}, {LLIL_SX, {SourceExprLowLevelOperandUsage}},
-        {LLIL_ZX, {SourceExprLowLevelOperandUsage}}, {LLIL_LOW_PART, {SourceExprLowLevelOperandUsage}},
-        {LLIL_BOOL_TO_INT, {SourceExprLowLevelOperandUsage}},
-        {LLIL_INTRINSIC, {OutputRegisterOrFlagListLowLevelOperandUsage, IntrinsicLowLevelOperandUsage,
-                             ParameterExprsLowLevelOperandUsage}},
-        {LLIL_INTRINSIC_SSA, {OutputSSARegisterOrFlagListLowLevelOperandUsage, IntrinsicLowLevelOperandUsage,
-                                 ParameterExprsLowLevelOperandUsage}},
-        {LLIL_MEMORY_INTRINSIC_SSA, {OutputMemoryIntrinsicLowLevelOperandUsage, OutputMemoryVersionLowLevelOperandUsage, IntrinsicLowLevelOperandUsage,
-                                 ParameterExprsLowLevelOperandUsage, SourceMemoryVersionLowLevelOperandUsage}},
-        {LLIL_UNIMPL_MEM, {SourceExprLowLevelOperandUsage}},
-        {LLIL_FADD, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_FSUB, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_FMUL, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_FDIV, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_FSQRT, {SourceExprLowLevelOperandUsage}}, {LLIL_FNEG, {SourceExprLowLevelOperandUsage}},
-        {LLIL_FABS, {SourceExprLowLevelOperandUsage}}, {LLIL_FLOAT_TO_INT, {SourceExprLowLevelOperandUsage}},
-        {LLIL_INT_TO_FLOAT, {SourceExprLowLevelOperandUsage}}, {LLIL_FLOAT_CONV, {SourceExprLowLevelOperandUsage}},
-        {LLIL_ROUND_TO_INT, {SourceExprLowLevelOperandUsage}}, {LLIL_FLOOR, {SourceExprLowLevelOperandUsage}},
-        {LLIL_CEIL, {SourceExprLowLevelOperandUsage}}, {LLIL_FTRUNC, {SourceExprLowLevelOperandUsage}},
-        {LLIL_FCMP_E, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_FCMP_NE, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_FCMP_LT, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_FCMP_LE, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_FCMP_GE, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_FCMP_GT, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_FCMP_O, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
-        {LLIL_FCMP_UO, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}}};
+static unordered_map<BNLowLevelILOperation, vector<LowLevelILOperandUsage>> GetOperationOperandUsages()
+{
+	unordered_map<BNLowLevelILOperation, vector<LowLevelILOperandUsage>> result;
+	result.reserve(sizeof(LowLevelILOperationOperandUsage) / sizeof(LowLevelILOperationOperandUsage[0]));
+	for (auto& i : LowLevelILOperationOperandUsage)
+		result[i.operation] = vector<LowLevelILOperandUsage>(i.usages);
+	return result;
+}
 
 
 static unordered_map<BNLowLevelILOperation, unordered_map<LowLevelILOperandUsage, size_t>>
     GetOperandIndexForOperandUsages()
 {
 	unordered_map<BNLowLevelILOperation, unordered_map<LowLevelILOperandUsage, size_t>> result;
-	result.reserve(LowLevelILInstructionBase::operationOperandUsage.size());
-	for (auto& operation : LowLevelILInstructionBase::operationOperandUsage)
+	result.reserve(sizeof(LowLevelILOperationOperandUsage) / sizeof(LowLevelILOperationOperandUsage[0]));
+	for (auto& i : LowLevelILOperationOperandUsage)
 	{
-		result[operation.first] = unordered_map<LowLevelILOperandUsage, size_t>();
-
-		size_t operand = 0;
-		result[operation.first].reserve(operation.second.size());
-		for (auto usage : operation.second)
-		{
-			result[operation.first][usage] = operand;
-			switch (usage)
-			{
-			case HighSSARegisterLowLevelOperandUsage:
-			case LowSSARegisterLowLevelOperandUsage:
-			case PartialSSARegisterStackSourceLowLevelOperandUsage:
-			case TopSSARegisterLowLevelOperandUsage:
-				// Represented as subexpression, so only takes one slot even though it is an SSA register
-				operand++;
-				break;
-			case ParameterExprsLowLevelOperandUsage:
-				if (operand == 0)
-				{
-					// Represented as a counted list
-					operand += 2;
-				}
-				else
-				{
-					// Represented as subexpression, so only takes one slot even though it is a list
-					operand++;
-				}
-				break;
-			case OutputSSARegistersLowLevelOperandUsage:
-				// OutputMemoryVersionLowLevelOperandUsage follows at same operand
-				break;
-			case StackSSARegisterLowLevelOperandUsage:
-				// StackMemoryVersionLowLevelOperandUsage follows at same operand
-				break;
-			case DestSSARegisterStackLowLevelOperandUsage:
-				// PartialSSARegisterStackSourceLowLevelOperandUsage follows at same operand
-				break;
-			case OutputMemoryIntrinsicLowLevelOperandUsage:
-				// OutputMemoryVersionLowLevelOperandUsage follows at same operand
-				break;
-			default:
-				switch (LowLevelILInstructionBase::operandTypeForUsage[usage])
-				{
-				case SSARegisterLowLevelOperand:
-				case SSARegisterStackLowLevelOperand:
-				case SSAFlagLowLevelOperand:
-				case IndexListLowLevelOperand:
-				case IndexMapLowLevelOperand:
-				case SSARegisterListLowLevelOperand:
-				case SSARegisterStackListLowLevelOperand:
-				case SSAFlagListLowLevelOperand:
-				case RegisterStackAdjustmentsLowLevelOperand:
-				case RegisterOrFlagListLowLevelOperand:
-				case SSARegisterOrFlagListLowLevelOperand:
-					// SSA registers/flags and lists take two operand slots
-					operand += 2;
-					break;
-				default:
-					operand++;
-					break;
-				}
-				break;
-			}
-		}
+		auto& operandIndex = result[i.operation];
+		operandIndex.reserve(i.usages.size());
+		for (auto usage : i.usages)
+			operandIndex[usage] = GetLowLevelILOperandIndex(i.operation, usage);
 	}
 	return result;
 }
 
 
+unordered_map<LowLevelILOperandUsage, LowLevelILOperandType> LowLevelILInstructionBase::operandTypeForUsage = GetOperandTypeForUsages();
+unordered_map<BNLowLevelILOperation, vector<LowLevelILOperandUsage>> LowLevelILInstructionBase::operationOperandUsage =
+    GetOperationOperandUsages();
+
+
 unordered_map<BNLowLevelILOperation, unordered_map<LowLevelILOperandUsage, size_t>>
     LowLevelILInstructionBase::operationOperandIndex = GetOperandIndexForOperandUsages();
 
+// The dense tables must agree with the operand layout used by the templated accessors
+static_assert(GetLowLevelILOperandIndex(LLIL_SET_REG, SourceExprLowLevelOperandUsage) == 1);
+static_assert(GetLowLevelILOperandIndex(LLIL_CALL_SSA, DestExprLowLevelOperandUsage) == 1);
+static_assert(GetLowLevelILOperandIndex(LLIL_CALL_SSA, ParameterExprsLowLevelOperandUsage) == 3);
+static_assert(GetLowLevelILOperandIndex(LLIL_SET_REG, DestExprLowLevelOperandUsage) == LowLevelILInvalidOperandIndex);
+
 
 RegisterOrFlag::RegisterOrFlag() : isFlag(false), index(BN_INVALID_REGISTER) {}
 
@@ -1104,10 +885,9 @@ LowLevelILOperand::LowLevelILOperand(
     m_instr(instr),
     m_usage(usage), m_operandIndex(operandIndex)
 {
-	auto i = LowLevelILInstructionBase::operandTypeForUsage.find(m_usage);
-	if (i == LowLevelILInstructionBase::operandTypeForUsage.end())
+	if (((size_t)m_usage >= LowLevelILOperandUsageCount) || (LowLevelILOperandTable.operandType[m_usage] == LowLevelILInvalidOperandType))
 		throw LowLevelILInstructionAccessException();
-	m_type = i->second;
+	m_type = (LowLevelILOperandType)LowLevelILOperandTable.operandType[m_usage];
 }
 
 
@@ -1842,205 +1622,7 @@ void LowLevelILInstructionBase::ClearAttribute(BNILInstructionAttribute attribut
 
 void LowLevelILInstruction::VisitExprs(const std::function<bool(const LowLevelILInstruction& expr)>& func) const
 {
-	if (!func(*this))
-		return;
-	switch (operation)
-	{
-	case LLIL_SET_REG:
-		GetSourceExpr<LLIL_SET_REG>().VisitExprs(func);
-		break;
-	case LLIL_SET_REG_SPLIT:
-		GetSourceExpr<LLIL_SET_REG_SPLIT>().VisitExprs(func);
-		break;
-	case LLIL_SET_REG_SSA:
-		GetSourceExpr<LLIL_SET_REG_SSA>().VisitExprs(func);
-		break;
-	case LLIL_SET_REG_SSA_PARTIAL:
-		GetSourceExpr<LLIL_SET_REG_SSA_PARTIAL>().VisitExprs(func);
-		break;
-	case LLIL_SET_REG_SPLIT_SSA:
-		GetSourceExpr<LLIL_SET_REG_SPLIT_SSA>().VisitExprs(func);
-		break;
-	case LLIL_SET_REG_STACK_REL:
-		GetDestExpr<LLIL_SET_REG_STACK_REL>().VisitExprs(func);
-		GetSourceExpr<LLIL_SET_REG_STACK_REL>().VisitExprs(func);
-		break;
-	case LLIL_REG_STACK_PUSH:
-		GetSourceExpr<LLIL_REG_STACK_PUSH>().VisitExprs(func);
-		break;
-	case LLIL_SET_REG_STACK_REL_SSA:
-		GetDestExpr<LLIL_SET_REG_STACK_REL_SSA>().VisitExprs(func);
-		GetSourceExpr<LLIL_SET_REG_STACK_REL_SSA>().VisitExprs(func);
-		break;
-	case LLIL_SET_REG_STACK_ABS_SSA:
-		GetSourceExpr<LLIL_SET_REG_STACK_ABS_SSA>().VisitExprs(func);
-		break;
-	case LLIL_SET_FLAG:
-		GetSourceExpr<LLIL_SET_FLAG>().VisitExprs(func);
-		break;
-	case LLIL_SET_FLAG_SSA:
-		GetSourceExpr<LLIL_SET_FLAG_SSA>().VisitExprs(func);
-		break;
-	case LLIL_REG_STACK_REL:
-		GetSourceExpr<LLIL_REG_STACK_REL>().VisitExprs(func);
-		break;
-	case LLIL_REG_STACK_FREE_REL:
-		GetDestExpr<LLIL_REG_STACK_FREE_REL>().VisitExprs(func);
-		break;
-	case LLIL_REG_STACK_REL_SSA:
-		GetSourceExpr<LLIL_REG_STACK_REL_SSA>().VisitExprs(func);
-		break;
-	case LLIL_REG_STACK_FREE_REL_SSA:
-		GetDestExpr<LLIL_REG_STACK_FREE_REL_SSA>().VisitExprs(func);
-		break;
-	case LLIL_LOAD:
-		GetSourceExpr<LLIL_LOAD>().VisitExprs(func);
-		break;
-	case LLIL_LOAD_SSA:
-		GetSourceExpr<LLIL_LOAD_SSA>().VisitExprs(func);
-		break;
-	case LLIL_STORE:
-		GetDestExpr<LLIL_STORE>().VisitExprs(func);
-		GetSourceExpr<LLIL_STORE>().VisitExprs(func);
-		break;
-	case LLIL_STORE_SSA:
-		GetDestExpr<LLIL_STORE_SSA>().VisitExprs(func);
-		GetSourceExpr<LLIL_STORE_SSA>().VisitExprs(func);
-		break;
-	case LLIL_JUMP:
-		GetDestExpr<LLIL_JUMP>().VisitExprs(func);
-		break;
-	case LLIL_JUMP_TO:
-		GetDestExpr<LLIL_JUMP_TO>().VisitExprs(func);
-		break;
-	case LLIL_IF:
-		GetConditionExpr<LLIL_IF>().VisitExprs(func);
-		break;
-	case LLIL_CALL:
-		GetDestExpr<LLIL_CALL>().VisitExprs(func);
-		break;
-	case LLIL_CALL_STACK_ADJUST:
-		GetDestExpr<LLIL_CALL_STACK_ADJUST>().VisitExprs(func);
-		break;
-	case LLIL_TAILCALL:
-		GetDestExpr<LLIL_TAILCALL>().VisitExprs(func);
-		break;
-	case LLIL_CALL_SSA:
-		GetDestExpr<LLIL_CALL_SSA>().VisitExprs(func);
-		for (auto i : GetParameterExprs<LLIL_CALL_SSA>())
-			i.VisitExprs(func);
-		break;
-	case LLIL_SYSCALL_SSA:
-		for (auto i : GetParameterExprs<LLIL_SYSCALL_SSA>())
-			i.VisitExprs(func);
-		break;
-	case LLIL_TAILCALL_SSA:
-		GetDestExpr<LLIL_TAILCALL_SSA>().VisitExprs(func);
-		for (auto i : GetParameterExprs<LLIL_TAILCALL_SSA>())
-			i.VisitExprs(func);
-		break;
-	case LLIL_RET:
-		GetDestExpr<LLIL_RET>().VisitExprs(func);
-		break;
-	case LLIL_PUSH:
-	case LLIL_NEG:
-	case LLIL_NOT:
-	case LLIL_SX:
-	case LLIL_ZX:
-	case LLIL_LOW_PART:
-	case LLIL_BOOL_TO_INT:
-	case LLIL_UNIMPL_MEM:
-	case LLIL_FSQRT:
-	case LLIL_FNEG:
-	case LLIL_FABS:
-	case LLIL_FLOAT_TO_INT:
-	case LLIL_INT_TO_FLOAT:
-	case LLIL_FLOAT_CONV:
-	case LLIL_ROUND_TO_INT:
-	case LLIL_FLOOR:
-	case LLIL_CEIL:
-	case LLIL_FTRUNC:
-		AsOneOperand().GetSourceExpr().VisitExprs(func);
-		break;
-	case LLIL_ADD:
-	case LLIL_SUB:
-	case LLIL_AND:
-	case LLIL_OR:
-	case LLIL_XOR:
-	case LLIL_LSL:
-	case LLIL_LSR:
-	case LLIL_ASR:
-	case LLIL_ROL:
-	case LLIL_ROR:
-	case LLIL_MUL:
-	case LLIL_MULU_DP:
-	case LLIL_MULS_DP:
-	case LLIL_DIVU:
-	case LLIL_DIVS:
-	case LLIL_MODU:
-	case LLIL_MODS:
-	case LLIL_DIVU_DP:
-	case LLIL_DIVS_DP:
-	case LLIL_MODU_DP:
-	case LLIL_MODS_DP:
-	case LLIL_CMP_E:
-	case LLIL_CMP_NE:
-	case LLIL_CMP_SLT:
-	case LLIL_CMP_ULT:
-	case LLIL_CMP_SLE:
-	case LLIL_CMP_ULE:
-	case LLIL_CMP_SGE:
-	case LLIL_CMP_UGE:
-	case LLIL_CMP_SGT:
-	case LLIL_CMP_UGT:
-	case LLIL_TEST_BIT:
-	case LLIL_ADD_OVERFLOW:
-	case LLIL_FADD:
-	case LLIL_FSUB:
-	case LLIL_FMUL:
-	case LLIL_FDIV:
-	case LLIL_FCMP_E:
-	case LLIL_FCMP_NE:
-	case LLIL_FCMP_LT:
-	case LLIL_FCMP_LE:
-	case LLIL_FCMP_GE:
-	case LLIL_FCMP_GT:
-	case LLIL_FCMP_O:
-	case LLIL_FCMP_UO:
-		AsTwoOperand().GetLeftExpr().VisitExprs(func);
-		AsTwoOperand().GetRightExpr().VisitExprs(func);
-		break;
-	case LLIL_ADC:
-	case LLIL_SBB:
-	case LLIL_RLC:
-	case LLIL_RRC:
-		AsTwoOperandWithCarry().GetLeftExpr().VisitExprs(func);
-		AsTwoOperandWithCarry().GetRightExpr().VisitExprs(func);
-		AsTwoOperandWithCarry().GetCarryExpr().VisitExprs(func);
-		break;
-	case LLIL_INTRINSIC:
-		for (auto i : GetParameterExprs<LLIL_INTRINSIC>())
-			i.VisitExprs(func);
-		break;
-	case LLIL_INTRINSIC_SSA:
-		for (auto i : GetParameterExprs<LLIL_INTRINSIC_SSA>())
-			i.VisitExprs(func);
-		break;
-	case LLIL_MEMORY_INTRINSIC_SSA:
-		for (auto i : GetParameterExprs<LLIL_MEMORY_INTRINSIC_SSA>())
-			i.VisitExprs(func);
-		break;
-	case LLIL_SEPARATE_PARAM_LIST_SSA:
-		for (auto i : GetParameterExprs<LLIL_SEPARATE_PARAM_LIST_SSA>())
-			i.VisitExprs(func);
-		break;
-	case LLIL_SHARED_PARAM_SLOT_SSA:
-		for (auto i : GetParameterExprs<LLIL_SHARED_PARAM_SLOT_SSA>())
-			i.VisitExprs(func);
-		break;
-	default:
-		break;
-	}
+	WalkExprs(func);
 }
 
 
@@ -2353,13 +1935,10 @@ ExprId LowLevelILInstruction::CopyTo(
 
 bool LowLevelILInstruction::GetOperandIndexForUsage(LowLevelILOperandUsage usage, size_t& operandIndex) const
 {
-	auto operationIter = LowLevelILInstructionBase::operationOperandIndex.find(operation);
-	if (operationIter == LowLevelILInstructionBase::operationOperandIndex.end())
-		return false;
-	auto usageIter = operationIter->second.find(usage);
-	if (usageIter == operationIter->second.end())
+	size_t index = GetLowLevelILOperandIndex(operation, usage);
+	if (index == LowLevelILInvalidOperandIndex)
 		return false;
-	operandIndex = usageIter->second;
+	operandIndex = index;
 	return true;
 }
 
@@ -21,6 +21,7 @@
 #pragma once
 
 #include <functional>
+#include <initializer_list>
 #include <unordered_map>
 #include <vector>
 #ifdef BINARYNINJACORE_LIBRARY
@@ -28,6 +29,7 @@
 #else
 	#include "binaryninjaapi.h"
 #endif
+#include "ilwalk.h"
 
 #ifdef BINARYNINJACORE_LIBRARY
 namespace BinaryNinjaCore
@@ -246,6 +248,344 @@ namespace BinaryNinja
 		RegisterStackAdjustmentsLowLevelOperandUsage,
 		OffsetLowLevelOperandUsage
 	};
+
+	/*!
+		\ingroup lowlevelil
+	*/
+	struct LowLevelILOperandUsageType
+	{
+		LowLevelILOperandUsage usage;
+		LowLevelILOperandType type;
+	};
+
+	/*!
+		\ingroup lowlevelil
+	*/
+	struct LowLevelILOperationOperandUsages
+	{
+		BNLowLevelILOperation operation;
+		std::initializer_list<LowLevelILOperandUsage> usages;
+	};
+
+	// Operand layout of every operation. The lookup maps in LowLevelILInstructionBase and the dense
+	// tables below are both derived from these.
+	inline constexpr LowLevelILOperandUsageType LowLevelILOperandTypeForUsage[] = {
+		{SourceExprLowLevelOperandUsage, ExprLowLevelOperand},
+		{SourceRegisterLowLevelOperandUsage, RegisterLowLevelOperand},
+		{SourceRegisterStackLowLevelOperandUsage, RegisterStackLowLevelOperand},
+		{SourceFlagLowLevelOperandUsage, FlagLowLevelOperand},
+		{SourceSSARegisterLowLevelOperandUsage, SSARegisterLowLevelOperand},
+		{SourceSSARegisterStackLowLevelOperandUsage, SSARegisterStackLowLevelOperand},
+		{SourceSSAFlagLowLevelOperandUsage, SSAFlagLowLevelOperand},
+		{DestExprLowLevelOperandUsage, ExprLowLevelOperand},
+		{DestRegisterLowLevelOperandUsage, RegisterLowLevelOperand},
+		{DestRegisterStackLowLevelOperandUsage, RegisterStackLowLevelOperand},
+		{DestFlagLowLevelOperandUsage, FlagLowLevelOperand},
+		{DestSSARegisterLowLevelOperandUsage, SSARegisterLowLevelOperand},
+		{DestSSARegisterStackLowLevelOperandUsage, SSARegisterStackLowLevelOperand},
+		{DestSSAFlagLowLevelOperandUsage, SSAFlagLowLevelOperand},
+		{SemanticFlagClassLowLevelOperandUsage, SemanticFlagClassLowLevelOperand},
+		{SemanticFlagGroupLowLevelOperandUsage, SemanticFlagGroupLowLevelOperand},
+		{PartialRegisterLowLevelOperandUsage, RegisterLowLevelOperand},
+		{PartialSSARegisterStackSourceLowLevelOperandUsage, SSARegisterStackLowLevelOperand},
+		{StackSSARegisterLowLevelOperandUsage, SSARegisterLowLevelOperand},
+		{StackMemoryVersionLowLevelOperandUsage, IndexLowLevelOperand},
+		{TopSSARegisterLowLevelOperandUsage, SSARegisterLowLevelOperand},
+		{LeftExprLowLevelOperandUsage, ExprLowLevelOperand},
+		{RightExprLowLevelOperandUsage, ExprLowLevelOperand},
+		{CarryExprLowLevelOperandUsage, ExprLowLevelOperand},
+		{ConditionExprLowLevelOperandUsage, ExprLowLevelOperand},
+		{HighRegisterLowLevelOperandUsage, RegisterLowLevelOperand},
+		{HighSSARegisterLowLevelOperandUsage, SSARegisterLowLevelOperand},
+		{LowRegisterLowLevelOperandUsage, RegisterLowLevelOperand},
+		{LowSSARegisterLowLevelOperandUsage, SSARegisterLowLevelOperand},
+		{IntrinsicLowLevelOperandUsage, IntrinsicLowLevelOperand},
+		{ConstantLowLevelOperandUsage, IntegerLowLevelOperand},
+		{VectorLowLevelOperandUsage, IntegerLowLevelOperand},
+		{StackAdjustmentLowLevelOperandUsage, IntegerLowLevelOperand},
+		{TargetLowLevelOperandUsage, IndexLowLevelOperand},
+		{TrueTargetLowLevelOperandUsage, IndexLowLevelOperand},
+		{FalseTargetLowLevelOperandUsage, IndexLowLevelOperand},
+		{BitIndexLowLevelOperandUsage, IndexLowLevelOperand},
+		{SourceMemoryVersionLowLevelOperandUsage, IndexLowLevelOperand},
+		{DestMemoryVersionLowLevelOperandUsage, IndexLowLevelOperand},
+		{FlagConditionLowLevelOperandUsage, FlagConditionLowLevelOperand},
+		{OutputSSARegistersLowLevelOperandUsage, SSARegisterListLowLevelOperand},
+		{OutputMemoryVersionLowLevelOperandUsage, IndexLowLevelOperand},
+		{ParameterExprsLowLevelOperandUsage, ExprListLowLevelOperand},
+		{SourceSSARegistersLowLevelOperandUsage, SSARegisterListLowLevelOperand},
+		{SourceSSARegisterStacksLowLevelOperandUsage, SSARegisterStackListLowLevelOperand},
+		{SourceSSAFlagsLowLevelOperandUsage, SSAFlagListLowLevelOperand},
+		{OutputRegisterOrFlagListLowLevelOperandUsage, RegisterOrFlagListLowLevelOperand},
+		{OutputSSARegisterOrFlagListLowLevelOperandUsage, SSARegisterOrFlagListLowLevelOperand},
+		{OutputMemoryIntrinsicLowLevelOperandUsage, SSARegisterOrFlagListLowLevelOperand},
+		{SourceMemoryVersionsLowLevelOperandUsage, IndexListLowLevelOperand},
+		{TargetsLowLevelOperandUsage, IndexMapLowLevelOperand},
+		{RegisterStackAdjustmentsLowLevelOperandUsage, RegisterStackAdjustmentsLowLevelOperand},
+		{OffsetLowLevelOperandUsage, IntegerLowLevelOperand}
+	};
+
+	inline constexpr LowLevelILOperationOperandUsages LowLevelILOperationOperandUsage[] = {
+		{LLIL_NOP, {}},
+		{LLIL_POP, {}},
+		{LLIL_NORET, {}},
+		{LLIL_SYSCALL, {}},
+		{LLIL_BP, {}},
+		{LLIL_UNDEF, {}},
+		{LLIL_UNIMPL, {}},
+		{LLIL_SET_REG, {DestRegisterLowLevelOperandUsage, SourceExprLowLevelOperandUsage}},
+		{LLIL_SET_REG_SPLIT,
+			{HighRegisterLowLevelOperandUsage, LowRegisterLowLevelOperandUsage, SourceExprLowLevelOperandUsage}},
+		{LLIL_SET_REG_SSA, {DestSSARegisterLowLevelOperandUsage, SourceExprLowLevelOperandUsage}},
+		{LLIL_SET_REG_SSA_PARTIAL,
+			{DestSSARegisterLowLevelOperandUsage, PartialRegisterLowLevelOperandUsage, SourceExprLowLevelOperandUsage}},
+		{LLIL_SET_REG_SPLIT_SSA,
+			{HighSSARegisterLowLevelOperandUsage, LowSSARegisterLowLevelOperandUsage, SourceExprLowLevelOperandUsage}},
+		{LLIL_SET_REG_STACK_REL,
+			{DestRegisterStackLowLevelOperandUsage, DestExprLowLevelOperandUsage, SourceExprLowLevelOperandUsage}},
+		{LLIL_REG_STACK_PUSH, {DestRegisterStackLowLevelOperandUsage, SourceExprLowLevelOperandUsage}},
+		{LLIL_SET_REG_STACK_REL_SSA,
+			{DestSSARegisterStackLowLevelOperandUsage, PartialSSARegisterStackSourceLowLevelOperandUsage,
+				DestExprLowLevelOperandUsage, TopSSARegisterLowLevelOperandUsage, SourceExprLowLevelOperandUsage}},
+		{LLIL_SET_REG_STACK_ABS_SSA,
+			{DestSSARegisterStackLowLevelOperandUsage, PartialSSARegisterStackSourceLowLevelOperandUsage,
+				DestRegisterLowLevelOperandUsage, SourceExprLowLevelOperandUsage}},
+		{LLIL_SET_FLAG, {DestFlagLowLevelOperandUsage, SourceExprLowLevelOperandUsage}},
+		{LLIL_SET_FLAG_SSA, {DestSSAFlagLowLevelOperandUsage, SourceExprLowLevelOperandUsage}},
+		{LLIL_LOAD, {SourceExprLowLevelOperandUsage}},
+		{LLIL_LOAD_SSA, {SourceExprLowLevelOperandUsage, SourceMemoryVersionLowLevelOperandUsage}},
+		{LLIL_STORE, {DestExprLowLevelOperandUsage, SourceExprLowLevelOperandUsage}},
+		{LLIL_STORE_SSA,
+			{DestExprLowLevelOperandUsage, DestMemoryVersionLowLevelOperandUsage,
+				SourceMemoryVersionLowLevelOperandUsage, SourceExprLowLevelOperandUsage}},
+		{LLIL_REG, {SourceRegisterLowLevelOperandUsage}},
+		{LLIL_REG_SSA, {SourceSSARegisterLowLevelOperandUsage}},
+		{LLIL_REG_SSA_PARTIAL, {SourceSSARegisterLowLevelOperandUsage, PartialRegisterLowLevelOperandUsage}},
+		{LLIL_REG_SPLIT, {HighRegisterLowLevelOperandUsage, LowRegisterLowLevelOperandUsage}},
+		{LLIL_REG_SPLIT_SSA, {HighSSARegisterLowLevelOperandUsage, LowSSARegisterLowLevelOperandUsage}},
+		{LLIL_REG_STACK_REL, {SourceRegisterStackLowLevelOperandUsage, SourceExprLowLevelOperandUsage}},
+		{LLIL_REG_STACK_POP, {SourceRegisterStackLowLevelOperandUsage}},
+		{LLIL_REG_STACK_FREE_REG, {DestRegisterLowLevelOperandUsage}},
+		{LLIL_REG_STACK_FREE_REL, {DestRegisterStackLowLevelOperandUsage, DestExprLowLevelOperandUsage}},
+		{LLIL_REG_STACK_REL_SSA,
+			{SourceSSARegisterStackLowLevelOperandUsage, TopSSARegisterLowLevelOperandUsage,
+				SourceExprLowLevelOperandUsage}},
+		{LLIL_REG_STACK_ABS_SSA, {SourceSSARegisterStackLowLevelOperandUsage, SourceRegisterLowLevelOperandUsage}},
+		{LLIL_REG_STACK_FREE_REL_SSA,
+			{DestSSARegisterStackLowLevelOperandUsage, PartialSSARegisterStackSourceLowLevelOperandUsage,
+				DestExprLowLevelOperandUsage, TopSSARegisterLowLevelOperandUsage}},
+		{LLIL_REG_STACK_FREE_ABS_SSA,
+			{DestSSARegisterStackLowLevelOperandUsage, PartialSSARegisterStackSourceLowLevelOperandUsage,
+				DestRegisterLowLevelOperandUsage}},
+		{LLIL_FLAG, {SourceFlagLowLevelOperandUsage}},
+		{LLIL_FLAG_BIT, {SourceFlagLowLevelOperandUsage, BitIndexLowLevelOperandUsage}},
+		{LLIL_FLAG_SSA, {SourceSSAFlagLowLevelOperandUsage}},
+		{LLIL_FLAG_BIT_SSA, {SourceSSAFlagLowLevelOperandUsage, BitIndexLowLevelOperandUsage}},
+		{LLIL_JUMP, {DestExprLowLevelOperandUsage}},
+		{LLIL_JUMP_TO, {DestExprLowLevelOperandUsage, TargetsLowLevelOperandUsage}},
+		{LLIL_CALL, {DestExprLowLevelOperandUsage}},
+		{LLIL_CALL_STACK_ADJUST,
+			{DestExprLowLevelOperandUsage, StackAdjustmentLowLevelOperandUsage,
+				RegisterStackAdjustmentsLowLevelOperandUsage}},
+		{LLIL_TAILCALL, {DestExprLowLevelOperandUsage}},
+		{LLIL_RET, {DestExprLowLevelOperandUsage}},
+		{LLIL_IF, {ConditionExprLowLevelOperandUsage, TrueTargetLowLevelOperandUsage, FalseTargetLowLevelOperandUsage}},
+		{LLIL_GOTO, {TargetLowLevelOperandUsage}},
+		{LLIL_FLAG_COND, {FlagConditionLowLevelOperandUsage, SemanticFlagClassLowLevelOperandUsage}},
+		{LLIL_FLAG_GROUP, {SemanticFlagGroupLowLevelOperandUsage}},
+		{LLIL_TRAP, {VectorLowLevelOperandUsage}},
+		{LLIL_CALL_SSA,
+			{OutputSSARegistersLowLevelOperandUsage, OutputMemoryVersionLowLevelOperandUsage,
+				DestExprLowLevelOperandUsage, StackSSARegisterLowLevelOperandUsage,
+				StackMemoryVersionLowLevelOperandUsage, ParameterExprsLowLevelOperandUsage}},
+		{LLIL_SYSCALL_SSA,
+			{OutputSSARegistersLowLevelOperandUsage, OutputMemoryVersionLowLevelOperandUsage,
+				StackSSARegisterLowLevelOperandUsage, StackMemoryVersionLowLevelOperandUsage,
+				ParameterExprsLowLevelOperandUsage}},
+		{LLIL_TAILCALL_SSA,
+			{OutputSSARegistersLowLevelOperandUsage, OutputMemoryVersionLowLevelOperandUsage,
+				DestExprLowLevelOperandUsage, StackSSARegisterLowLevelOperandUsage,
+				StackMemoryVersionLowLevelOperandUsage, ParameterExprsLowLevelOperandUsage}},
+		{LLIL_SEPARATE_PARAM_LIST_SSA, {ParameterExprsLowLevelOperandUsage}},
+		{LLIL_SHARED_PARAM_SLOT_SSA, {ParameterExprsLowLevelOperandUsage}},
+		{LLIL_REG_PHI, {DestSSARegisterLowLevelOperandUsage, SourceSSARegistersLowLevelOperandUsage}},
+		{LLIL_REG_STACK_PHI, {DestSSARegisterStackLowLevelOperandUsage, SourceSSARegisterStacksLowLevelOperandUsage}},
+		{LLIL_FLAG_PHI, {DestSSAFlagLowLevelOperandUsage, SourceSSAFlagsLowLevelOperandUsage}},
+		{LLIL_MEM_PHI, {DestMemoryVersionLowLevelOperandUsage, SourceMemoryVersionsLowLevelOperandUsage}},
+		{LLIL_CONST, {ConstantLowLevelOperandUsage}},
+		{LLIL_CONST_PTR, {ConstantLowLevelOperandUsage}},
+		{LLIL_EXTERN_PTR, {ConstantLowLevelOperandUsage, OffsetLowLevelOperandUsage}},
+		{LLIL_FLOAT_CONST, {ConstantLowLevelOperandUsage}},
+		{LLIL_ADD, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_SUB, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_AND, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_OR, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_XOR, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_LSL, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_LSR, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_ASR, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_ROL, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_ROR, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_MUL, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_MULU_DP, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_MULS_DP, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_DIVU, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_DIVS, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_MODU, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_MODS, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_CMP_E, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_CMP_NE, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_CMP_SLT, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_CMP_ULT, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_CMP_SLE, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_CMP_ULE, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_CMP_SGE, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_CMP_UGE, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_CMP_SGT, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_CMP_UGT, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_TEST_BIT, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_ADD_OVERFLOW, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_ADC, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage, CarryExprLowLevelOperandUsage}},
+		{LLIL_SBB, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage, CarryExprLowLevelOperandUsage}},
+		{LLIL_RLC, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage, CarryExprLowLevelOperandUsage}},
+		{LLIL_RRC, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage, CarryExprLowLevelOperandUsage}},
+		{LLIL_DIVU_DP, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_DIVS_DP, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_MODU_DP, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_MODS_DP, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_PUSH, {SourceExprLowLevelOperandUsage}},
+		{LLIL_NEG, {SourceExprLowLevelOperandUsage}},
+		{LLIL_NOT, {SourceExprLowLevelOperandUsage}},
+		{LLIL_SX, {SourceExprLowLevelOperandUsage}},
+		{LLIL_ZX, {SourceExprLowLevelOperandUsage}},
+		{LLIL_LOW_PART, {SourceExprLowLevelOperandUsage}},
+		{LLIL_BOOL_TO_INT, {SourceExprLowLevelOperandUsage}},
+		{LLIL_INTRINSIC,
+			{OutputRegisterOrFlagListLowLevelOperandUsage, IntrinsicLowLevelOperandUsage,
+				ParameterExprsLowLevelOperandUsage}},
+		{LLIL_INTRINSIC_SSA,
+			{OutputSSARegisterOrFlagListLowLevelOperandUsage, IntrinsicLowLevelOperandUsage,
+				ParameterExprsLowLevelOperandUsage}},
+		{LLIL_MEMORY_INTRINSIC_SSA,
+			{OutputMemoryIntrinsicLowLevelOperandUsage, OutputMemoryVersionLowLevelOperandUsage,
+				IntrinsicLowLevelOperandUsage, ParameterExprsLowLevelOperandUsage,
+				SourceMemoryVersionLowLevelOperandUsage}},
+		{LLIL_UNIMPL_MEM, {SourceExprLowLevelOperandUsage}},
+		{LLIL_FADD, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_FSUB, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_FMUL, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_FDIV, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_FSQRT, {SourceExprLowLevelOperandUsage}},
+		{LLIL_FNEG, {SourceExprLowLevelOperandUsage}},
+		{LLIL_FABS, {SourceExprLowLevelOperandUsage}},
+		{LLIL_FLOAT_TO_INT, {SourceExprLowLevelOperandUsage}},
+		{LLIL_INT_TO_FLOAT, {SourceExprLowLevelOperandUsage}},
+		{LLIL_FLOAT_CONV, {SourceExprLowLevelOperandUsage}},
+		{LLIL_ROUND_TO_INT, {SourceExprLowLevelOperandUsage}},
+		{LLIL_FLOOR, {SourceExprLowLevelOperandUsage}},
+		{LLIL_CEIL, {SourceExprLowLevelOperandUsage}},
+		{LLIL_FTRUNC, {SourceExprLowLevelOperandUsage}},
+		{LLIL_FCMP_E, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_FCMP_NE, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_FCMP_LT, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_FCMP_LE, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_FCMP_GE, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_FCMP_GT, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_FCMP_O, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}},
+		{LLIL_FCMP_UO, {LeftExprLowLevelOperandUsage, RightExprLowLevelOperandUsage}}
+	};
+
+	constexpr size_t LowLevelILOperationCount = LLIL_MEM_PHI + 1;
+	constexpr size_t LowLevelILOperandUsageCount = OffsetLowLevelOperandUsage + 1;
+	constexpr uint8_t LowLevelILInvalidOperandType = 0xff;
+	constexpr uint8_t LowLevelILInvalidOperandIndex = 0xff;
+
+	/*!
+		Dense operand lookup tables indexed by operation and operand usage, built at compile time
+		so that operand accessors do not need any hash lookups.
+
+		\ingroup lowlevelil
+	*/
+	struct LowLevelILOperandTables
+	{
+		uint8_t operandType[LowLevelILOperandUsageCount];
+		uint8_t operandIndex[LowLevelILOperationCount][LowLevelILOperandUsageCount];
+	};
+
+	constexpr LowLevelILOperandTables BuildLowLevelILOperandTables()
+	{
+		LowLevelILOperandTables result {};
+		for (auto& type : result.operandType)
+			type = LowLevelILInvalidOperandType;
+		for (auto& operation : result.operandIndex)
+			for (auto& index : operation)
+				index = LowLevelILInvalidOperandIndex;
+
+		for (auto& i : LowLevelILOperandTypeForUsage)
+			result.operandType[i.usage] = (uint8_t)i.type;
+
+		for (auto& i : LowLevelILOperationOperandUsage)
+		{
+			size_t operand = 0;
+			for (auto usage : i.usages)
+			{
+				result.operandIndex[i.operation][usage] = (uint8_t)operand;
+				switch (usage)
+				{
+				case HighSSARegisterLowLevelOperandUsage:
+				case LowSSARegisterLowLevelOperandUsage:
+				case PartialSSARegisterStackSourceLowLevelOperandUsage:
+				case TopSSARegisterLowLevelOperandUsage:
+					// Represented as subexpression, so only takes one slot even though it is an SSA register
+					operand++;
+					break;
+				case ParameterExprsLowLevelOperandUsage:
+					// Represented as a counted list at the start of the instruction, otherwise as a subexpression
+					operand += (operand == 0) ? 2 : 1;
+					break;
+				case OutputSSARegistersLowLevelOperandUsage:
+				case StackSSARegisterLowLevelOperandUsage:
+				case DestSSARegisterStackLowLevelOperandUsage:
+				case OutputMemoryIntrinsicLowLevelOperandUsage:
+					// The following usage shares the same operand
+					break;
+				default:
+					switch (result.operandType[usage])
+					{
+					case SSARegisterLowLevelOperand:
+					case SSARegisterStackLowLevelOperand:
+					case SSAFlagLowLevelOperand:
+					case IndexListLowLevelOperand:
+					case IndexMapLowLevelOperand:
+					case SSARegisterListLowLevelOperand:
+					case SSARegisterStackListLowLevelOperand:
+					case SSAFlagListLowLevelOperand:
+					case RegisterStackAdjustmentsLowLevelOperand:
+					case RegisterOrFlagListLowLevelOperand:
+					case SSARegisterOrFlagListLowLevelOperand:
+						// SSA registers/flags and lists take two operand slots
+						operand += 2;
+						break;
+					default:
+						operand++;
+						break;
+					}
+					break;
+				}
+			}
+		}
+		return result;
+	}
+
+	inline constexpr LowLevelILOperandTables LowLevelILOperandTable = BuildLowLevelILOperandTables();
+
+	// Returns LowLevelILInvalidOperandIndex if the operation does not have an operand with the given usage
+	constexpr size_t GetLowLevelILOperandIndex(BNLowLevelILOperation operation, LowLevelILOperandUsage usage)
+	{
+		if (((size_t)operation >= LowLevelILOperationCount) || ((size_t)usage >= LowLevelILOperandUsageCount))
+			return LowLevelILInvalidOperandIndex;
+		return LowLevelILOperandTable.operandIndex[operation][usage];
+	}
 }  // namespace BinaryNinjaCore
 
 namespace std {
@@ -815,6 +1155,19 @@ namespace BinaryNinja
 
 		void VisitExprs(const std::function<bool(const LowLevelILInstruction& expr)>& func) const;
 
+		// Calls func with each direct sub-expression, in the order VisitExprs visits them
+		template <typename T>
+		void ForEachSubExpr(T&& func) const;
+
+		// Visits this expression and its sub-expressions without recursion or std::function dispatch.
+		// preFunc is called before and postFunc after the sub-expressions of an expression are visited.
+		// Callbacks return an ILWalkAction or bool (false skips the sub-expressions, like VisitExprs),
+		// postFunc may also return void. Returns false if a callback stopped the walk.
+		template <typename PreFunc>
+		bool WalkExprs(PreFunc&& preFunc) const;
+		template <typename PreFunc, typename PostFunc>
+		bool WalkExprs(PreFunc&& preFunc, PostFunc&& postFunc) const;
+
 		ExprId CopyTo(LowLevelILFunction* dest) const;
 		ExprId CopyTo(LowLevelILFunction* dest,
 		    const std::function<ExprId(const LowLevelILInstruction& subExpr)>& subExprHandler) const;
@@ -1250,6 +1603,123 @@ namespace BinaryNinja
 		operator _STD_VECTOR<LowLevelILOperand>() const;
 	};
 
+#ifndef BINARYNINJACORE_LIBRARY
+	class LowLevelILExprSnapshot;
+
+	/*!
+		A single expression within a LowLevelILExprSnapshot. Reads directly from the snapshot
+		columns, call GetInstruction to obtain a full LowLevelILInstruction when needed.
+
+		\ingroup lowlevelil
+	*/
+	class LowLevelILSnapshotExpr
+	{
+		const LowLevelILExprSnapshot* m_snapshot;
+		size_t m_exprIndex;
+
+	  public:
+		LowLevelILSnapshotExpr(const LowLevelILExprSnapshot* snapshot, size_t expr) :
+		    m_snapshot(snapshot), m_exprIndex(expr)
+		{}
+
+		size_t GetExprIndex() const { return m_exprIndex; }
+		inline BNLowLevelILOperation GetOperation() const;
+		inline uint32_t GetAttributes() const;
+		inline size_t GetSize() const;
+		inline uint32_t GetFlags() const;
+		inline uint32_t GetSourceOperand() const;
+		inline uint64_t GetAddress() const;
+		inline uint64_t GetRawOperand(size_t operand) const;
+
+		BNLowLevelILInstruction GetRawExpr() const;
+		LowLevelILInstruction GetInstruction() const;
+	};
+
+	/*!
+		Copy of every expression of a LowLevelILFunction, stored as one contiguous array per field.
+		Scanning a snapshot avoids constructing a LowLevelILInstruction (and the associated
+		reference counting) for every expression of the function.
+
+		\ingroup lowlevelil
+	*/
+	class LowLevelILExprSnapshot
+	{
+		struct ListIterator
+		{
+			const LowLevelILExprSnapshot* owner;
+			size_t index;
+			bool operator==(const ListIterator& a) const { return index == a.index; }
+			bool operator!=(const ListIterator& a) const { return index != a.index; }
+			bool operator<(const ListIterator& a) const { return index < a.index; }
+			ListIterator& operator++()
+			{
+				++index;
+				return *this;
+			}
+			LowLevelILSnapshotExpr operator*() const { return LowLevelILSnapshotExpr(owner, index); }
+		};
+
+		Ref<LowLevelILFunction> m_function;
+		std::vector<BNLowLevelILOperation> m_operations;
+		std::vector<uint32_t> m_attributes;
+		std::vector<size_t> m_sizes;
+		std::vector<uint32_t> m_flags;
+		std::vector<uint32_t> m_sourceOperands;
+		std::vector<uint64_t> m_addresses;
+		std::vector<uint64_t> m_operands[4];
+
+	  public:
+		typedef ListIterator const_iterator;
+
+		LowLevelILExprSnapshot(LowLevelILFunction* func);
+
+		LowLevelILFunction* GetFunction() const { return m_function; }
+
+		const_iterator begin() const { return const_iterator {this, 0}; }
+		const_iterator end() const { return const_iterator {this, m_operations.size()}; }
+		size_t size() const { return m_operations.size(); }
+		LowLevelILSnapshotExpr operator[](size_t i) const { return LowLevelILSnapshotExpr(this, i); }
+
+		// Column access, each array has size() entries indexed by expression index
+		const BNLowLevelILOperation* GetOperations() const { return m_operations.data(); }
+		const uint32_t* GetAttributes() const { return m_attributes.data(); }
+		const size_t* GetSizes() const { return m_sizes.data(); }
+		const uint32_t* GetFlags() const { return m_flags.data(); }
+		const uint32_t* GetSourceOperands() const { return m_sourceOperands.data(); }
+		const uint64_t* GetAddresses() const { return m_addresses.data(); }
+		const uint64_t* GetOperands(size_t operand) const { return m_operands[operand].data(); }
+	};
+
+	BNLowLevelILOperation LowLevelILSnapshotExpr::GetOperation() const
+	{
+		return m_snapshot->GetOperations()[m_exprIndex];
+	}
+	uint32_t LowLevelILSnapshotExpr::GetAttributes() const
+	{
+		return m_snapshot->GetAttributes()[m_exprIndex];
+	}
+	size_t LowLevelILSnapshotExpr::GetSize() const
+	{
+		return m_snapshot->GetSizes()[m_exprIndex];
+	}
+	uint32_t LowLevelILSnapshotExpr::GetFlags() const
+	{
+		return m_snapshot->GetFlags()[m_exprIndex];
+	}
+	uint32_t LowLevelILSnapshotExpr::GetSourceOperand() const
+	{
+		return m_snapshot->GetSourceOperands()[m_exprIndex];
+	}
+	uint64_t LowLevelILSnapshotExpr::GetAddress() const
+	{
+		return m_snapshot->GetAddresses()[m_exprIndex];
+	}
+	uint64_t LowLevelILSnapshotExpr::GetRawOperand(size_t operand) const
+	{
+		return m_snapshot->GetOperands(operand)[m_exprIndex];
+	}
+#endif
+
 	struct LowLevelILConstantInstruction : public LowLevelILInstructionBase
 	{
 		int64_t GetConstant() const { return GetRawOperandAsInteger(0); }
@@ -2005,6 +2475,221 @@ namespace BinaryNinja
 	template <>
 	struct LowLevelILInstructionAccessor<LLIL_FTRUNC> : public LowLevelILOneOperandInstruction
 	{};
+	template <typename T>
+	void LowLevelILInstruction::ForEachSubExpr(T&& func) const
+	{
+		switch (operation)
+		{
+		case LLIL_SET_REG:
+			func(GetSourceExpr<LLIL_SET_REG>());
+			break;
+		case LLIL_SET_REG_SPLIT:
+			func(GetSourceExpr<LLIL_SET_REG_SPLIT>());
+			break;
+		case LLIL_SET_REG_SSA:
+			func(GetSourceExpr<LLIL_SET_REG_SSA>());
+			break;
+		case LLIL_SET_REG_SSA_PARTIAL:
+			func(GetSourceExpr<LLIL_SET_REG_SSA_PARTIAL>());
+			break;
+		case LLIL_SET_REG_SPLIT_SSA:
+			func(GetSourceExpr<LLIL_SET_REG_SPLIT_SSA>());
+			break;
+		case LLIL_SET_REG_STACK_REL:
+			func(GetDestExpr<LLIL_SET_REG_STACK_REL>());
+			func(GetSourceExpr<LLIL_SET_REG_STACK_REL>());
+			break;
+		case LLIL_REG_STACK_PUSH:
+			func(GetSourceExpr<LLIL_REG_STACK_PUSH>());
+			break;
+		case LLIL_SET_REG_STACK_REL_SSA:
+			func(GetDestExpr<LLIL_SET_REG_STACK_REL_SSA>());
+			func(GetSourceExpr<LLIL_SET_REG_STACK_REL_SSA>());
+			break;
+		case LLIL_SET_REG_STACK_ABS_SSA:
+			func(GetSourceExpr<LLIL_SET_REG_STACK_ABS_SSA>());
+			break;
+		case LLIL_SET_FLAG:
+			func(GetSourceExpr<LLIL_SET_FLAG>());
+			break;
+		case LLIL_SET_FLAG_SSA:
+			func(GetSourceExpr<LLIL_SET_FLAG_SSA>());
+			break;
+		case LLIL_REG_STACK_REL:
+			func(GetSourceExpr<LLIL_REG_STACK_REL>());
+			break;
+		case LLIL_REG_STACK_FREE_REL:
+			func(GetDestExpr<LLIL_REG_STACK_FREE_REL>());
+			break;
+		case LLIL_REG_STACK_REL_SSA:
+			func(GetSourceExpr<LLIL_REG_STACK_REL_SSA>());
+			break;
+		case LLIL_REG_STACK_FREE_REL_SSA:
+			func(GetDestExpr<LLIL_REG_STACK_FREE_REL_SSA>());
+			break;
+		case LLIL_LOAD:
+			func(GetSourceExpr<LLIL_LOAD>());
+			break;
+		case LLIL_LOAD_SSA:
+			func(GetSourceExpr<LLIL_LOAD_SSA>());
+			break;
+		case LLIL_STORE:
+			func(GetDestExpr<LLIL_STORE>());
+			func(GetSourceExpr<LLIL_STORE>());
+			break;
+		case LLIL_STORE_SSA:
+			func(GetDestExpr<LLIL_STORE_SSA>());
+			func(GetSourceExpr<LLIL_STORE_SSA>());
+			break;
+		case LLIL_JUMP:
+			func(GetDestExpr<LLIL_JUMP>());
+			break;
+		case LLIL_JUMP_TO:
+			func(GetDestExpr<LLIL_JUMP_TO>());
+			break;
+		case LLIL_IF:
+			func(GetConditionExpr<LLIL_IF>());
+			break;
+		case LLIL_CALL:
+			func(GetDestExpr<LLIL_CALL>());
+			break;
+		case LLIL_CALL_STACK_ADJUST:
+			func(GetDestExpr<LLIL_CALL_STACK_ADJUST>());
+			break;
+		case LLIL_TAILCALL:
+			func(GetDestExpr<LLIL_TAILCALL>());
+			break;
+		case LLIL_CALL_SSA:
+			func(GetDestExpr<LLIL_CALL_SSA>());
+			for (auto i : GetParameterExprs<LLIL_CALL_SSA>())
+				func(i);
+			break;
+		case LLIL_SYSCALL_SSA:
+			for (auto i : GetParameterExprs<LLIL_SYSCALL_SSA>())
+				func(i);
+			break;
+		case LLIL_TAILCALL_SSA:
+			func(GetDestExpr<LLIL_TAILCALL_SSA>());
+			for (auto i : GetParameterExprs<LLIL_TAILCALL_SSA>())
+				func(i);
+			break;
+		case LLIL_RET:
+			func(GetDestExpr<LLIL_RET>());
+			break;
+		case LLIL_PUSH:
+		case LLIL_NEG:
+		case LLIL_NOT:
+		case LLIL_SX:
+		case LLIL_ZX:
+		case LLIL_LOW_PART:
+		case LLIL_BOOL_TO_INT:
+		case LLIL_UNIMPL_MEM:
+		case LLIL_FSQRT:
+		case LLIL_FNEG:
+		case LLIL_FABS:
+		case LLIL_FLOAT_TO_INT:
+		case LLIL_INT_TO_FLOAT:
+		case LLIL_FLOAT_CONV:
+		case LLIL_ROUND_TO_INT:
+		case LLIL_FLOOR:
+		case LLIL_CEIL:
+		case LLIL_FTRUNC:
+			func(AsOneOperand().GetSourceExpr());
+			break;
+		case LLIL_ADD:
+		case LLIL_SUB:
+		case LLIL_AND:
+		case LLIL_OR:
+		case LLIL_XOR:
+		case LLIL_LSL:
+		case LLIL_LSR:
+		case LLIL_ASR:
+		case LLIL_ROL:
+		case LLIL_ROR:
+		case LLIL_MUL:
+		case LLIL_MULU_DP:
+		case LLIL_MULS_DP:
+		case LLIL_DIVU:
+		case LLIL_DIVS:
+		case LLIL_MODU:
+		case LLIL_MODS:
+		case LLIL_DIVU_DP:
+		case LLIL_DIVS_DP:
+		case LLIL_MODU_DP:
+		case LLIL_MODS_DP:
+		case LLIL_CMP_E:
+		case LLIL_CMP_NE:
+		case LLIL_CMP_SLT:
+		case LLIL_CMP_ULT:
+		case LLIL_CMP_SLE:
+		case LLIL_CMP_ULE:
+		case LLIL_CMP_SGE:
+		case LLIL_CMP_UGE:
+		case LLIL_CMP_SGT:
+		case LLIL_CMP_UGT:
+		case LLIL_TEST_BIT:
+		case LLIL_ADD_OVERFLOW:
+		case LLIL_FADD:
+		case LLIL_FSUB:
+		case LLIL_FMUL:
+		case LLIL_FDIV:
+		case LLIL_FCMP_E:
+		case LLIL_FCMP_NE:
+		case LLIL_FCMP_LT:
+		case LLIL_FCMP_LE:
+		case LLIL_FCMP_GE:
+		case LLIL_FCMP_GT:
+		case LLIL_FCMP_O:
+		case LLIL_FCMP_UO:
+			func(AsTwoOperand().GetLeftExpr());
+			func(AsTwoOperand().GetRightExpr());
+			break;
+		case LLIL_ADC:
+		case LLIL_SBB:
+		case LLIL_RLC:
+		case LLIL_RRC:
+			func(AsTwoOperandWithCarry().GetLeftExpr());
+			func(AsTwoOperandWithCarry().GetRightExpr());
+			func(AsTwoOperandWithCarry().GetCarryExpr());
+			break;
+		case LLIL_INTRINSIC:
+			for (auto i : GetParameterExprs<LLIL_INTRINSIC>())
+				func(i);
+			break;
+		case LLIL_INTRINSIC_SSA:
+			for (auto i : GetParameterExprs<LLIL_INTRINSIC_SSA>())
+				func(i);
+			break;
+		case LLIL_MEMORY_INTRINSIC_SSA:
+			for (auto i : GetParameterExprs<LLIL_MEMORY_INTRINSIC_SSA>())
+				func(i);
+			break;
+		case LLIL_SEPARATE_PARAM_LIST_SSA:
+			for (auto i : GetParameterExprs<LLIL_SEPARATE_PARAM_LIST_SSA>())
+				func(i);
+			break;
+		case LLIL_SHARED_PARAM_SLOT_SSA:
+			for (auto i : GetParameterExprs<LLIL_SHARED_PARAM_SLOT_SSA>())
+				func(i);
+			break;
+		default:
+			break;
+		}
+	}
+
+	template <typename PreFunc>
+	bool LowLevelILInstruction::WalkExprs(PreFunc&& preFunc) const
+	{
+		auto postFunc = [](const LowLevelILInstruction&) {};
+		return WalkILExprs<false>(*this, preFunc, postFunc);
+	}
+
+	template <typename PreFunc, typename PostFunc>
+	bool LowLevelILInstruction::WalkExprs(PreFunc&& preFunc, PostFunc&& postFunc) const
+	{
+		return WalkILExprs<true>(*this, preFunc, postFunc);
+	}
+
 #undef _STD_VECTOR
 #undef _STD_SET
 #undef _STD_UNORDERED_MAP
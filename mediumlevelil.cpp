@@ -279,6 +279,58 @@ size_t MediumLevelILFunction::GetExprCount() const
 }
 
 
+MediumLevelILExprSnapshot MediumLevelILFunction::GetExprSnapshot()
+{
+	return MediumLevelILExprSnapshot(this);
+}
+
+
+MediumLevelILExprSnapshot::MediumLevelILExprSnapshot(MediumLevelILFunction* func) : m_function(func)
+{
+	size_t count = func->GetExprCount();
+	m_operations.resize(count);
+	m_attributes.resize(count);
+	m_sizes.resize(count);
+	m_sourceOperands.resize(count);
+	m_addresses.resize(count);
+	for (auto& operands : m_operands)
+		operands.resize(count);
+
+	for (size_t i = 0; i < count; i++)
+	{
+		BNMediumLevelILInstruction instr = func->GetRawExpr(i);
+		m_operations[i] = instr.operation;
+		m_attributes[i] = instr.attributes;
+		m_sizes[i] = instr.size;
+		m_sourceOperands[i] = instr.sourceOperand;
+		m_addresses[i] = instr.address;
+		for (size_t j = 0; j < 5; j++)
+			m_operands[j][i] = instr.operands[j];
+	}
+}
+
+
+BNMediumLevelILInstruction MediumLevelILSnapshotExpr::GetRawExpr() const
+{
+	BNMediumLevelILInstruction result;
+	result.operation = GetOperation();
+	result.attributes = GetAttributes();
+	result.size = GetSize();
+	result.sourceOperand = GetSourceOperand();
+	result.address = GetAddress();
+	for (size_t i = 0; i < 5; i++)
+		result.operands[i] = GetRawOperand(i);
+	return result;
+}
+
+
+MediumLevelILInstruction MediumLevelILSnapshotExpr::GetInstruction() const
+{
+	MediumLevelILFunction* func = m_snapshot->GetFunction();
+	return MediumLevelILInstruction(func, GetRawExpr(), m_exprIndex, func->GetInstructionForExpr(m_exprIndex));
+}
+
+
 void MediumLevelILFunction::UpdateInstructionOperand(size_t i, size_t operandIndex, ExprId value)
 {
 	BNUpdateMediumLevelILOperand(m_object, i, operandIndex, value);
@@ -36,271 +36,55 @@ using namespace std;
 #endif
 
 
-unordered_map<MediumLevelILOperandUsage, MediumLevelILOperandType> MediumLevelILInstructionBase::operandTypeForUsage = {
-    {SourceExprMediumLevelOperandUsage, ExprMediumLevelOperand},
-    {SourceVariableMediumLevelOperandUsage, VariableMediumLevelOperand},
-    {SourceSSAVariableMediumLevelOperandUsage, SSAVariableMediumLevelOperand},
-    {PartialSSAVariableSourceMediumLevelOperandUsage, SSAVariableMediumLevelOperand},
-    {DestExprMediumLevelOperandUsage, ExprMediumLevelOperand},
-    {DestVariableMediumLevelOperandUsage, VariableMediumLevelOperand},
-    {DestSSAVariableMediumLevelOperandUsage, SSAVariableMediumLevelOperand},
-    {LeftExprMediumLevelOperandUsage, ExprMediumLevelOperand},
-    {RightExprMediumLevelOperandUsage, ExprMediumLevelOperand},
-    {CarryExprMediumLevelOperandUsage, ExprMediumLevelOperand},
-    {StackExprMediumLevelOperandUsage, ExprMediumLevelOperand},
-    {ConditionExprMediumLevelOperandUsage, ExprMediumLevelOperand},
-    {HighVariableMediumLevelOperandUsage, VariableMediumLevelOperand},
-    {LowVariableMediumLevelOperandUsage, VariableMediumLevelOperand},
-    {HighSSAVariableMediumLevelOperandUsage, VariableMediumLevelOperand},
-    {LowSSAVariableMediumLevelOperandUsage, VariableMediumLevelOperand},
-    {OffsetMediumLevelOperandUsage, IntegerMediumLevelOperand},
-    {ConstantMediumLevelOperandUsage, IntegerMediumLevelOperand},
-	 {ConstantDataMediumLevelOperandUsage, ConstantDataMediumLevelOperand},
-    {VectorMediumLevelOperandUsage, IntegerMediumLevelOperand},
-    {IntrinsicMediumLevelOperandUsage, IntrinsicMediumLevelOperand},
-    {TargetMediumLevelOperandUsage, IndexMediumLevelOperand},
-    {TrueTargetMediumLevelOperandUsage, IndexMediumLevelOperand},
-    {FalseTargetMediumLevelOperandUsage, IndexMediumLevelOperand},
-    {DestMemoryVersionMediumLevelOperandUsage, IndexMediumLevelOperand},
-    {SourceMemoryVersionMediumLevelOperandUsage, IndexMediumLevelOperand},
-    {TargetsMediumLevelOperandUsage, IndexMapMediumLevelOperand},
-    {SourceMemoryVersionsMediumLevelOperandUsage, IndexListMediumLevelOperand},
-    {OutputVariablesMediumLevelOperandUsage, VariableListMediumLevelOperand},
-    {OutputVariablesSubExprMediumLevelOperandUsage, VariableListMediumLevelOperand},
-    {OutputSSAVariablesMediumLevelOperandUsage, SSAVariableListMediumLevelOperand},
-    {OutputSSAVariablesSubExprMediumLevelOperandUsage, SSAVariableListMediumLevelOperand},
-    {OutputSSAMemoryVersionMediumLevelOperandUsage, IndexMediumLevelOperand},
-    {ParameterExprsMediumLevelOperandUsage, ExprListMediumLevelOperand},
-    {SourceExprsMediumLevelOperandUsage, ExprListMediumLevelOperand},
-    {UntypedParameterExprsMediumLevelOperandUsage, ExprListMediumLevelOperand},
-    {UntypedParameterSSAExprsMediumLevelOperandUsage, ExprListMediumLevelOperand},
-    {ParameterSSAMemoryVersionMediumLevelOperandUsage, IndexMediumLevelOperand},
-    {SourceSSAVariablesMediumLevelOperandUsages, SSAVariableListMediumLevelOperand}};
-
-
-unordered_map<BNMediumLevelILOperation, vector<MediumLevelILOperandUsage>>
-    MediumLevelILInstructionBase::operationOperandUsage = {{MLIL_NOP, {}}, {MLIL_NORET, {}}, {MLIL_BP, {}},
-        {MLIL_UNDEF, {}}, {MLIL_UNIMPL, {}},
-        {MLIL_SET_VAR, {DestVariableMediumLevelOperandUsage, SourceExprMediumLevelOperandUsage}},
-        {MLIL_SET_VAR_FIELD,
-            {DestVariableMediumLevelOperandUsage, OffsetMediumLevelOperandUsage, SourceExprMediumLevelOperandUsage}},
-        {MLIL_SET_VAR_SPLIT, {HighVariableMediumLevelOperandUsage, LowVariableMediumLevelOperandUsage,
-                                 SourceExprMediumLevelOperandUsage}},
-        {MLIL_SET_VAR_SSA, {DestSSAVariableMediumLevelOperandUsage, SourceExprMediumLevelOperandUsage}},
-        {MLIL_SET_VAR_SSA_FIELD,
-            {DestSSAVariableMediumLevelOperandUsage, PartialSSAVariableSourceMediumLevelOperandUsage,
-                OffsetMediumLevelOperandUsage, SourceExprMediumLevelOperandUsage}},
-        {MLIL_SET_VAR_SPLIT_SSA, {HighSSAVariableMediumLevelOperandUsage, LowSSAVariableMediumLevelOperandUsage,
-                                     SourceExprMediumLevelOperandUsage}},
-        {MLIL_SET_VAR_ALIASED, {DestSSAVariableMediumLevelOperandUsage, PartialSSAVariableSourceMediumLevelOperandUsage,
-                                   SourceExprMediumLevelOperandUsage}},
-        {MLIL_SET_VAR_ALIASED_FIELD,
-            {DestSSAVariableMediumLevelOperandUsage, PartialSSAVariableSourceMediumLevelOperandUsage,
-                OffsetMediumLevelOperandUsage, SourceExprMediumLevelOperandUsage}},
-        {MLIL_LOAD, {SourceExprMediumLevelOperandUsage}},
-        {MLIL_LOAD_STRUCT, {SourceExprMediumLevelOperandUsage, OffsetMediumLevelOperandUsage}},
-        {MLIL_LOAD_SSA, {SourceExprMediumLevelOperandUsage, SourceMemoryVersionMediumLevelOperandUsage}},
-        {MLIL_LOAD_STRUCT_SSA, {SourceExprMediumLevelOperandUsage, OffsetMediumLevelOperandUsage,
-                                   SourceMemoryVersionMediumLevelOperandUsage}},
-        {MLIL_STORE, {DestExprMediumLevelOperandUsage, SourceExprMediumLevelOperandUsage}},
-        {MLIL_STORE_STRUCT,
-            {DestExprMediumLevelOperandUsage, OffsetMediumLevelOperandUsage, SourceExprMediumLevelOperandUsage}},
-        {MLIL_STORE_SSA, {DestExprMediumLevelOperandUsage, DestMemoryVersionMediumLevelOperandUsage,
-                             SourceMemoryVersionMediumLevelOperandUsage, SourceExprMediumLevelOperandUsage}},
-        {MLIL_STORE_STRUCT_SSA,
-            {DestExprMediumLevelOperandUsage, OffsetMediumLevelOperandUsage, DestMemoryVersionMediumLevelOperandUsage,
-                SourceMemoryVersionMediumLevelOperandUsage, SourceExprMediumLevelOperandUsage}},
-        {MLIL_VAR, {SourceVariableMediumLevelOperandUsage}},
-        {MLIL_VAR_FIELD, {SourceVariableMediumLevelOperandUsage, OffsetMediumLevelOperandUsage}},
-        {MLIL_VAR_SPLIT, {HighVariableMediumLevelOperandUsage, LowVariableMediumLevelOperandUsage}},
-        {MLIL_VAR_SSA, {SourceSSAVariableMediumLevelOperandUsage}},
-        {MLIL_VAR_SSA_FIELD, {SourceSSAVariableMediumLevelOperandUsage, OffsetMediumLevelOperandUsage}},
-        {MLIL_VAR_ALIASED, {SourceSSAVariableMediumLevelOperandUsage}},
-        {MLIL_VAR_ALIASED_FIELD, {SourceSSAVariableMediumLevelOperandUsage, OffsetMediumLevelOperandUsage}},
-        {MLIL_VAR_SPLIT_SSA, {HighSSAVariableMediumLevelOperandUsage, LowSSAVariableMediumLevelOperandUsage}},
-        {MLIL_ADDRESS_OF, {SourceVariableMediumLevelOperandUsage}},
-        {MLIL_ADDRESS_OF_FIELD, {SourceVariableMediumLevelOperandUsage, OffsetMediumLevelOperandUsage}},
-        {MLIL_JUMP, {DestExprMediumLevelOperandUsage}},
-        {MLIL_JUMP_TO, {DestExprMediumLevelOperandUsage, TargetsMediumLevelOperandUsage}},
-        {MLIL_RET_HINT, {DestExprMediumLevelOperandUsage}},
-        {MLIL_CALL, {OutputVariablesMediumLevelOperandUsage, DestExprMediumLevelOperandUsage,
-                        ParameterExprsMediumLevelOperandUsage}},
-        {MLIL_CALL_UNTYPED, {OutputVariablesSubExprMediumLevelOperandUsage, DestExprMediumLevelOperandUsage,
-                                UntypedParameterExprsMediumLevelOperandUsage}},
-        {MLIL_SYSCALL, {OutputVariablesMediumLevelOperandUsage, ParameterExprsMediumLevelOperandUsage}},
-        {MLIL_SYSCALL_UNTYPED, {OutputVariablesSubExprMediumLevelOperandUsage,
-                                   UntypedParameterExprsMediumLevelOperandUsage, StackExprMediumLevelOperandUsage}},
-        {MLIL_TAILCALL, {OutputVariablesMediumLevelOperandUsage, DestExprMediumLevelOperandUsage,
-                            ParameterExprsMediumLevelOperandUsage}},
-        {MLIL_TAILCALL_UNTYPED, {OutputVariablesSubExprMediumLevelOperandUsage, DestExprMediumLevelOperandUsage,
-                                    UntypedParameterExprsMediumLevelOperandUsage}},
-        {MLIL_CALL_SSA, {OutputSSAVariablesSubExprMediumLevelOperandUsage,
-                            OutputSSAMemoryVersionMediumLevelOperandUsage, DestExprMediumLevelOperandUsage,
-                            ParameterExprsMediumLevelOperandUsage, SourceMemoryVersionMediumLevelOperandUsage}},
-        {MLIL_CALL_UNTYPED_SSA,
-            {OutputSSAVariablesSubExprMediumLevelOperandUsage, OutputSSAMemoryVersionMediumLevelOperandUsage,
-                DestExprMediumLevelOperandUsage, UntypedParameterSSAExprsMediumLevelOperandUsage,
-                ParameterSSAMemoryVersionMediumLevelOperandUsage, StackExprMediumLevelOperandUsage}},
-        {MLIL_SYSCALL_SSA,
-            {OutputSSAVariablesSubExprMediumLevelOperandUsage, OutputSSAMemoryVersionMediumLevelOperandUsage,
-                ParameterExprsMediumLevelOperandUsage, SourceMemoryVersionMediumLevelOperandUsage}},
-        {MLIL_SYSCALL_UNTYPED_SSA,
-            {OutputSSAVariablesSubExprMediumLevelOperandUsage, OutputSSAMemoryVersionMediumLevelOperandUsage,
-                UntypedParameterSSAExprsMediumLevelOperandUsage, ParameterSSAMemoryVersionMediumLevelOperandUsage,
-                StackExprMediumLevelOperandUsage}},
-        {MLIL_TAILCALL_SSA, {OutputSSAVariablesSubExprMediumLevelOperandUsage,
-                                OutputSSAMemoryVersionMediumLevelOperandUsage, DestExprMediumLevelOperandUsage,
-                                ParameterExprsMediumLevelOperandUsage, SourceMemoryVersionMediumLevelOperandUsage}},
-        {MLIL_TAILCALL_UNTYPED_SSA,
-            {OutputSSAVariablesSubExprMediumLevelOperandUsage, OutputSSAMemoryVersionMediumLevelOperandUsage,
-                DestExprMediumLevelOperandUsage, UntypedParameterSSAExprsMediumLevelOperandUsage,
-                ParameterSSAMemoryVersionMediumLevelOperandUsage, StackExprMediumLevelOperandUsage}},
-		{MLIL_SEPARATE_PARAM_LIST, {ParameterExprsMediumLevelOperandUsage}},
-		{MLIL_SHARED_PARAM_SLOT, {ParameterExprsMediumLevelOperandUsage}},
-        {MLIL_RET, {SourceExprsMediumLevelOperandUsage}},
-        {MLIL_IF, {ConditionExprMediumLevelOperandUsage, TrueTargetMediumLevelOperandUsage,
-                      FalseTargetMediumLevelOperandUsage}},
-        {MLIL_GOTO, {TargetMediumLevelOperandUsage}},
-        {MLIL_INTRINSIC, {OutputVariablesMediumLevelOperandUsage, IntrinsicMediumLevelOperandUsage,
-                             ParameterExprsMediumLevelOperandUsage}},
-        {MLIL_INTRINSIC_SSA, {OutputSSAVariablesMediumLevelOperandUsage, IntrinsicMediumLevelOperandUsage,
-                                 ParameterExprsMediumLevelOperandUsage}},
-        {MLIL_MEMORY_INTRINSIC_SSA, {OutputSSAVariablesSubExprMediumLevelOperandUsage, OutputSSAMemoryVersionMediumLevelOperandUsage, IntrinsicMediumLevelOperandUsage,
-													 ParameterExprsMediumLevelOperandUsage, SourceMemoryVersionMediumLevelOperandUsage}},
-        {MLIL_FREE_VAR_SLOT, {DestVariableMediumLevelOperandUsage}},
-        {MLIL_FREE_VAR_SLOT_SSA,
-            {DestSSAVariableMediumLevelOperandUsage, PartialSSAVariableSourceMediumLevelOperandUsage}},
-        {MLIL_TRAP, {VectorMediumLevelOperandUsage}},
-        {MLIL_VAR_PHI, {DestSSAVariableMediumLevelOperandUsage, SourceSSAVariablesMediumLevelOperandUsages}},
-        {MLIL_MEM_PHI, {DestMemoryVersionMediumLevelOperandUsage, SourceMemoryVersionsMediumLevelOperandUsage}},
-        {MLIL_CONST, {ConstantMediumLevelOperandUsage}},
-        {MLIL_CONST_PTR, {ConstantMediumLevelOperandUsage}},
-        {MLIL_EXTERN_PTR, {ConstantMediumLevelOperandUsage, OffsetMediumLevelOperandUsage}},
-        {MLIL_FLOAT_CONST, {ConstantMediumLevelOperandUsage}}, {MLIL_IMPORT, {ConstantMediumLevelOperandUsage}},
-        {MLIL_CONST_DATA, {ConstantDataMediumLevelOperandUsage}},
-        {MLIL_ADD, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_SUB, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_AND, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_OR, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_XOR, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_LSL, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_LSR, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_ASR, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_ROL, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_ROR, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_MUL, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_MULU_DP, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_MULS_DP, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_DIVU, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_DIVS, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_MODU, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_MODS, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_CMP_E, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_CMP_NE, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_CMP_SLT, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_CMP_ULT, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_CMP_SLE, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_CMP_ULE, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_CMP_SGE, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_CMP_UGE, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_CMP_SGT, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_CMP_UGT, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_TEST_BIT, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_ADD_OVERFLOW, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_ADC,
-            {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage, CarryExprMediumLevelOperandUsage}},
-        {MLIL_SBB,
-            {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage, CarryExprMediumLevelOperandUsage}},
-        {MLIL_RLC,
-            {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage, CarryExprMediumLevelOperandUsage}},
-        {MLIL_RRC,
-            {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage, CarryExprMediumLevelOperandUsage}},
-        {MLIL_DIVU_DP, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_DIVS_DP, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_MODU_DP, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_MODS_DP, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_NEG, {SourceExprMediumLevelOperandUsage}}, {MLIL_NOT, {SourceExprMediumLevelOperandUsage}},
-        {MLIL_SX, {SourceExprMediumLevelOperandUsage}}, {MLIL_ZX, {SourceExprMediumLevelOperandUsage}},
-        {MLIL_LOW_PART, {SourceExprMediumLevelOperandUsage}}, {MLIL_BOOL_TO_INT, {SourceExprMediumLevelOperandUsage}},
-        {MLIL_UNIMPL_MEM, {SourceExprMediumLevelOperandUsage}},
-        {MLIL_FADD, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_FSUB, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_FMUL, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_FDIV, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_FSQRT, {SourceExprMediumLevelOperandUsage}}, {MLIL_FNEG, {SourceExprMediumLevelOperandUsage}},
-        {MLIL_FABS, {SourceExprMediumLevelOperandUsage}}, {MLIL_FLOAT_TO_INT, {SourceExprMediumLevelOperandUsage}},
-        {MLIL_INT_TO_FLOAT, {SourceExprMediumLevelOperandUsage}},
-        {MLIL_FLOAT_CONV, {SourceExprMediumLevelOperandUsage}},
-        {MLIL_ROUND_TO_INT, {SourceExprMediumLevelOperandUsage}}, {MLIL_FLOOR, {SourceExprMediumLevelOperandUsage}},
-        {MLIL_CEIL, {SourceExprMediumLevelOperandUsage}}, {MLIL_FTRUNC, {SourceExprMediumLevelOperandUsage}},
-        {MLIL_FCMP_E, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_FCMP_NE, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_FCMP_LT, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_FCMP_LE, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_FCMP_GE, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_FCMP_GT, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_FCMP_O, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
-        {MLIL_FCMP_UO, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}}};
+static unordered_map<MediumLevelILOperandUsage, MediumLevelILOperandType> GetOperandTypeForUsages()
+{
+	unordered_map<MediumLevelILOperandUsage, MediumLevelILOperandType> result;
+	result.reserve(sizeof(MediumLevelILOperandTypeForUsage) / sizeof(MediumLevelILOperandTypeForUsage[0]));
+	for (auto& i : MediumLevelILOperandTypeForUsage)
+		result[i.usage] = i.type;
+	return result;
+}
+
+
+static unordered_map<BNMediumLevelILOperation, vector<MediumLevelILOperandUsage>> GetOperationOperandUsages()
+{
+	unordered_map<BNMediumLevelILOperation, vector<MediumLevelILOperandUsage>> result;
+	result.reserve(sizeof(MediumLevelILOperationOperandUsage) / sizeof(MediumLevelILOperationOperandUsage[0]));
+	for (auto& i : MediumLevelILOperationOperandUsage)
+		result[i.operation] = vector<MediumLevelILOperandUsage>(i.usages);
+	return result;
+}
 
 
 static unordered_map<BNMediumLevelILOperation, unordered_map<MediumLevelILOperandUsage, size_t>>
     GetOperandIndexForOperandUsages()
 {
 	unordered_map<BNMediumLevelILOperation, unordered_map<MediumLevelILOperandUsage, size_t>> result;
-	result.reserve(MediumLevelILInstructionBase::operationOperandUsage.size());
-	for (auto& operation : MediumLevelILInstructionBase::operationOperandUsage)
+	result.reserve(sizeof(MediumLevelILOperationOperandUsage) / sizeof(MediumLevelILOperationOperandUsage[0]));
+	for (auto& i : MediumLevelILOperationOperandUsage)
 	{
-		result[operation.first] = unordered_map<MediumLevelILOperandUsage, size_t>();
-		result[operation.first].reserve(operation.second.size());
-		size_t operand = 0;
-		for (auto usage : operation.second)
-		{
-			result[operation.first][usage] = operand;
-			switch (usage)
-			{
-			case PartialSSAVariableSourceMediumLevelOperandUsage:
-				// SSA variables are usually two slots, but this one has a previously defined
-				// variables and thus only takes one slot
-				operand++;
-				break;
-			case OutputVariablesSubExprMediumLevelOperandUsage:
-			case UntypedParameterExprsMediumLevelOperandUsage:
-				// Represented as subexpression, so only takes one slot even though it is a list
-				operand++;
-				break;
-			case OutputSSAVariablesSubExprMediumLevelOperandUsage:
-				// OutputSSAMemoryVersionMediumLevelOperandUsage follows at same operand
-				break;
-			case UntypedParameterSSAExprsMediumLevelOperandUsage:
-				// ParameterSSAMemoryVersionMediumLevelOperandUsage follows at same operand
-				break;
-			default:
-				switch (MediumLevelILInstructionBase::operandTypeForUsage[usage])
-				{
-				case SSAVariableMediumLevelOperand:
-				case IndexListMediumLevelOperand:
-				case IndexMapMediumLevelOperand:
-				case VariableListMediumLevelOperand:
-				case SSAVariableListMediumLevelOperand:
-				case ExprListMediumLevelOperand:
-					// SSA variables and lists take two operand slots
-					operand += 2;
-					break;
-				default:
-					operand++;
-					break;
-				}
-				break;
-			}
-		}
+		auto& operandIndex = result[i.operation];
+		operandIndex.reserve(i.usages.size());
+		for (auto usage : i.usages)
+			operandIndex[usage] = GetMediumLevelILOperandIndex(i.operation, usage);
 	}
 	return result;
 }
 
 
+unordered_map<MediumLevelILOperandUsage, MediumLevelILOperandType> MediumLevelILInstructionBase::operandTypeForUsage = GetOperandTypeForUsages();
+unordered_map<BNMediumLevelILOperation, vector<MediumLevelILOperandUsage>> MediumLevelILInstructionBase::operationOperandUsage =
+    GetOperationOperandUsages();
+
+
 unordered_map<BNMediumLevelILOperation, unordered_map<MediumLevelILOperandUsage, size_t>>
     MediumLevelILInstructionBase::operationOperandIndex = GetOperandIndexForOperandUsages();
 
+// The dense tables must agree with the operand layout used by the templated accessors
+static_assert(GetMediumLevelILOperandIndex(MLIL_CALL_SSA, DestExprMediumLevelOperandUsage) == 1);
+static_assert(GetMediumLevelILOperandIndex(MLIL_CALL_SSA, ParameterExprsMediumLevelOperandUsage) == 2);
+static_assert(GetMediumLevelILOperandIndex(MLIL_CALL_SSA, SourceMemoryVersionMediumLevelOperandUsage) == 4);
+
 
 SSAVariable::SSAVariable() : version(0) {}
 
@@ -722,10 +506,9 @@ MediumLevelILOperand::MediumLevelILOperand(
     m_instr(instr),
     m_usage(usage), m_operandIndex(operandIndex)
 {
-	auto i = MediumLevelILInstructionBase::operandTypeForUsage.find(m_usage);
-	if (i == MediumLevelILInstructionBase::operandTypeForUsage.end())
+	if (((size_t)m_usage >= MediumLevelILOperandUsageCount) || (MediumLevelILOperandTable.operandType[m_usage] == MediumLevelILInvalidOperandType))
 		throw MediumLevelILInstructionAccessException();
-	m_type = i->second;
+	m_type = (MediumLevelILOperandType)MediumLevelILOperandTable.operandType[m_usage];
 }
 
 
@@ -1392,213 +1175,7 @@ void MediumLevelILInstructionBase::ClearAttribute(BNILInstructionAttribute attri
 
 void MediumLevelILInstruction::VisitExprs(const std::function<bool(const MediumLevelILInstruction& expr)>& func) const
 {
-	if (!func(*this))
-		return;
-	switch (operation)
-	{
-	case MLIL_SET_VAR:
-		GetSourceExpr<MLIL_SET_VAR>().VisitExprs(func);
-		break;
-	case MLIL_SET_VAR_SSA:
-		GetSourceExpr<MLIL_SET_VAR_SSA>().VisitExprs(func);
-		break;
-	case MLIL_SET_VAR_ALIASED:
-		GetSourceExpr<MLIL_SET_VAR_ALIASED>().VisitExprs(func);
-		break;
-	case MLIL_SET_VAR_SPLIT:
-		GetSourceExpr<MLIL_SET_VAR_SPLIT>().VisitExprs(func);
-		break;
-	case MLIL_SET_VAR_SPLIT_SSA:
-		GetSourceExpr<MLIL_SET_VAR_SPLIT_SSA>().VisitExprs(func);
-		break;
-	case MLIL_SET_VAR_FIELD:
-		GetSourceExpr<MLIL_SET_VAR_FIELD>().VisitExprs(func);
-		break;
-	case MLIL_SET_VAR_SSA_FIELD:
-		GetSourceExpr<MLIL_SET_VAR_SSA_FIELD>().VisitExprs(func);
-		break;
-	case MLIL_SET_VAR_ALIASED_FIELD:
-		GetSourceExpr<MLIL_SET_VAR_ALIASED_FIELD>().VisitExprs(func);
-		break;
-	case MLIL_CALL:
-		GetDestExpr<MLIL_CALL>().VisitExprs(func);
-		for (auto i : GetParameterExprs<MLIL_CALL>())
-			i.VisitExprs(func);
-		break;
-	case MLIL_CALL_UNTYPED:
-		GetDestExpr<MLIL_CALL_UNTYPED>().VisitExprs(func);
-		for (auto i : GetParameterExprs<MLIL_CALL_UNTYPED>())
-			i.VisitExprs(func);
-		break;
-	case MLIL_CALL_SSA:
-		GetDestExpr<MLIL_CALL_SSA>().VisitExprs(func);
-		for (auto i : GetParameterExprs<MLIL_CALL_SSA>())
-			i.VisitExprs(func);
-		break;
-	case MLIL_CALL_UNTYPED_SSA:
-		GetDestExpr<MLIL_CALL_UNTYPED_SSA>().VisitExprs(func);
-		for (auto i : GetParameterExprs<MLIL_CALL_UNTYPED_SSA>())
-			i.VisitExprs(func);
-		break;
-	case MLIL_SYSCALL:
-		for (auto i : GetParameterExprs<MLIL_SYSCALL>())
-			i.VisitExprs(func);
-		break;
-	case MLIL_SYSCALL_UNTYPED:
-		for (auto i : GetParameterExprs<MLIL_SYSCALL_UNTYPED>())
-			i.VisitExprs(func);
-		break;
-	case MLIL_SYSCALL_SSA:
-		for (auto i : GetParameterExprs<MLIL_SYSCALL_SSA>())
-			i.VisitExprs(func);
-		break;
-	case MLIL_SYSCALL_UNTYPED_SSA:
-		for (auto i : GetParameterExprs<MLIL_SYSCALL_UNTYPED_SSA>())
-			i.VisitExprs(func);
-		break;
-	case MLIL_TAILCALL:
-		GetDestExpr<MLIL_TAILCALL>().VisitExprs(func);
-		for (auto i : GetParameterExprs<MLIL_TAILCALL>())
-			i.VisitExprs(func);
-		break;
-	case MLIL_TAILCALL_UNTYPED:
-		GetDestExpr<MLIL_TAILCALL_UNTYPED>().VisitExprs(func);
-		for (auto i : GetParameterExprs<MLIL_TAILCALL_UNTYPED>())
-			i.VisitExprs(func);
-		break;
-	case MLIL_TAILCALL_SSA:
-		GetDestExpr<MLIL_TAILCALL_SSA>().VisitExprs(func);
-		for (auto i : GetParameterExprs<MLIL_TAILCALL_SSA>())
-			i.VisitExprs(func);
-		break;
-	case MLIL_TAILCALL_UNTYPED_SSA:
-		GetDestExpr<MLIL_TAILCALL_UNTYPED_SSA>().VisitExprs(func);
-		for (auto i : GetParameterExprs<MLIL_TAILCALL_UNTYPED_SSA>())
-			i.VisitExprs(func);
-		break;
-	case MLIL_SEPARATE_PARAM_LIST:
-		for (auto i : GetParameterExprs<MLIL_SEPARATE_PARAM_LIST>())
-			i.VisitExprs(func);
-		break;
-	case MLIL_SHARED_PARAM_SLOT:
-		for (auto i : GetParameterExprs<MLIL_SHARED_PARAM_SLOT>())
-			i.VisitExprs(func);
-		break;
-	case MLIL_RET:
-		for (auto i : GetSourceExprs<MLIL_RET>())
-			i.VisitExprs(func);
-		break;
-	case MLIL_STORE:
-		GetDestExpr<MLIL_STORE>().VisitExprs(func);
-		GetSourceExpr<MLIL_STORE>().VisitExprs(func);
-		break;
-	case MLIL_STORE_STRUCT:
-		GetDestExpr<MLIL_STORE_STRUCT>().VisitExprs(func);
-		GetSourceExpr<MLIL_STORE_STRUCT>().VisitExprs(func);
-		break;
-	case MLIL_STORE_SSA:
-		GetDestExpr<MLIL_STORE_SSA>().VisitExprs(func);
-		GetSourceExpr<MLIL_STORE_SSA>().VisitExprs(func);
-		break;
-	case MLIL_STORE_STRUCT_SSA:
-		GetDestExpr<MLIL_STORE_STRUCT_SSA>().VisitExprs(func);
-		GetSourceExpr<MLIL_STORE_STRUCT_SSA>().VisitExprs(func);
-		break;
-	case MLIL_NEG:
-	case MLIL_NOT:
-	case MLIL_SX:
-	case MLIL_ZX:
-	case MLIL_LOW_PART:
-	case MLIL_BOOL_TO_INT:
-	case MLIL_JUMP:
-	case MLIL_JUMP_TO:
-	case MLIL_RET_HINT:
-	case MLIL_IF:
-	case MLIL_UNIMPL_MEM:
-	case MLIL_LOAD:
-	case MLIL_LOAD_STRUCT:
-	case MLIL_LOAD_SSA:
-	case MLIL_LOAD_STRUCT_SSA:
-	case MLIL_FSQRT:
-	case MLIL_FNEG:
-	case MLIL_FABS:
-	case MLIL_FLOAT_TO_INT:
-	case MLIL_INT_TO_FLOAT:
-	case MLIL_FLOAT_CONV:
-	case MLIL_ROUND_TO_INT:
-	case MLIL_FLOOR:
-	case MLIL_CEIL:
-	case MLIL_FTRUNC:
-		AsOneOperand().GetSourceExpr().VisitExprs(func);
-		break;
-	case MLIL_ADD:
-	case MLIL_SUB:
-	case MLIL_AND:
-	case MLIL_OR:
-	case MLIL_XOR:
-	case MLIL_LSL:
-	case MLIL_LSR:
-	case MLIL_ASR:
-	case MLIL_ROL:
-	case MLIL_ROR:
-	case MLIL_MUL:
-	case MLIL_MULU_DP:
-	case MLIL_MULS_DP:
-	case MLIL_DIVU:
-	case MLIL_DIVS:
-	case MLIL_MODU:
-	case MLIL_MODS:
-	case MLIL_DIVU_DP:
-	case MLIL_DIVS_DP:
-	case MLIL_MODU_DP:
-	case MLIL_MODS_DP:
-	case MLIL_CMP_E:
-	case MLIL_CMP_NE:
-	case MLIL_CMP_SLT:
-	case MLIL_CMP_ULT:
-	case MLIL_CMP_SLE:
-	case MLIL_CMP_ULE:
-	case MLIL_CMP_SGE:
-	case MLIL_CMP_UGE:
-	case MLIL_CMP_SGT:
-	case MLIL_CMP_UGT:
-	case MLIL_TEST_BIT:
-	case MLIL_ADD_OVERFLOW:
-	case MLIL_FADD:
-	case MLIL_FSUB:
-	case MLIL_FMUL:
-	case MLIL_FDIV:
-	case MLIL_FCMP_E:
-	case MLIL_FCMP_NE:
-	case MLIL_FCMP_LT:
-	case MLIL_FCMP_LE:
-	case MLIL_FCMP_GE:
-	case MLIL_FCMP_GT:
-	case MLIL_FCMP_O:
-	case MLIL_FCMP_UO:
-		AsTwoOperand().GetLeftExpr().VisitExprs(func);
-		AsTwoOperand().GetRightExpr().VisitExprs(func);
-		break;
-	case MLIL_ADC:
-	case MLIL_SBB:
-	case MLIL_RLC:
-	case MLIL_RRC:
-		AsTwoOperandWithCarry().GetLeftExpr().VisitExprs(func);
-		AsTwoOperandWithCarry().GetRightExpr().VisitExprs(func);
-		AsTwoOperandWithCarry().GetCarryExpr().VisitExprs(func);
-		break;
-	case MLIL_INTRINSIC:
-		for (auto i : GetParameterExprs<MLIL_INTRINSIC>())
-			i.VisitExprs(func);
-		break;
-	case MLIL_INTRINSIC_SSA:
-	case MLIL_MEMORY_INTRINSIC_SSA:
-		for (auto i : GetParameterExprs())
-			i.VisitExprs(func);
-		break;
-	default:
-		break;
-	}
+	WalkExprs(func);
 }
 
 
@@ -1931,13 +1508,10 @@ ExprId MediumLevelILInstruction::CopyTo(MediumLevelILFunction* dest,
 
 bool MediumLevelILInstruction::GetOperandIndexForUsage(MediumLevelILOperandUsage usage, size_t& operandIndex) const
 {
-	auto operationIter = MediumLevelILInstructionBase::operationOperandIndex.find(operation);
-	if (operationIter == MediumLevelILInstructionBase::operationOperandIndex.end())
-		return false;
-	auto usageIter = operationIter->second.find(usage);
-	if (usageIter == operationIter->second.end())
+	size_t index = GetMediumLevelILOperandIndex(operation, usage);
+	if (index == MediumLevelILInvalidOperandIndex)
 		return false;
-	operandIndex = usageIter->second;
+	operandIndex = index;
 	return true;
 }
 
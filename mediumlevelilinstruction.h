@@ -21,6 +21,7 @@
 #pragma once
 
 #include <functional>
+#include <initializer_list>
 #include <unordered_map>
 #include <vector>
 #ifdef BINARYNINJACORE_LIBRARY
@@ -29,6 +30,7 @@
 #else
 	#include "binaryninjaapi.h"
 #endif
+#include "ilwalk.h"
 
 #ifdef BINARYNINJACORE_LIBRARY
 namespace BinaryNinjaCore
@@ -136,6 +138,346 @@ namespace BinaryNinja
 		ParameterSSAMemoryVersionMediumLevelOperandUsage,
 		SourceSSAVariablesMediumLevelOperandUsages
 	};
+
+	/*!
+		\ingroup mediumlevelil
+	*/
+	struct MediumLevelILOperandUsageType
+	{
+		MediumLevelILOperandUsage usage;
+		MediumLevelILOperandType type;
+	};
+
+	/*!
+		\ingroup mediumlevelil
+	*/
+	struct MediumLevelILOperationOperandUsages
+	{
+		BNMediumLevelILOperation operation;
+		std::initializer_list<MediumLevelILOperandUsage> usages;
+	};
+
+	// Operand layout of every operation. The lookup maps in MediumLevelILInstructionBase and the dense
+	// tables below are both derived from these.
+	inline constexpr MediumLevelILOperandUsageType MediumLevelILOperandTypeForUsage[] = {
+		{SourceExprMediumLevelOperandUsage, ExprMediumLevelOperand},
+		{SourceVariableMediumLevelOperandUsage, VariableMediumLevelOperand},
+		{SourceSSAVariableMediumLevelOperandUsage, SSAVariableMediumLevelOperand},
+		{PartialSSAVariableSourceMediumLevelOperandUsage, SSAVariableMediumLevelOperand},
+		{DestExprMediumLevelOperandUsage, ExprMediumLevelOperand},
+		{DestVariableMediumLevelOperandUsage, VariableMediumLevelOperand},
+		{DestSSAVariableMediumLevelOperandUsage, SSAVariableMediumLevelOperand},
+		{LeftExprMediumLevelOperandUsage, ExprMediumLevelOperand},
+		{RightExprMediumLevelOperandUsage, ExprMediumLevelOperand},
+		{CarryExprMediumLevelOperandUsage, ExprMediumLevelOperand},
+		{StackExprMediumLevelOperandUsage, ExprMediumLevelOperand},
+		{ConditionExprMediumLevelOperandUsage, ExprMediumLevelOperand},
+		{HighVariableMediumLevelOperandUsage, VariableMediumLevelOperand},
+		{LowVariableMediumLevelOperandUsage, VariableMediumLevelOperand},
+		{HighSSAVariableMediumLevelOperandUsage, VariableMediumLevelOperand},
+		{LowSSAVariableMediumLevelOperandUsage, VariableMediumLevelOperand},
+		{OffsetMediumLevelOperandUsage, IntegerMediumLevelOperand},
+		{ConstantMediumLevelOperandUsage, IntegerMediumLevelOperand},
+		{ConstantDataMediumLevelOperandUsage, ConstantDataMediumLevelOperand},
+		{VectorMediumLevelOperandUsage, IntegerMediumLevelOperand},
+		{IntrinsicMediumLevelOperandUsage, IntrinsicMediumLevelOperand},
+		{TargetMediumLevelOperandUsage, IndexMediumLevelOperand},
+		{TrueTargetMediumLevelOperandUsage, IndexMediumLevelOperand},
+		{FalseTargetMediumLevelOperandUsage, IndexMediumLevelOperand},
+		{DestMemoryVersionMediumLevelOperandUsage, IndexMediumLevelOperand},
+		{SourceMemoryVersionMediumLevelOperandUsage, IndexMediumLevelOperand},
+		{TargetsMediumLevelOperandUsage, IndexMapMediumLevelOperand},
+		{SourceMemoryVersionsMediumLevelOperandUsage, IndexListMediumLevelOperand},
+		{OutputVariablesMediumLevelOperandUsage, VariableListMediumLevelOperand},
+		{OutputVariablesSubExprMediumLevelOperandUsage, VariableListMediumLevelOperand},
+		{OutputSSAVariablesMediumLevelOperandUsage, SSAVariableListMediumLevelOperand},
+		{OutputSSAVariablesSubExprMediumLevelOperandUsage, SSAVariableListMediumLevelOperand},
+		{OutputSSAMemoryVersionMediumLevelOperandUsage, IndexMediumLevelOperand},
+		{ParameterExprsMediumLevelOperandUsage, ExprListMediumLevelOperand},
+		{SourceExprsMediumLevelOperandUsage, ExprListMediumLevelOperand},
+		{UntypedParameterExprsMediumLevelOperandUsage, ExprListMediumLevelOperand},
+		{UntypedParameterSSAExprsMediumLevelOperandUsage, ExprListMediumLevelOperand},
+		{ParameterSSAMemoryVersionMediumLevelOperandUsage, IndexMediumLevelOperand},
+		{SourceSSAVariablesMediumLevelOperandUsages, SSAVariableListMediumLevelOperand}
+	};
+
+	inline constexpr MediumLevelILOperationOperandUsages MediumLevelILOperationOperandUsage[] = {
+		{MLIL_NOP, {}},
+		{MLIL_NORET, {}},
+		{MLIL_BP, {}},
+		{MLIL_UNDEF, {}},
+		{MLIL_UNIMPL, {}},
+		{MLIL_SET_VAR, {DestVariableMediumLevelOperandUsage, SourceExprMediumLevelOperandUsage}},
+		{MLIL_SET_VAR_FIELD,
+			{DestVariableMediumLevelOperandUsage, OffsetMediumLevelOperandUsage, SourceExprMediumLevelOperandUsage}},
+		{MLIL_SET_VAR_SPLIT,
+			{HighVariableMediumLevelOperandUsage, LowVariableMediumLevelOperandUsage,
+				SourceExprMediumLevelOperandUsage}},
+		{MLIL_SET_VAR_SSA, {DestSSAVariableMediumLevelOperandUsage, SourceExprMediumLevelOperandUsage}},
+		{MLIL_SET_VAR_SSA_FIELD,
+			{DestSSAVariableMediumLevelOperandUsage, PartialSSAVariableSourceMediumLevelOperandUsage,
+				OffsetMediumLevelOperandUsage, SourceExprMediumLevelOperandUsage}},
+		{MLIL_SET_VAR_SPLIT_SSA,
+			{HighSSAVariableMediumLevelOperandUsage, LowSSAVariableMediumLevelOperandUsage,
+				SourceExprMediumLevelOperandUsage}},
+		{MLIL_SET_VAR_ALIASED,
+			{DestSSAVariableMediumLevelOperandUsage, PartialSSAVariableSourceMediumLevelOperandUsage,
+				SourceExprMediumLevelOperandUsage}},
+		{MLIL_SET_VAR_ALIASED_FIELD,
+			{DestSSAVariableMediumLevelOperandUsage, PartialSSAVariableSourceMediumLevelOperandUsage,
+				OffsetMediumLevelOperandUsage, SourceExprMediumLevelOperandUsage}},
+		{MLIL_LOAD, {SourceExprMediumLevelOperandUsage}},
+		{MLIL_LOAD_STRUCT, {SourceExprMediumLevelOperandUsage, OffsetMediumLevelOperandUsage}},
+		{MLIL_LOAD_SSA, {SourceExprMediumLevelOperandUsage, SourceMemoryVersionMediumLevelOperandUsage}},
+		{MLIL_LOAD_STRUCT_SSA,
+			{SourceExprMediumLevelOperandUsage, OffsetMediumLevelOperandUsage,
+				SourceMemoryVersionMediumLevelOperandUsage}},
+		{MLIL_STORE, {DestExprMediumLevelOperandUsage, SourceExprMediumLevelOperandUsage}},
+		{MLIL_STORE_STRUCT,
+			{DestExprMediumLevelOperandUsage, OffsetMediumLevelOperandUsage, SourceExprMediumLevelOperandUsage}},
+		{MLIL_STORE_SSA,
+			{DestExprMediumLevelOperandUsage, DestMemoryVersionMediumLevelOperandUsage,
+				SourceMemoryVersionMediumLevelOperandUsage, SourceExprMediumLevelOperandUsage}},
+		{MLIL_STORE_STRUCT_SSA,
+			{DestExprMediumLevelOperandUsage, OffsetMediumLevelOperandUsage,
+				DestMemoryVersionMediumLevelOperandUsage, SourceMemoryVersionMediumLevelOperandUsage,
+				SourceExprMediumLevelOperandUsage}},
+		{MLIL_VAR, {SourceVariableMediumLevelOperandUsage}},
+		{MLIL_VAR_FIELD, {SourceVariableMediumLevelOperandUsage, OffsetMediumLevelOperandUsage}},
+		{MLIL_VAR_SPLIT, {HighVariableMediumLevelOperandUsage, LowVariableMediumLevelOperandUsage}},
+		{MLIL_VAR_SSA, {SourceSSAVariableMediumLevelOperandUsage}},
+		{MLIL_VAR_SSA_FIELD, {SourceSSAVariableMediumLevelOperandUsage, OffsetMediumLevelOperandUsage}},
+		{MLIL_VAR_ALIASED, {SourceSSAVariableMediumLevelOperandUsage}},
+		{MLIL_VAR_ALIASED_FIELD, {SourceSSAVariableMediumLevelOperandUsage, OffsetMediumLevelOperandUsage}},
+		{MLIL_VAR_SPLIT_SSA, {HighSSAVariableMediumLevelOperandUsage, LowSSAVariableMediumLevelOperandUsage}},
+		{MLIL_ADDRESS_OF, {SourceVariableMediumLevelOperandUsage}},
+		{MLIL_ADDRESS_OF_FIELD, {SourceVariableMediumLevelOperandUsage, OffsetMediumLevelOperandUsage}},
+		{MLIL_JUMP, {DestExprMediumLevelOperandUsage}},
+		{MLIL_JUMP_TO, {DestExprMediumLevelOperandUsage, TargetsMediumLevelOperandUsage}},
+		{MLIL_RET_HINT, {DestExprMediumLevelOperandUsage}},
+		{MLIL_CALL,
+			{OutputVariablesMediumLevelOperandUsage, DestExprMediumLevelOperandUsage,
+				ParameterExprsMediumLevelOperandUsage}},
+		{MLIL_CALL_UNTYPED,
+			{OutputVariablesSubExprMediumLevelOperandUsage, DestExprMediumLevelOperandUsage,
+				UntypedParameterExprsMediumLevelOperandUsage}},
+		{MLIL_SYSCALL, {OutputVariablesMediumLevelOperandUsage, ParameterExprsMediumLevelOperandUsage}},
+		{MLIL_SYSCALL_UNTYPED,
+			{OutputVariablesSubExprMediumLevelOperandUsage, UntypedParameterExprsMediumLevelOperandUsage,
+				StackExprMediumLevelOperandUsage}},
+		{MLIL_TAILCALL,
+			{OutputVariablesMediumLevelOperandUsage, DestExprMediumLevelOperandUsage,
+				ParameterExprsMediumLevelOperandUsage}},
+		{MLIL_TAILCALL_UNTYPED,
+			{OutputVariablesSubExprMediumLevelOperandUsage, DestExprMediumLevelOperandUsage,
+				UntypedParameterExprsMediumLevelOperandUsage}},
+		{MLIL_CALL_SSA,
+			{OutputSSAVariablesSubExprMediumLevelOperandUsage, OutputSSAMemoryVersionMediumLevelOperandUsage,
+				DestExprMediumLevelOperandUsage, ParameterExprsMediumLevelOperandUsage,
+				SourceMemoryVersionMediumLevelOperandUsage}},
+		{MLIL_CALL_UNTYPED_SSA,
+			{OutputSSAVariablesSubExprMediumLevelOperandUsage, OutputSSAMemoryVersionMediumLevelOperandUsage,
+				DestExprMediumLevelOperandUsage, UntypedParameterSSAExprsMediumLevelOperandUsage,
+				ParameterSSAMemoryVersionMediumLevelOperandUsage, StackExprMediumLevelOperandUsage}},
+		{MLIL_SYSCALL_SSA,
+			{OutputSSAVariablesSubExprMediumLevelOperandUsage, OutputSSAMemoryVersionMediumLevelOperandUsage,
+				ParameterExprsMediumLevelOperandUsage, SourceMemoryVersionMediumLevelOperandUsage}},
+		{MLIL_SYSCALL_UNTYPED_SSA,
+			{OutputSSAVariablesSubExprMediumLevelOperandUsage, OutputSSAMemoryVersionMediumLevelOperandUsage,
+				UntypedParameterSSAExprsMediumLevelOperandUsage, ParameterSSAMemoryVersionMediumLevelOperandUsage,
+				StackExprMediumLevelOperandUsage}},
+		{MLIL_TAILCALL_SSA,
+			{OutputSSAVariablesSubExprMediumLevelOperandUsage, OutputSSAMemoryVersionMediumLevelOperandUsage,
+				DestExprMediumLevelOperandUsage, ParameterExprsMediumLevelOperandUsage,
+				SourceMemoryVersionMediumLevelOperandUsage}},
+		{MLIL_TAILCALL_UNTYPED_SSA,
+			{OutputSSAVariablesSubExprMediumLevelOperandUsage, OutputSSAMemoryVersionMediumLevelOperandUsage,
+				DestExprMediumLevelOperandUsage, UntypedParameterSSAExprsMediumLevelOperandUsage,
+				ParameterSSAMemoryVersionMediumLevelOperandUsage, StackExprMediumLevelOperandUsage}},
+		{MLIL_SEPARATE_PARAM_LIST, {ParameterExprsMediumLevelOperandUsage}},
+		{MLIL_SHARED_PARAM_SLOT, {ParameterExprsMediumLevelOperandUsage}},
+		{MLIL_RET, {SourceExprsMediumLevelOperandUsage}},
+		{MLIL_IF,
+			{ConditionExprMediumLevelOperandUsage, TrueTargetMediumLevelOperandUsage,
+				FalseTargetMediumLevelOperandUsage}},
+		{MLIL_GOTO, {TargetMediumLevelOperandUsage}},
+		{MLIL_INTRINSIC,
+			{OutputVariablesMediumLevelOperandUsage, IntrinsicMediumLevelOperandUsage,
+				ParameterExprsMediumLevelOperandUsage}},
+		{MLIL_INTRINSIC_SSA,
+			{OutputSSAVariablesMediumLevelOperandUsage, IntrinsicMediumLevelOperandUsage,
+				ParameterExprsMediumLevelOperandUsage}},
+		{MLIL_MEMORY_INTRINSIC_SSA,
+			{OutputSSAVariablesSubExprMediumLevelOperandUsage, OutputSSAMemoryVersionMediumLevelOperandUsage,
+				IntrinsicMediumLevelOperandUsage, ParameterExprsMediumLevelOperandUsage,
+				SourceMemoryVersionMediumLevelOperandUsage}},
+		{MLIL_FREE_VAR_SLOT, {DestVariableMediumLevelOperandUsage}},
+		{MLIL_FREE_VAR_SLOT_SSA,
+			{DestSSAVariableMediumLevelOperandUsage, PartialSSAVariableSourceMediumLevelOperandUsage}},
+		{MLIL_TRAP, {VectorMediumLevelOperandUsage}},
+		{MLIL_VAR_PHI, {DestSSAVariableMediumLevelOperandUsage, SourceSSAVariablesMediumLevelOperandUsages}},
+		{MLIL_MEM_PHI, {DestMemoryVersionMediumLevelOperandUsage, SourceMemoryVersionsMediumLevelOperandUsage}},
+		{MLIL_CONST, {ConstantMediumLevelOperandUsage}},
+		{MLIL_CONST_PTR, {ConstantMediumLevelOperandUsage}},
+		{MLIL_EXTERN_PTR, {ConstantMediumLevelOperandUsage, OffsetMediumLevelOperandUsage}},
+		{MLIL_FLOAT_CONST, {ConstantMediumLevelOperandUsage}},
+		{MLIL_IMPORT, {ConstantMediumLevelOperandUsage}},
+		{MLIL_CONST_DATA, {ConstantDataMediumLevelOperandUsage}},
+		{MLIL_ADD, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_SUB, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_AND, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_OR, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_XOR, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_LSL, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_LSR, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_ASR, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_ROL, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_ROR, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_MUL, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_MULU_DP, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_MULS_DP, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_DIVU, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_DIVS, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_MODU, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_MODS, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_CMP_E, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_CMP_NE, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_CMP_SLT, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_CMP_ULT, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_CMP_SLE, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_CMP_ULE, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_CMP_SGE, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_CMP_UGE, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_CMP_SGT, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_CMP_UGT, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_TEST_BIT, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_ADD_OVERFLOW, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_ADC,
+			{LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage, CarryExprMediumLevelOperandUsage}},
+		{MLIL_SBB,
+			{LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage, CarryExprMediumLevelOperandUsage}},
+		{MLIL_RLC,
+			{LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage, CarryExprMediumLevelOperandUsage}},
+		{MLIL_RRC,
+			{LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage, CarryExprMediumLevelOperandUsage}},
+		{MLIL_DIVU_DP, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_DIVS_DP, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_MODU_DP, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_MODS_DP, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_NEG, {SourceExprMediumLevelOperandUsage}},
+		{MLIL_NOT, {SourceExprMediumLevelOperandUsage}},
+		{MLIL_SX, {SourceExprMediumLevelOperandUsage}},
+		{MLIL_ZX, {SourceExprMediumLevelOperandUsage}},
+		{MLIL_LOW_PART, {SourceExprMediumLevelOperandUsage}},
+		{MLIL_BOOL_TO_INT, {SourceExprMediumLevelOperandUsage}},
+		{MLIL_UNIMPL_MEM, {SourceExprMediumLevelOperandUsage}},
+		{MLIL_FADD, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_FSUB, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_FMUL, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_FDIV, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_FSQRT, {SourceExprMediumLevelOperandUsage}},
+		{MLIL_FNEG, {SourceExprMediumLevelOperandUsage}},
+		{MLIL_FABS, {SourceExprMediumLevelOperandUsage}},
+		{MLIL_FLOAT_TO_INT, {SourceExprMediumLevelOperandUsage}},
+		{MLIL_INT_TO_FLOAT, {SourceExprMediumLevelOperandUsage}},
+		{MLIL_FLOAT_CONV, {SourceExprMediumLevelOperandUsage}},
+		{MLIL_ROUND_TO_INT, {SourceExprMediumLevelOperandUsage}},
+		{MLIL_FLOOR, {SourceExprMediumLevelOperandUsage}},
+		{MLIL_CEIL, {SourceExprMediumLevelOperandUsage}},
+		{MLIL_FTRUNC, {SourceExprMediumLevelOperandUsage}},
+		{MLIL_FCMP_E, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_FCMP_NE, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_FCMP_LT, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_FCMP_LE, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_FCMP_GE, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_FCMP_GT, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_FCMP_O, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}},
+		{MLIL_FCMP_UO, {LeftExprMediumLevelOperandUsage, RightExprMediumLevelOperandUsage}}
+	};
+
+	constexpr size_t MediumLevelILOperationCount = MLIL_MEM_PHI + 1;
+	constexpr size_t MediumLevelILOperandUsageCount = SourceSSAVariablesMediumLevelOperandUsages + 1;
+	constexpr uint8_t MediumLevelILInvalidOperandType = 0xff;
+	constexpr uint8_t MediumLevelILInvalidOperandIndex = 0xff;
+
+	/*!
+		Dense operand lookup tables indexed by operation and operand usage, built at compile time
+		so that operand accessors do not need any hash lookups.
+
+		\ingroup mediumlevelil
+	*/
+	struct MediumLevelILOperandTables
+	{
+		uint8_t operandType[MediumLevelILOperandUsageCount];
+		uint8_t operandIndex[MediumLevelILOperationCount][MediumLevelILOperandUsageCount];
+	};
+
+	constexpr MediumLevelILOperandTables BuildMediumLevelILOperandTables()
+	{
+		MediumLevelILOperandTables result {};
+		for (auto& type : result.operandType)
+			type = MediumLevelILInvalidOperandType;
+		for (auto& operation : result.operandIndex)
+			for (auto& index : operation)
+				index = MediumLevelILInvalidOperandIndex;
+
+		for (auto& i : MediumLevelILOperandTypeForUsage)
+			result.operandType[i.usage] = (uint8_t)i.type;
+
+		for (auto& i : MediumLevelILOperationOperandUsage)
+		{
+			size_t operand = 0;
+			for (auto usage : i.usages)
+			{
+				result.operandIndex[i.operation][usage] = (uint8_t)operand;
+				switch (usage)
+				{
+				case PartialSSAVariableSourceMediumLevelOperandUsage:
+					// SSA variables are usually two slots, but this one has a previously defined
+					// variables and thus only takes one slot
+					operand++;
+					break;
+				case OutputVariablesSubExprMediumLevelOperandUsage:
+				case UntypedParameterExprsMediumLevelOperandUsage:
+					// Represented as subexpression, so only takes one slot even though it is a list
+					operand++;
+					break;
+				case OutputSSAVariablesSubExprMediumLevelOperandUsage:
+				case UntypedParameterSSAExprsMediumLevelOperandUsage:
+					// The following memory version usage shares the same operand
+					break;
+				default:
+					switch (result.operandType[usage])
+					{
+					case SSAVariableMediumLevelOperand:
+					case IndexListMediumLevelOperand:
+					case IndexMapMediumLevelOperand:
+					case VariableListMediumLevelOperand:
+					case SSAVariableListMediumLevelOperand:
+					case ExprListMediumLevelOperand:
+						// SSA variables and lists take two operand slots
+						operand += 2;
+						break;
+					default:
+						operand++;
+						break;
+					}
+					break;
+				}
+			}
+		}
+		return result;
+	}
+
+	inline constexpr MediumLevelILOperandTables MediumLevelILOperandTable = BuildMediumLevelILOperandTables();
+
+	// Returns MediumLevelILInvalidOperandIndex if the operation does not have an operand with the given usage
+	constexpr size_t GetMediumLevelILOperandIndex(BNMediumLevelILOperation operation, MediumLevelILOperandUsage usage)
+	{
+		if (((size_t)operation >= MediumLevelILOperationCount) || ((size_t)usage >= MediumLevelILOperandUsageCount))
+			return MediumLevelILInvalidOperandIndex;
+		return MediumLevelILOperandTable.operandIndex[operation][usage];
+	}
 }  // namespace BinaryNinjaCore
 
 namespace std {
@@ -572,6 +914,16 @@ namespace BinaryNinja
 
 		void VisitExprs(const std::function<bool(const MediumLevelILInstruction& expr)>& func) const;
 
+		// Calls func with each direct sub-expression, in the order VisitExprs visits them
+		template <typename T>
+		void ForEachSubExpr(T&& func) const;
+
+		// Non-recursive, allocation free alternative to VisitExprs, see LowLevelILInstruction::WalkExprs
+		template <typename PreFunc>
+		bool WalkExprs(PreFunc&& preFunc) const;
+		template <typename PreFunc, typename PostFunc>
+		bool WalkExprs(PreFunc&& preFunc, PostFunc&& postFunc) const;
+
 		ExprId CopyTo(MediumLevelILFunction* dest) const;
 		ExprId CopyTo(MediumLevelILFunction* dest,
 		    const std::function<ExprId(const MediumLevelILInstruction& subExpr)>& subExprHandler) const;
@@ -902,6 +1254,116 @@ namespace BinaryNinja
 		operator _STD_VECTOR<MediumLevelILOperand>() const;
 	};
 
+#ifndef BINARYNINJACORE_LIBRARY
+	class MediumLevelILExprSnapshot;
+
+	/*!
+		A single expression within a MediumLevelILExprSnapshot. Reads directly from the snapshot
+		columns, call GetInstruction to obtain a full MediumLevelILInstruction when needed.
+
+		\ingroup mediumlevelil
+	*/
+	class MediumLevelILSnapshotExpr
+	{
+		const MediumLevelILExprSnapshot* m_snapshot;
+		size_t m_exprIndex;
+
+	  public:
+		MediumLevelILSnapshotExpr(const MediumLevelILExprSnapshot* snapshot, size_t expr) :
+		    m_snapshot(snapshot), m_exprIndex(expr)
+		{}
+
+		size_t GetExprIndex() const { return m_exprIndex; }
+		inline BNMediumLevelILOperation GetOperation() const;
+		inline uint32_t GetAttributes() const;
+		inline size_t GetSize() const;
+		inline uint32_t GetSourceOperand() const;
+		inline uint64_t GetAddress() const;
+		inline uint64_t GetRawOperand(size_t operand) const;
+
+		BNMediumLevelILInstruction GetRawExpr() const;
+		MediumLevelILInstruction GetInstruction() const;
+	};
+
+	/*!
+		Copy of every expression of a MediumLevelILFunction, stored as one contiguous array per field.
+		Scanning a snapshot avoids constructing a MediumLevelILInstruction (and the associated
+		reference counting) for every expression of the function.
+
+		\ingroup mediumlevelil
+	*/
+	class MediumLevelILExprSnapshot
+	{
+		struct ListIterator
+		{
+			const MediumLevelILExprSnapshot* owner;
+			size_t index;
+			bool operator==(const ListIterator& a) const { return index == a.index; }
+			bool operator!=(const ListIterator& a) const { return index != a.index; }
+			bool operator<(const ListIterator& a) const { return index < a.index; }
+			ListIterator& operator++()
+			{
+				++index;
+				return *this;
+			}
+			MediumLevelILSnapshotExpr operator*() const { return MediumLevelILSnapshotExpr(owner, index); }
+		};
+
+		Ref<MediumLevelILFunction> m_function;
+		std::vector<BNMediumLevelILOperation> m_operations;
+		std::vector<uint32_t> m_attributes;
+		std::vector<size_t> m_sizes;
+		std::vector<uint32_t> m_sourceOperands;
+		std::vector<uint64_t> m_addresses;
+		std::vector<uint64_t> m_operands[5];
+
+	  public:
+		typedef ListIterator const_iterator;
+
+		MediumLevelILExprSnapshot(MediumLevelILFunction* func);
+
+		MediumLevelILFunction* GetFunction() const { return m_function; }
+
+		const_iterator begin() const { return const_iterator {this, 0}; }
+		const_iterator end() const { return const_iterator {this, m_operations.size()}; }
+		size_t size() const { return m_operations.size(); }
+		MediumLevelILSnapshotExpr operator[](size_t i) const { return MediumLevelILSnapshotExpr(this, i); }
+
+		// Column access, each array has size() entries indexed by expression index
+		const BNMediumLevelILOperation* GetOperations() const { return m_operations.data(); }
+		const uint32_t* GetAttributes() const { return m_attributes.data(); }
+		const size_t* GetSizes() const { return m_sizes.data(); }
+		const uint32_t* GetSourceOperands() const { return m_sourceOperands.data(); }
+		const uint64_t* GetAddresses() const { return m_addresses.data(); }
+		const uint64_t* GetOperands(size_t operand) const { return m_operands[operand].data(); }
+	};
+
+	BNMediumLevelILOperation MediumLevelILSnapshotExpr::GetOperation() const
+	{
+		return m_snapshot->GetOperations()[m_exprIndex];
+	}
+	uint32_t MediumLevelILSnapshotExpr::GetAttributes() const
+	{
+		return m_snapshot->GetAttributes()[m_exprIndex];
+	}
+	size_t MediumLevelILSnapshotExpr::GetSize() const
+	{
+		return m_snapshot->GetSizes()[m_exprIndex];
+	}
+	uint32_t MediumLevelILSnapshotExpr::GetSourceOperand() const
+	{
+		return m_snapshot->GetSourceOperands()[m_exprIndex];
+	}
+	uint64_t MediumLevelILSnapshotExpr::GetAddress() const
+	{
+		return m_snapshot->GetAddresses()[m_exprIndex];
+	}
+	uint64_t MediumLevelILSnapshotExpr::GetRawOperand(size_t operand) const
+	{
+		return m_snapshot->GetOperands(operand)[m_exprIndex];
+	}
+#endif
+
 	/*!
 		\ingroup mediumlevelil
 	*/
@@ -1708,6 +2170,229 @@ namespace BinaryNinja
 	struct MediumLevelILInstructionAccessor<MLIL_FTRUNC> : public MediumLevelILOneOperandInstruction
 	{};
 
+	template <typename T>
+	void MediumLevelILInstruction::ForEachSubExpr(T&& func) const
+	{
+		switch (operation)
+		{
+		case MLIL_SET_VAR:
+			func(GetSourceExpr<MLIL_SET_VAR>());
+			break;
+		case MLIL_SET_VAR_SSA:
+			func(GetSourceExpr<MLIL_SET_VAR_SSA>());
+			break;
+		case MLIL_SET_VAR_ALIASED:
+			func(GetSourceExpr<MLIL_SET_VAR_ALIASED>());
+			break;
+		case MLIL_SET_VAR_SPLIT:
+			func(GetSourceExpr<MLIL_SET_VAR_SPLIT>());
+			break;
+		case MLIL_SET_VAR_SPLIT_SSA:
+			func(GetSourceExpr<MLIL_SET_VAR_SPLIT_SSA>());
+			break;
+		case MLIL_SET_VAR_FIELD:
+			func(GetSourceExpr<MLIL_SET_VAR_FIELD>());
+			break;
+		case MLIL_SET_VAR_SSA_FIELD:
+			func(GetSourceExpr<MLIL_SET_VAR_SSA_FIELD>());
+			break;
+		case MLIL_SET_VAR_ALIASED_FIELD:
+			func(GetSourceExpr<MLIL_SET_VAR_ALIASED_FIELD>());
+			break;
+		case MLIL_CALL:
+			func(GetDestExpr<MLIL_CALL>());
+			for (auto i : GetParameterExprs<MLIL_CALL>())
+				func(i);
+			break;
+		case MLIL_CALL_UNTYPED:
+			func(GetDestExpr<MLIL_CALL_UNTYPED>());
+			for (auto i : GetParameterExprs<MLIL_CALL_UNTYPED>())
+				func(i);
+			break;
+		case MLIL_CALL_SSA:
+			func(GetDestExpr<MLIL_CALL_SSA>());
+			for (auto i : GetParameterExprs<MLIL_CALL_SSA>())
+				func(i);
+			break;
+		case MLIL_CALL_UNTYPED_SSA:
+			func(GetDestExpr<MLIL_CALL_UNTYPED_SSA>());
+			for (auto i : GetParameterExprs<MLIL_CALL_UNTYPED_SSA>())
+				func(i);
+			break;
+		case MLIL_SYSCALL:
+			for (auto i : GetParameterExprs<MLIL_SYSCALL>())
+				func(i);
+			break;
+		case MLIL_SYSCALL_UNTYPED:
+			for (auto i : GetParameterExprs<MLIL_SYSCALL_UNTYPED>())
+				func(i);
+			break;
+		case MLIL_SYSCALL_SSA:
+			for (auto i : GetParameterExprs<MLIL_SYSCALL_SSA>())
+				func(i);
+			break;
+		case MLIL_SYSCALL_UNTYPED_SSA:
+			for (auto i : GetParameterExprs<MLIL_SYSCALL_UNTYPED_SSA>())
+				func(i);
+			break;
+		case MLIL_TAILCALL:
+			func(GetDestExpr<MLIL_TAILCALL>());
+			for (auto i : GetParameterExprs<MLIL_TAILCALL>())
+				func(i);
+			break;
+		case MLIL_TAILCALL_UNTYPED:
+			func(GetDestExpr<MLIL_TAILCALL_UNTYPED>());
+			for (auto i : GetParameterExprs<MLIL_TAILCALL_UNTYPED>())
+				func(i);
+			break;
+		case MLIL_TAILCALL_SSA:
+			func(GetDestExpr<MLIL_TAILCALL_SSA>());
+			for (auto i : GetParameterExprs<MLIL_TAILCALL_SSA>())
+				func(i);
+			break;
+		case MLIL_TAILCALL_UNTYPED_SSA:
+			func(GetDestExpr<MLIL_TAILCALL_UNTYPED_SSA>());
+			for (auto i : GetParameterExprs<MLIL_TAILCALL_UNTYPED_SSA>())
+				func(i);
+			break;
+		case MLIL_SEPARATE_PARAM_LIST:
+			for (auto i : GetParameterExprs<MLIL_SEPARATE_PARAM_LIST>())
+				func(i);
+			break;
+		case MLIL_SHARED_PARAM_SLOT:
+			for (auto i : GetParameterExprs<MLIL_SHARED_PARAM_SLOT>())
+				func(i);
+			break;
+		case MLIL_RET:
+			for (auto i : GetSourceExprs<MLIL_RET>())
+				func(i);
+			break;
+		case MLIL_STORE:
+			func(GetDestExpr<MLIL_STORE>());
+			func(GetSourceExpr<MLIL_STORE>());
+			break;
+		case MLIL_STORE_STRUCT:
+			func(GetDestExpr<MLIL_STORE_STRUCT>());
+			func(GetSourceExpr<MLIL_STORE_STRUCT>());
+			break;
+		case MLIL_STORE_SSA:
+			func(GetDestExpr<MLIL_STORE_SSA>());
+			func(GetSourceExpr<MLIL_STORE_SSA>());
+			break;
+		case MLIL_STORE_STRUCT_SSA:
+			func(GetDestExpr<MLIL_STORE_STRUCT_SSA>());
+			func(GetSourceExpr<MLIL_STORE_STRUCT_SSA>());
+			break;
+		case MLIL_NEG:
+		case MLIL_NOT:
+		case MLIL_SX:
+		case MLIL_ZX:
+		case MLIL_LOW_PART:
+		case MLIL_BOOL_TO_INT:
+		case MLIL_JUMP:
+		case MLIL_JUMP_TO:
+		case MLIL_RET_HINT:
+		case MLIL_IF:
+		case MLIL_UNIMPL_MEM:
+		case MLIL_LOAD:
+		case MLIL_LOAD_STRUCT:
+		case MLIL_LOAD_SSA:
+		case MLIL_LOAD_STRUCT_SSA:
+		case MLIL_FSQRT:
+		case MLIL_FNEG:
+		case MLIL_FABS:
+		case MLIL_FLOAT_TO_INT:
+		case MLIL_INT_TO_FLOAT:
+		case MLIL_FLOAT_CONV:
+		case MLIL_ROUND_TO_INT:
+		case MLIL_FLOOR:
+		case MLIL_CEIL:
+		case MLIL_FTRUNC:
+			func(AsOneOperand().GetSourceExpr());
+			break;
+		case MLIL_ADD:
+		case MLIL_SUB:
+		case MLIL_AND:
+		case MLIL_OR:
+		case MLIL_XOR:
+		case MLIL_LSL:
+		case MLIL_LSR:
+		case MLIL_ASR:
+		case MLIL_ROL:
+		case MLIL_ROR:
+		case MLIL_MUL:
+		case MLIL_MULU_DP:
+		case MLIL_MULS_DP:
+		case MLIL_DIVU:
+		case MLIL_DIVS:
+		case MLIL_MODU:
+		case MLIL_MODS:
+		case MLIL_DIVU_DP:
+		case MLIL_DIVS_DP:
+		case MLIL_MODU_DP:
+		case MLIL_MODS_DP:
+		case MLIL_CMP_E:
+		case MLIL_CMP_NE:
+		case MLIL_CMP_SLT:
+		case MLIL_CMP_ULT:
+		case MLIL_CMP_SLE:
+		case MLIL_CMP_ULE:
+		case MLIL_CMP_SGE:
+		case MLIL_CMP_UGE:
+		case MLIL_CMP_SGT:
+		case MLIL_CMP_UGT:
+		case MLIL_TEST_BIT:
+		case MLIL_ADD_OVERFLOW:
+		case MLIL_FADD:
+		case MLIL_FSUB:
+		case MLIL_FMUL:
+		case MLIL_FDIV:
+		case MLIL_FCMP_E:
+		case MLIL_FCMP_NE:
+		case MLIL_FCMP_LT:
+		case MLIL_FCMP_LE:
+		case MLIL_FCMP_GE:
+		case MLIL_FCMP_GT:
+		case MLIL_FCMP_O:
+		case MLIL_FCMP_UO:
+			func(AsTwoOperand().GetLeftExpr());
+			func(AsTwoOperand().GetRightExpr());
+			break;
+		case MLIL_ADC:
+		case MLIL_SBB:
+		case MLIL_RLC:
+		case MLIL_RRC:
+			func(AsTwoOperandWithCarry().GetLeftExpr());
+			func(AsTwoOperandWithCarry().GetRightExpr());
+			func(AsTwoOperandWithCarry().GetCarryExpr());
+			break;
+		case MLIL_INTRINSIC:
+			for (auto i : GetParameterExprs<MLIL_INTRINSIC>())
+				func(i);
+			break;
+		case MLIL_INTRINSIC_SSA:
+		case MLIL_MEMORY_INTRINSIC_SSA:
+			for (auto i : GetParameterExprs())
+				func(i);
+			break;
+		default:
+			break;
+		}
+	}
+
+	template <typename PreFunc>
+	bool MediumLevelILInstruction::WalkExprs(PreFunc&& preFunc) const
+	{
+		auto postFunc = [](const MediumLevelILInstruction&) {};
+		return WalkILExprs<false>(*this, preFunc, postFunc);
+	}
+
+	template <typename PreFunc, typename PostFunc>
+	bool MediumLevelILInstruction::WalkExprs(PreFunc&& preFunc, PostFunc&& postFunc) const
+	{
+		return WalkILExprs<true>(*this, preFunc, postFunc);
+	}
+
 #undef _STD_VECTOR
 #undef _STD_SET
 #undef _STD_UNORDERED_MAP
@@ -0,0 +1,59 @@
+// Copyright (c) 2015-2024 Vector 35 Inc
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+
+#include <shared_mutex>
+#include <unordered_set>
+#include "binaryninjaapi.h"
+
+using namespace BinaryNinja;
+using namespace std;
+
+
+// Interned strings are never removed, and unordered_set never moves its elements, so references
+// to them stay valid
+struct StringInternTableStorage
+{
+	shared_mutex mutex;
+	unordered_set<string> strings;
+};
+
+
+static StringInternTableStorage& GetStorage()
+{
+	// Intentionally leaked, interned strings must outlive any static destructors that reference them
+	static StringInternTableStorage* storage = new StringInternTableStorage;
+	return *storage;
+}
+
+
+const string& StringInternTable::InternString(const string& str)
+{
+	StringInternTableStorage& storage = GetStorage();
+	{
+		shared_lock<shared_mutex> lock(storage.mutex);
+		auto i = storage.strings.find(str);
+		if (i != storage.strings.end())
+			return *i;
+	}
+
+	unique_lock<shared_mutex> lock(storage.mutex);
+	return *storage.strings.insert(str).first;
+}
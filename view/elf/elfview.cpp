@@ -31,6 +31,15 @@ void BinaryNinja::InitElfViewType()
 		"description" : "Maximum number of entries to include in section header array",
 		"ignore" : ["SettingsProjectScope"]
 		})");
+
+	settings->RegisterSetting("files.elf.lazyDynamicSymbols",
+		R"({
+		"title" : "Lazy ELF Dynamic Symbols",
+		"type" : "boolean",
+		"default" : false,
+		"description" : "Define the symbols exported by shared objects in a background task after loading instead of during loading. Exported symbols that are needed while loading are defined immediately.",
+		"ignore" : ["SettingsProjectScope"]
+		})");
 }
 
 
@@ -362,12 +371,12 @@ bool ElfView::ParseSymbolTableEntry(BinaryReader& reader, ElfSymbolTableEntry& e
 		{
 			if (entry.section < m_elfSections.size())
 			{
-				entry.name = ReadStringTable(reader, m_sectionStringTable, m_elfSections[entry.section].name);
+				entry.name = ReadStringTableView(reader, m_sectionStringTable, m_elfSections[entry.section].name);
 			}
 		}
 		else
 		{
-			entry.name = ReadStringTable(reader, stringTable, entry.nameOffset);
+			entry.name = ReadStringTableView(reader, stringTable, entry.nameOffset);
 		}
 	}
 	catch (ReadException&)
@@ -384,7 +393,7 @@ bool ElfView::ParseSymbolTableEntry(BinaryReader& reader, ElfSymbolTableEntry& e
 		"\tsection    = %#04x\n"
 		"\tvalue      = %#012lx\n"
 		"\tsize       = %#012lx\n"
-		"\tname       = %#s",
+		"\tname       = %.*s",
 		sym, symbolTable.offset, stringTable.offset,
 		entry.nameOffset,
 		entry.type,
@@ -393,7 +402,7 @@ bool ElfView::ParseSymbolTableEntry(BinaryReader& reader, ElfSymbolTableEntry& e
 		entry.section,
 		entry.value,
 		entry.size,
-		entry.name.c_str());
+		(int)entry.name.size(), entry.name.data());
 	return true;
 }
 
@@ -406,7 +415,37 @@ void ElfView::GetRelocEntries(BinaryReader& reader, const vector<Elf64SectionHea
 
 	for (auto& section : sections)
 	{
-		for (uint64_t j = 0; j < section.size / relocSize; j++)
+		// Read the whole section as an array of words in host byte order and decode the entries from it
+		size_t count = (size_t)(section.size / relocSize);
+		size_t wordSize = m_elf32 ? 4 : 8;
+		size_t wordsPerEntry = relocSize / wordSize;
+		vector<uint64_t> words64;
+		vector<uint32_t> words32;
+		reader.Seek(section.offset);
+		bool bulk = m_elf32 ? reader.TryReadArray(words32, count * wordsPerEntry) :
+			reader.TryReadArray(words64, count * wordsPerEntry);
+		if (bulk)
+		{
+			size_t first = result.size();
+			result.resize(first + count, ELFRelocEntry(0, 0, 0, 0, 0, false));
+			ParallelForRanges(count, 0x10000, [&](size_t begin, size_t end) {
+				for (size_t j = begin; j < end; j++)
+				{
+					size_t word = j * wordsPerEntry;
+					uint64_t ofs = m_elf32 ? words32[word] : words64[word];
+					uint64_t info = m_elf32 ? words32[word + 1] : words64[word + 1];
+					uint64_t addend = 0;
+					if (!implicit)
+						addend = m_elf32 ? words32[word + 2] : words64[word + 2];
+					result[first + j] = ELFRelocEntry(ofs, info >> (m_elf32 ? 8 : 32),
+						info & (m_elf32 ? 0xff : 0xffffffff), addend, section.info, implicit);
+				}
+			});
+			continue;
+		}
+
+		// The section extends past the end of the data, read entry by entry so that the valid entries are kept
+		for (uint64_t j = 0; j < count; j++)
 		{
 			reader.Seek(section.offset + (j * relocSize));
 			uint64_t ofs = m_elf32 ? reader.Read32() : reader.Read64();
@@ -457,6 +496,7 @@ bool ElfView::Init()
 	Ref<Settings> viewSettings = Settings::Instance();
 	m_extractMangledTypes = viewSettings->Get<bool>("analysis.extractTypesFromMangledNames", this);
 	m_simplifyTemplates = viewSettings->Get<bool>("analysis.types.templateSimplifier", this);
+	m_lazyDynamicSymbols = viewSettings->Get<bool>("files.elf.lazyDynamicSymbols", this);
 
 	Ref<Settings> settings = GetLoadSettings(GetTypeName());
 	if (settings)
@@ -747,6 +787,7 @@ bool ElfView::Init()
 	if (m_parseOnly)
 	{
 		m_stringTableCache.clear();
+		m_symbolNameStorage.clear();
 		return true;
 	}
 
@@ -1051,6 +1092,17 @@ bool ElfView::Init()
 		// Parse and create types for ELF GNU hash table
 		if (m_gnuHashHeader)
 		{
+			// The symbol count also bounds the chain walks of FindDynamicSymbol, which is left without a
+			// GNU hash lookup when the table is malformed
+			try
+			{
+				m_gnuHashSymbolCount = GetGnuHashSymbolCount(virtualReader);
+			}
+			catch (ReadException&)
+			{
+				m_gnuHashSymbolCount = 0;
+			}
+
 			// try to extract dynamic symbol table size from section information if it exists
 			if (!m_auxSymbolTable.size)
 			{
@@ -1059,7 +1111,10 @@ bool ElfView::Init()
 					m_auxSymbolTable.size = sections[0]->GetLength();
 				else
 				{
-					// TODO section information not available; calculate the dynamic symbol table size from the gnu hash table
+					// Section information is not available, the GNU hash table chains tell how many symbols there are
+					if (!m_gnuHashSymbolCount)
+						throw ReadException();
+					m_auxSymbolTable.size = m_gnuHashSymbolCount * m_auxSymbolTableEntrySize;
 				}
 			}
 		}
@@ -1181,6 +1236,9 @@ bool ElfView::Init()
 		combinedSymbolTable.insert(combinedSymbolTable.end(), auxSymbolTable.begin() + 1, auxSymbolTable.end());
 	for (auto entry = combinedSymbolTable.begin(); entry != combinedSymbolTable.end(); entry++)
 	{
+		// In lazy mode symbols exported by a shared object are recorded here and defined later
+		m_deferringSymbols = m_lazyDynamicSymbols && !m_objectFile && entry->dynamic && (entry->section != ELF_SHN_UNDEF);
+
 		if (m_objectFile)
 		{
 			if (entry->section >= m_elfSections.size())
@@ -1306,6 +1364,10 @@ bool ElfView::Init()
 		}
 	}
 
+	m_deferringSymbols = false;
+	sort(m_deferredSymbols.begin(), m_deferredSymbols.end(),
+		[](const DeferredElfSymbol& a, const DeferredElfSymbol& b) { return a.addr < b.addr; });
+
 	// Process the queued symbols
 	m_symbolQueue->Process();
 	delete m_symbolQueue;
@@ -1318,42 +1380,88 @@ bool ElfView::Init()
 	{
 		try
 		{
-			for (auto& reloc: relocs)
+			// In unlinked images reloc.offset is relative to the info section specified. Resolve the sections up
+			// front, once per info section, so that the records below can be filled in without touching the view.
+			size_t count = relocs.size();
+			bool invalidSection = false;
+			vector<uint8_t> skipped;
+			if (m_objectFile)
 			{
-				BNRelocationInfo relocInfo;
-				memset(&relocInfo, 0, sizeof(BNRelocationInfo));
-				if (m_objectFile)
+				map<size_t, Ref<Section>> infoSections;
+				skipped.resize(count);
+				for (size_t i = 0; i < count; i++)
 				{
-					// In unlinked images reloc.offset is relative to the info section specified
+					auto& reloc = relocs[i];
 					if (reloc.sectionIdx >= m_elfSections.size())
-						throw ReadException();
-					auto sectionName = ReadStringTable(reader, m_sectionStringTable, m_elfSections[reloc.sectionIdx].name);
-					auto sec = GetSectionByName(sectionName);
-					if (!sec)
+					{
+						count = i;
+						invalidSection = true;
+						break;
+					}
+					auto [itr, inserted] = infoSections.try_emplace(reloc.sectionIdx);
+					if (inserted)
+						itr->second = GetSectionByName(ReadStringTable(reader, m_sectionStringTable, m_elfSections[reloc.sectionIdx].name));
+					if (!itr->second)
+					{
+						skipped[i] = 1;
+						continue;
+					}
+					reloc.offset += itr->second->GetStart() - imageBaseAdjustment;
+				}
+			}
+
+			// Each range gets its own buffered reader for the relocation data, relocations are usually sorted by
+			// address so most reads are served from the read-ahead window
+			size_t first = m_relocationInfo.size();
+			m_relocationInfo.resize(first + count);
+			ParallelForRanges(count, 0x4000, [&](size_t begin, size_t end) {
+				BinaryReader dataReader(this);
+				dataReader.SetBufferSize();
+				for (size_t i = begin; i < end; i++)
+				{
+					if (!skipped.empty() && skipped[i])
 						continue;
-					reloc.offset += sec->GetStart() - imageBaseAdjustment;
+					const auto& reloc = relocs[i];
+					BNRelocationInfo& relocInfo = m_relocationInfo[first + i];
+					memset(&relocInfo, 0, sizeof(BNRelocationInfo));
+					relocInfo.symbolIndex = reloc.sym;
+					relocInfo.address = reloc.offset;
+					relocInfo.nativeType = reloc.relocType;
+					relocInfo.addend = reloc.addend;
+					relocInfo.implicitAddend = reloc.implicit;
+					relocInfo.base = baseAddress;
+					dataReader.Seek(relocInfo.address);
+					dataReader.TryRead(relocInfo.relocationDataCache, MAX_RELOCATION_SIZE);
 				}
+			});
 
-				relocInfo.symbolIndex = reloc.sym;
-				relocInfo.address = reloc.offset;
-				relocInfo.nativeType = reloc.relocType;
-				relocInfo.addend = reloc.addend;
-				relocInfo.implicitAddend = reloc.implicit;
-				relocInfo.base = baseAddress;
-				virtualReader.Seek(relocInfo.address);
-				memset(relocInfo.relocationDataCache, 0, sizeof(relocInfo.relocationDataCache));
-				virtualReader.TryRead(relocInfo.relocationDataCache, MAX_RELOCATION_SIZE);
-				m_relocationInfo.push_back(relocInfo);
-
-				if (isArmV7)
+			if (!skipped.empty())
+			{
+				size_t out = first;
+				for (size_t i = 0; i < count; i++)
+				{
+					if (!skipped[i])
+						m_relocationInfo[out++] = m_relocationInfo[first + i];
+				}
+				m_relocationInfo.resize(out);
+			}
+
+			if (isArmV7)
+			{
+				for (size_t i = 0; i < count; i++)
 				{
-					if(reloc.relocType == R_ARM_TLS_DTPOFF32)
-						tlsOffsets.push_back(reloc.offset);
-					else if(reloc.relocType == R_ARM_TLS_DTPMOD32)
-						tlsModuleStarts.push_back(reloc.offset);
+					if (!skipped.empty() && skipped[i])
+						continue;
+					if (relocs[i].relocType == R_ARM_TLS_DTPOFF32)
+						tlsOffsets.push_back(relocs[i].offset);
+					else if (relocs[i].relocType == R_ARM_TLS_DTPMOD32)
+						tlsModuleStarts.push_back(relocs[i].offset);
 				}
 			}
 
+			if (invalidSection)
+				throw ReadException();
+
 			if (relocHandler->GetRelocationInfo(this, m_arch, m_relocationInfo))
 			{
 				vector<ElfSymbolTableEntry>* symTable = &symbolTable;
@@ -1391,7 +1499,7 @@ bool ElfView::Init()
 						if (entry.type == ELF_STT_SECTION)
 						{
 							// Section relative relocation
-							if (auto section = GetSectionByName(entry.name); section)
+							if (auto section = GetSectionByName(string(entry.name)); section)
 							{
 								DefineRelocation(m_arch, relocInfo, section->GetStart(), relocInfo.address);
 								continue;
@@ -1402,39 +1510,40 @@ bool ElfView::Init()
 							// handle anonymous symbol generation
 							if (!entry.name.size())
 							{
-								entry.name = "anonymous_";
+								string anonymousName = "anonymous_";
 								if (entry.type == ELF_STT_FUNC)
-									entry.name += "func";
+									anonymousName += "func";
 								else if (entry.type == ELF_STT_OBJECT)
-									entry.name += "object";
+									anonymousName += "object";
 								else
-									entry.name += "data";
-								entry.name += "_";
+									anonymousName += "data";
+								anonymousName += "_";
 
 								switch(entry.binding)
 								{
 									case NoBinding:
-										entry.name += "bind_none";
+										anonymousName += "bind_none";
 										break;
 									case LocalBinding:
-										entry.name += "bind_local";
+										anonymousName += "bind_local";
 										break;
 									case GlobalBinding:
-										entry.name += "bind_global";
+										anonymousName += "bind_global";
 										break;
 									case WeakBinding:
-										entry.name += "bind_weak";
+										anonymousName += "bind_weak";
 										break;
 									default:
 										break;
 								}
-								entry.name += "_";
-								entry.name += std::to_string(anonymousEntryCount++);
+								anonymousName += "_";
+								anonymousName += std::to_string(anonymousEntryCount++);
+								entry.name = StoreSymbolName(std::move(anonymousName));
 								DefineElfSymbol(ExternalSymbol, entry.name, 0, false, entry.binding, entry.size);
 							}
 
 							// section undefined so query for external symbol directly
-							auto symbol = GetSymbolByRawName(entry.name, GetExternalNameSpace());
+							auto symbol = GetSymbolByRawName(string(entry.name), GetExternalNameSpace());
 							if (symbol)
 							{
 								DefineRelocation(m_arch, relocInfo, symbol, relocInfo.address);
@@ -1445,7 +1554,7 @@ bool ElfView::Init()
 						{
 							// symbol is relative to a section, look up by address instead of name to avoid ambiguity
 							uint64_t target = m_elfSections[entry.section].address + entry.value;
-							auto symbol = GetSymbolByAddress(target);
+							auto symbol = GetElfSymbolByAddress(target);
 							if (symbol)
 							{
 								DefineRelocation(m_arch, relocInfo, symbol, relocInfo.address);
@@ -1454,7 +1563,9 @@ bool ElfView::Init()
 						}
 
 						// retrieve first symbol that is not a symbol relocation
-						auto symbols = GetSymbolsByName(entry.name);
+						if (m_lazyDynamicSymbols)
+							MaterializeDeferredSymbols(virtualReader, entry.name, imageBaseAdjustment);
+						auto symbols = GetSymbolsByName(string(entry.name));
 						for (const auto& symbol : symbols)
 						{
 							if (symbol->GetAddress() == relocInfo.address)
@@ -1484,7 +1595,7 @@ bool ElfView::Init()
 
 			if (!m_backedByDatabase) // Don't create symbols that are present in the database snapshot now
 			{
-				auto symbol = GetSymbolByAddress(section->GetStart());
+				auto symbol = GetElfSymbolByAddress(section->GetStart());
 				if (!symbol)
 					DefineAutoSymbol(new Symbol(FunctionSymbol, autoSectionName, section->GetStart(), GlobalBinding));
 			}
@@ -1508,7 +1619,7 @@ bool ElfView::Init()
 			// trim the first '.' from the section name
 			string autoSectionName = section->GetName().substr(1);
 			// define a symbol for the array
-			if (auto symbol = GetSymbolByAddress(section->GetStart()); !symbol)
+			if (auto symbol = GetElfSymbolByAddress(section->GetStart()); !symbol)
 				DefineAutoSymbol(new Symbol(DataSymbol, autoSectionName, section->GetStart(), NoBinding));
 
 			virtualReader.Seek(section->GetStart());
@@ -1557,7 +1668,7 @@ bool ElfView::Init()
 					m_logger->LogDebug("Adding function start: %#" PRIx64 "\n", entry);
 
 					// name functions in .init_array, .fini_array, .ctors and .dtors
-					if (!GetSymbolByAddress(entry))
+					if (!GetElfSymbolByAddress(entry))
 					{
 						if (section->GetName() == ".init_array")
 							DefineElfSymbol(FunctionSymbol, "_INIT_" + std::to_string(i), entry, false, GlobalBinding);
@@ -1647,7 +1758,7 @@ bool ElfView::Init()
 	}
 
 	// Add a symbol for the entry point
-	if (entryPointAddress && (entryPointAddress != GetStart()) && !GetSymbolByAddress(entryPointAddress))
+	if (entryPointAddress && (entryPointAddress != GetStart()) && !GetElfSymbolByAddress(entryPointAddress))
 		DefineAutoSymbol(new Symbol(FunctionSymbol, "_start", entryPointAddress, GlobalBinding));
 
 	// Create type for ELF identification
@@ -2296,18 +2407,32 @@ bool ElfView::Init()
 	double t = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime).count() / 1000.0;
 	m_logger->LogInfo("ELF parsing took %.3f seconds\n", t);
 	m_stringTableCache.clear();
+	m_symbolNameStorage.clear();
+
+	if (!m_deferredSymbols.empty())
+	{
+		Ref<BackgroundTask> task = new BackgroundTask("Loading ELF dynamic symbols", true);
+		Ref<ElfView> self = this;
+		WorkerEnqueue([self, task]() { self->DefineDeferredSymbols(task); }, "ElfView::DefineDeferredSymbols");
+	}
 	return true;
 }
 
 
-void ElfView::DefineElfSymbol(BNSymbolType type, const string& incomingName, uint64_t addr, bool gotEntry,
+void ElfView::DefineElfSymbol(BNSymbolType type, string_view incomingName, uint64_t addr, bool gotEntry,
 	BNSymbolBinding binding, size_t size, Ref<Type> typeObj)
 {
 	// Ensure symbol is within the executable
 	if (type != ExternalSymbol && !IsValidOffset(addr))
 		return;
 
-	string name = incomingName;
+	if (m_deferringSymbols)
+	{
+		m_deferredSymbols.push_back({type, string(incomingName), addr, gotEntry, binding, size, typeObj, false});
+		return;
+	}
+
+	string name(incomingName);
 	Ref<Type> symbolTypeRef;
 	if ((type == ExternalSymbol) || (type == ImportAddressSymbol) || (type == ImportedDataSymbol))
 	{
@@ -2416,6 +2541,180 @@ void ElfView::DefineElfSymbol(BNSymbolType type, const string& incomingName, uin
 }
 
 
+void ElfView::MaterializeDeferredSymbols(uint64_t addr)
+{
+	unique_lock<mutex> lock(m_deferredSymbolMutex);
+	auto itr = lower_bound(m_deferredSymbols.begin(), m_deferredSymbols.end(), addr,
+		[](const DeferredElfSymbol& symbol, uint64_t addr) { return symbol.addr < addr; });
+	for (; (itr != m_deferredSymbols.end()) && (itr->addr == addr); itr++)
+	{
+		if (itr->defined)
+			continue;
+		itr->defined = true;
+		DefineElfSymbol(itr->type, itr->name, itr->addr, itr->gotEntry, itr->binding, itr->size, itr->typeObj);
+	}
+}
+
+
+void ElfView::MaterializeDeferredSymbols(BinaryReader& reader, string_view name, int64_t imageBaseAdjustment)
+{
+	ElfSymbolTableEntry entry;
+	if (FindDynamicSymbol(reader, name, entry) && (entry.section != ELF_SHN_UNDEF))
+		MaterializeDeferredSymbols(entry.value + imageBaseAdjustment);
+}
+
+
+void ElfView::DefineDeferredSymbols(Ref<BackgroundTask> task)
+{
+	const size_t chunkSize = 0x1000;
+	size_t total = m_deferredSymbols.size();
+	for (size_t start = 0; (start < total) && !task->IsCancelled(); start += chunkSize)
+	{
+		task->SetProgressText(fmt::format("Loading ELF dynamic symbols ({}/{})", start, total));
+		BeginBulkModifySymbols();
+		{
+			unique_lock<mutex> lock(m_deferredSymbolMutex);
+			for (size_t i = start; i < min(start + chunkSize, total); i++)
+			{
+				DeferredElfSymbol& symbol = m_deferredSymbols[i];
+				if (symbol.defined)
+					continue;
+				symbol.defined = true;
+				DefineElfSymbol(symbol.type, symbol.name, symbol.addr, symbol.gotEntry, symbol.binding, symbol.size,
+					symbol.typeObj);
+			}
+		}
+		EndBulkModifySymbols();
+	}
+	task->Finish();
+}
+
+
+Ref<Symbol> ElfView::GetElfSymbolByAddress(uint64_t addr)
+{
+	if (m_lazyDynamicSymbols)
+		MaterializeDeferredSymbols(addr);
+	return GetSymbolByAddress(addr);
+}
+
+
+// Looks up an exported symbol of the dynamic symbol table through DT_GNU_HASH, or DT_HASH if there is no GNU hash table
+bool ElfView::FindDynamicSymbol(BinaryReader& reader, string_view name, ElfSymbolTableEntry& entry)
+{
+	if (!m_auxSymbolTable.offset)
+		return false;
+
+	try
+	{
+		if (m_gnuHashHeader && m_gnuHashSymbolCount)
+		{
+			uint32_t hash = 5381;
+			for (char c : name)
+				hash = (hash * 33) + (uint8_t)c;
+
+			reader.Seek(m_gnuHashHeader);
+			uint32_t bucketCount = reader.Read32();
+			uint32_t symbolOffset = reader.Read32();
+			uint32_t bloomSize = reader.Read32();
+			if (bucketCount == 0)
+				return false;
+			uint64_t buckets = m_gnuHashHeader + 16 + ((uint64_t)bloomSize * m_addressSize);
+			uint64_t chains = buckets + ((uint64_t)bucketCount * 4);
+
+			reader.Seek(buckets + ((hash % bucketCount) * 4));
+			uint32_t index = reader.Read32();
+			if (index < symbolOffset)
+				return false;
+			for (; index < m_gnuHashSymbolCount; index++)
+			{
+				reader.Seek(chains + ((uint64_t)(index - symbolOffset) * 4));
+				uint32_t chainHash = reader.Read32();
+				if (((chainHash | 1) == (hash | 1))
+					&& ParseSymbolTableEntry(reader, entry, index, m_auxSymbolTable, m_dynamicStringTable, true)
+					&& (entry.name == name))
+					return true;
+				if (chainHash & 1)
+					return false;
+			}
+			return false;
+		}
+
+		if (m_hashHeader)
+		{
+			uint32_t hash = 0;
+			for (char c : name)
+			{
+				hash = (hash << 4) + (uint8_t)c;
+				uint32_t high = hash & 0xf0000000;
+				if (high)
+					hash ^= high >> 24;
+				hash &= ~high;
+			}
+
+			reader.Seek(m_hashHeader);
+			uint32_t bucketCount = reader.Read32();
+			uint32_t chainCount = reader.Read32();
+			if (bucketCount == 0)
+				return false;
+
+			reader.Seek(m_hashHeader + 8 + ((hash % bucketCount) * 4));
+			uint32_t index = reader.Read32();
+			for (uint32_t steps = 0; (index != 0) && (index < chainCount) && (steps < chainCount); steps++)
+			{
+				if (ParseSymbolTableEntry(reader, entry, index, m_auxSymbolTable, m_dynamicStringTable, true)
+					&& (entry.name == name))
+					return true;
+				reader.Seek(m_hashHeader + 8 + (((uint64_t)bucketCount + index) * 4));
+				index = reader.Read32();
+			}
+		}
+	}
+	catch (ReadException&)
+	{
+	}
+	return false;
+}
+
+
+// The number of dynamic symbols is one past the last symbol of the longest chain, which ends with an odd hash
+uint64_t ElfView::GetGnuHashSymbolCount(BinaryReader& reader)
+{
+	// The buckets and chains must lie within the file backed part of the segment holding the table. This
+	// rejects corrupt bucket counts before allocating and stops chain walks that never find an odd hash.
+	Ref<Segment> segment = GetSegmentAt(m_gnuHashHeader);
+	if (!segment)
+		throw ReadException();
+	uint64_t end = segment->GetStart() + segment->GetDataLength();
+
+	reader.Seek(m_gnuHashHeader);
+	uint32_t bucketCount = reader.Read32();
+	uint32_t symbolOffset = reader.Read32();
+	uint32_t bloomSize = reader.Read32();
+	uint64_t buckets = m_gnuHashHeader + 16 + ((uint64_t)bloomSize * m_addressSize);
+	if ((buckets > end) || (((uint64_t)bucketCount * 4) > (end - buckets)))
+		throw ReadException();
+	uint64_t chains = buckets + ((uint64_t)bucketCount * 4);
+
+	vector<uint32_t> bucketValues;
+	reader.Seek(buckets);
+	if (!reader.TryReadArray(bucketValues, bucketCount))
+		throw ReadException();
+	uint32_t last = 0;
+	for (uint32_t bucket : bucketValues)
+		last = max(last, bucket);
+	if (last < symbolOffset)
+		return symbolOffset;
+
+	for (uint64_t chain = chains + (((uint64_t)last - symbolOffset) * 4); (chain + 4) <= end; chain += 4)
+	{
+		reader.Seek(chain);
+		if (reader.Read32() & 1)
+			return symbolOffset + ((chain - chains) / 4) + 1;
+	}
+	throw ReadException();
+}
+
+
 void ElfView::ApplyTypesToParentStringTable(const Elf64SectionHeader& section, const bool offset)
 {
 	m_logger->LogInfo("Found string table of size %p at offset %p", section.size, section.offset);
@@ -2486,29 +2785,57 @@ void ElfView::ApplyTypesToStringTable(const Elf64SectionHeader& section, const i
 }
 
 
-string ElfView::ReadStringTable(BinaryReader& reader, const Elf64SectionHeader& section, uint64_t offset)
+const vector<char>* ElfView::LoadStringTable(BinaryReader& reader, const Elf64SectionHeader& section)
 {
-	if (offset == 0 || offset > section.size)
-		return "";
-
 	auto itr = m_stringTableCache.find(section.offset);
 	if (itr == m_stringTableCache.end())
 	{
 		if (section.size > GetParentView()->GetLength())
 		{
 			m_logger->LogError("Unable to read string table with section offset: 0x%" PRIx64 " size: 0x%" PRIx64, section.offset, section.size);
-			return "";
+			return nullptr;
 		}
 
-		std::vector<char>& tableCache = m_stringTableCache[section.offset];
-		tableCache.resize(section.size);
+		std::vector<char> tableCache(section.size);
 		reader.Seek(section.offset);
 		reader.Read(tableCache.data(), section.size);
-		itr = m_stringTableCache.find(section.offset);
+		itr = m_stringTableCache.emplace(section.offset, std::move(tableCache)).first;
 	}
+	return &itr->second;
+}
+
+
+static string_view GetStringTableEntry(const vector<char>& table, uint64_t offset)
+{
+	if (offset >= table.size())
+		return {};
+	const char* start = table.data() + offset;
+	const char* end = (const char*)memchr(start, 0, table.size() - offset);
+	return string_view(start, end ? (size_t)(end - start) : (size_t)(table.size() - offset));
+}
 
-	const std::vector<char>& tableCache = itr->second;
-	return std::string(&tableCache[offset], strlen(tableCache.data() + offset));
+
+string_view ElfView::ReadStringTableView(BinaryReader& reader, const Elf64SectionHeader& section, uint64_t offset)
+{
+	if (offset == 0 || offset > section.size)
+		return {};
+
+	const vector<char>* table = LoadStringTable(reader, section);
+	if (!table)
+		return {};
+	return GetStringTableEntry(*table, offset);
+}
+
+
+string ElfView::ReadStringTable(BinaryReader& reader, const Elf64SectionHeader& section, uint64_t offset)
+{
+	return string(ReadStringTableView(reader, section, offset));
+}
+
+
+string_view ElfView::StoreSymbolName(string name)
+{
+	return m_symbolNameStorage.emplace_back(std::move(name));
 }
 
 
@@ -2539,30 +2866,128 @@ bool ElfView::DerefPpc64Descriptor(BinaryReader& reader, uint64_t addr, uint64_t
 vector<ElfSymbolTableEntry> ElfView::ParseSymbolTable(BinaryReader& reader, const Elf64SectionHeader& symbolSection,
 	const Elf64SectionHeader& stringSection, bool dynamic, size_t startEntry)
 {
-	size_t size = (size_t)symbolSection.size / (m_elf32 ? 16 : 24);
-	vector<ElfSymbolTableEntry> result;
-	for (size_t i = startEntry; i < size; i++)
+	size_t entrySize = m_elf32 ? 16 : 24;
+	size_t size = (size_t)symbolSection.size / entrySize;
+	vector<ElfSymbolTableEntry> entries;
+	if (startEntry >= size)
+		return entries;
+
+	// Read the whole table with one read, converted to host byte order field by field (Elf32_Sym / Elf64_Sym)
+	static const vector<size_t> elf32SymbolFields = {4, 4, 4, 1, 1, 2};
+	static const vector<size_t> elf64SymbolFields = {4, 1, 1, 2, 8, 8};
+	size_t count = size - startEntry;
+	vector<uint8_t> table;
+	reader.Seek(symbolSection.offset + (startEntry * entrySize));
+	const vector<char>* stringTable = nullptr;
+	const vector<char>* sectionStringTable = nullptr;
+	bool bulk = false;
+	if (reader.CanReadArray(count, entrySize))
+	{
+		table.resize(count * entrySize);
+		bulk = reader.TryReadStructArray(table.data(), count, m_elf32 ? elf32SymbolFields : elf64SymbolFields);
+	}
+	if (bulk)
 	{
-		ElfSymbolTableEntry entry;
-		if (!ParseSymbolTableEntry(reader, entry, i, symbolSection, stringSection, dynamic))
-			break;
+		try
+		{
+			stringTable = LoadStringTable(reader, stringSection);
+			if (m_sectionStringTable.size)
+				sectionStringTable = LoadStringTable(reader, m_sectionStringTable);
+		}
+		catch (ReadException&)
+		{
+			bulk = false;
+		}
+	}
 
-		/* TODO: PPC64 specific symbol handling to be moved to architecture extension for ELF */
-		if (m_commonHeader.arch == EM_PPC64 && entry.type == ELF_STT_FUNC)
+	if (bulk)
+	{
+		auto lookupName = [](const vector<char>* strings, const Elf64SectionHeader& section, uint64_t offset) {
+			if (!strings || offset == 0 || offset > section.size)
+				return string_view();
+			return GetStringTableEntry(*strings, offset);
+		};
+
+		entries.resize(count);
+		ParallelForRanges(count, 0x10000, [&](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; i++)
+			{
+				const uint8_t* record = &table[i * entrySize];
+				ElfSymbolTableEntry& entry = entries[i];
+				uint8_t info;
+				entry.dynamic = dynamic;
+				if (m_elf32)
+				{
+					uint32_t value, size;
+					memcpy(&entry.nameOffset, record, 4);
+					memcpy(&value, record + 4, 4);
+					memcpy(&size, record + 8, 4);
+					info = record[12];
+					entry.other = record[13];
+					memcpy(&entry.section, record + 14, 2);
+					entry.value = value;
+					entry.size = size;
+				}
+				else
+				{
+					memcpy(&entry.nameOffset, record, 4);
+					info = record[4];
+					entry.other = record[5];
+					memcpy(&entry.section, record + 6, 2);
+					memcpy(&entry.value, record + 8, 8);
+					memcpy(&entry.size, record + 16, 8);
+				}
+				entry.type = ELF_ST_TYPE(info);
+				entry.binding = TranslateELFBindingType(ELF_ST_BIND(info));
+
+				if (entry.type == ELF_STT_SECTION)
+				{
+					if (entry.section < m_elfSections.size())
+						entry.name = lookupName(sectionStringTable, m_sectionStringTable, m_elfSections[entry.section].name);
+				}
+				else
+				{
+					entry.name = lookupName(stringTable, stringSection, entry.nameOffset);
+				}
+			}
+		});
+		m_logger->LogDebug("Decoded %zu symbols from symbol table at offset 0x%" PRIx64, count, symbolSection.offset);
+	}
+	else
+	{
+		// The table extends past the end of the file, keep the entries that can be read
+		for (size_t i = startEntry; i < size; i++)
+		{
+			ElfSymbolTableEntry entry;
+			if (!ParseSymbolTableEntry(reader, entry, i, symbolSection, stringSection, dynamic))
+				break;
+			entries.push_back(entry);
+		}
+	}
+
+	/* TODO: PPC64 specific symbol handling to be moved to architecture extension for ELF */
+	if (m_commonHeader.arch != EM_PPC64)
+		return entries;
+
+	vector<ElfSymbolTableEntry> result;
+	result.reserve(entries.size());
+	for (auto& entry : entries)
+	{
+		if (entry.type == ELF_STT_FUNC)
 		{
 			uint64_t func_start;
 			if (DerefPpc64Descriptor(reader, entry.value, func_start))
 			{
-				if (entry.name[0] != '.')
+				if (entry.name.empty() || entry.name[0] != '.')
 				{
 					/* new symbol with function entry as address */
 					ElfSymbolTableEntry entry2 = entry;
-					entry2.name = "." + entry2.name;
+					entry2.name = StoreSymbolName("." + string(entry.name));
 					entry2.value = func_start;
 					result.push_back(entry2);
 
-					m_logger->LogDebug("PPC64 symbol %s=%016x to %s=%016x\n", entry.name.c_str(), entry.value,
-						entry2.name.c_str(), entry2.value);
+					m_logger->LogDebug("PPC64 symbol %.*s=%016x to %s=%016x\n", (int)entry.name.size(), entry.name.data(),
+						entry.value, entry2.name.data(), entry2.value);
 
 					/* force the descriptor to a data symbol */
 					entry.type = ELF_STT_OBJECT;
@@ -1,7 +1,10 @@
 #pragma once
 
 #include "binaryninjaapi.h"
+#include <deque>
 #include <exception>
+#include <mutex>
+#include <string_view>
 
 #define ELF_PT_NULL    0
 #define ELF_PT_LOAD    1
@@ -461,7 +464,7 @@ namespace BinaryNinja
 		uint16_t section;
 		uint64_t value;
 		uint64_t size;
-		std::string name;
+		std::string_view name; // Points into the string table cache or m_symbolNameStorage of the view
 		bool dynamic;
 	};
 
@@ -495,6 +498,24 @@ namespace BinaryNinja
 		bool m_simplifyTemplates;
 		bool m_relocatable = false;
 		std::map<uint64_t, std::vector<char>> m_stringTableCache;
+		std::deque<std::string> m_symbolNameStorage;
+
+		// Exported dynamic symbols that are defined on demand or by a background task in lazy mode
+		struct DeferredElfSymbol
+		{
+			BNSymbolType type;
+			std::string name;
+			uint64_t addr;
+			bool gotEntry;
+			BNSymbolBinding binding;
+			size_t size;
+			Ref<Type> typeObj;
+			bool defined;
+		};
+		bool m_lazyDynamicSymbols = false;
+		bool m_deferringSymbols = false;
+		std::mutex m_deferredSymbolMutex;
+		std::vector<DeferredElfSymbol> m_deferredSymbols;
 
 		// Section and program headers, internally use 64-bit form as it is a superset of 32-bit
 		std::vector<Elf64SectionHeader> m_elfSections;
@@ -511,15 +532,26 @@ namespace BinaryNinja
 		size_t m_numDynamicTableEntries = 0;
 		uint64_t m_hashHeader = 0;
 		uint64_t m_gnuHashHeader = 0;
+		uint64_t m_gnuHashSymbolCount = 0;
 
 		SymbolQueue* m_symbolQueue = nullptr;
 
-		void DefineElfSymbol(BNSymbolType type, const std::string& name, uint64_t addr, bool gotEntry,
+		void DefineElfSymbol(BNSymbolType type, std::string_view name, uint64_t addr, bool gotEntry,
 			BNSymbolBinding binding, size_t size=0, Ref<Type> typeObj=nullptr);
 
+		void MaterializeDeferredSymbols(uint64_t addr);
+		void MaterializeDeferredSymbols(BinaryReader& reader, std::string_view name, int64_t imageBaseAdjustment);
+		void DefineDeferredSymbols(Ref<BackgroundTask> task);
+		Ref<Symbol> GetElfSymbolByAddress(uint64_t addr);
+		bool FindDynamicSymbol(BinaryReader& reader, std::string_view name, ElfSymbolTableEntry& entry);
+		uint64_t GetGnuHashSymbolCount(BinaryReader& reader);
+
 		void ApplyTypesToParentStringTable(const Elf64SectionHeader& section, const bool offset = true);
 		void ApplyTypesToStringTable(const Elf64SectionHeader& section, const int64_t imageBaseAdjustment, const bool offset = true);
 		std::string ReadStringTable(BinaryReader& view, const Elf64SectionHeader& section, uint64_t offset);
+		const std::vector<char>* LoadStringTable(BinaryReader& view, const Elf64SectionHeader& section);
+		std::string_view ReadStringTableView(BinaryReader& view, const Elf64SectionHeader& section, uint64_t offset);
+		std::string_view StoreSymbolName(std::string name);
 		bool ParseSymbolTableEntry(BinaryReader& reader, ElfSymbolTableEntry& entry, uint64_t sym,
 			const Elf64SectionHeader& symbolTable, const Elf64SectionHeader& stringTable, bool dynamic);
 
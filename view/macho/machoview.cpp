@@ -2460,51 +2460,85 @@ bool MachoView::GetSectionPermissions(MachOHeader& header, uint64_t address, uin
 void MachoView::ParseExportTrie(BinaryReader& reader, linkedit_data_command exportTrie)
 {
 	try {
-		uint32_t endGuard = exportTrie.datasize;
 		DataBuffer buffer = GetParentView()->ReadBuffer(m_universalImageOffset + exportTrie.dataoff, exportTrie.datasize);
+		const uint8_t* data = (const uint8_t*)buffer.GetData();
+		size_t end = buffer.GetLength();
+		uint64_t viewStart = GetStart();
+
+		// Symbols below are deferred, so the set of analysis functions can't change during the walk and
+		// the function or data decision for every export can be answered from one snapshot
+		vector<uint64_t> functionStarts;
+		if (HasFunctions())
+		{
+			for (const auto& func : GetAnalysisFunctionList())
+				functionStarts.push_back(func->GetStart());
+			sort(functionStarts.begin(), functionStarts.end());
+		}
 
-		ReadExportNode(GetStart(), buffer, "", 0, endGuard);
-	}
-	catch (ReadException&)
-	{
-		m_logger->LogError("Error while parsing Export Trie");
-	}
-}
-
-void MachoView::ReadExportNode(uint64_t viewStart, DataBuffer& buffer, const std::string& currentText, size_t cursor, uint32_t endGuard)
-{
-	if (cursor > endGuard)
-		throw ReadException();
-
-	uint64_t terminalSize = readValidULEB128(buffer, cursor);
-	uint64_t childOffset = cursor + terminalSize;
-	if (terminalSize != 0) {
-		uint64_t imageOffset = 0;
-		uint64_t flags = readValidULEB128(buffer, cursor);
-		if (!(flags & EXPORT_SYMBOL_FLAGS_REEXPORT))
+		// Depth first walk in file order with an explicit stack. Every pending node records the length of
+		// its parent's name and where its edge label is, so one name buffer is shared by the whole walk:
+		// everything visited between a node being pushed and popped only touches the name past that length.
+		struct PendingExportNode
+		{
+			size_t offset;
+			size_t prefixLength;
+			size_t labelOffset;
+			size_t labelLength;
+		};
+		vector<PendingExportNode> pending = {{0, 0, 0, 0}};
+		// A valid trie is a tree, visiting a node twice means its child offsets form a cycle
+		vector<bool> visited(end);
+		string name;
+		while (!pending.empty())
 		{
-			imageOffset = readValidULEB128(buffer, cursor);
-			auto symbolType = GetAnalysisFunctionsForAddress(viewStart + imageOffset).size() ? FunctionSymbol : DataSymbol;
-			DefineMachoSymbol(symbolType, currentText, imageOffset + viewStart, GlobalBinding, true);
+			PendingExportNode node = pending.back();
+			pending.pop_back();
+			if ((node.offset >= end) || visited[node.offset])
+				throw ReadException();
+			visited[node.offset] = true;
+			name.resize(node.prefixLength);
+			name.append((const char*)data + node.labelOffset, node.labelLength);
+
+			size_t cursor = node.offset;
+			uint64_t terminalSize = readValidULEB128(buffer, cursor);
+			uint64_t childOffset = cursor + terminalSize;
+			if (terminalSize != 0)
+			{
+				uint64_t flags = readValidULEB128(buffer, cursor);
+				if (!(flags & EXPORT_SYMBOL_FLAGS_REEXPORT))
+				{
+					uint64_t imageOffset = readValidULEB128(buffer, cursor);
+					auto symbolType = binary_search(functionStarts.begin(), functionStarts.end(), viewStart + imageOffset)
+						? FunctionSymbol : DataSymbol;
+					DefineMachoSymbol(symbolType, name, imageOffset + viewStart, GlobalBinding, true);
+				}
+			}
+			if (childOffset >= end)
+				throw ReadException();
+			cursor = childOffset;
+			uint8_t childCount = data[cursor++];
+
+			size_t firstChild = pending.size();
+			for (uint8_t i = 0; i < childCount; ++i)
+			{
+				const uint8_t* terminator = (cursor < end) ? (const uint8_t*)memchr(data + cursor, 0, end - cursor) : nullptr;
+				if (!terminator)
+					throw ReadException();
+				size_t labelOffset = cursor;
+				size_t labelLength = terminator - (data + cursor);
+				cursor += labelLength + 1;
+				auto next = readValidULEB128(buffer, cursor);
+				if (next == 0)
+					throw ReadException();
+				pending.push_back({(size_t)next, name.size(), labelOffset, labelLength});
+			}
+			// Pop children in the order they are listed
+			reverse(pending.begin() + firstChild, pending.end());
 		}
 	}
-	cursor = childOffset;
-	uint8_t childCount = buffer[cursor];
-	cursor++;
-	if (cursor > endGuard)
-		throw ReadException();
-	for (uint8_t i = 0; i < childCount; ++i)
+	catch (ReadException&)
 	{
-		std::string childText;
-		while (buffer[cursor] != 0 & cursor <= endGuard)
-			childText.push_back(buffer[cursor++]);
-		cursor++;
-		if (cursor > endGuard)
-			throw ReadException();
-		auto next = readValidULEB128(buffer, cursor);
-		if (next == 0)
-			throw ReadException();
-		ReadExportNode(viewStart, buffer, currentText + childText, next, endGuard);
+		m_logger->LogError("Error while parsing Export Trie");
 	}
 }
 
@@ -3048,7 +3082,6 @@ void MachoView::ParseChainedFixups(MachOHeader& header, linkedit_data_command ch
 	bool processBinds = true;
 
 	BinaryReader parentReader(GetParentView());
-	BinaryReader mappedReader(this);
 
 	try {
 		dyld_chained_fixups_header fixupsHeader {};
@@ -3239,187 +3272,206 @@ void MachoView::ParseChainedFixups(MachOHeader& header, linkedit_data_command ch
 				}
 			}
 
-			int i = -1;
-			for (auto pageStarts : pageStartOffsets)
-			{
-				i++;
-				uint64_t pageAddress = m_universalImageOffset + starts.segment_offset + (i * starts.page_size);
-				for (uint16_t start : pageStarts)
-				{
-					if (start == DYLD_CHAINED_PTR_START_NONE)
-						continue;
-
-					uint64_t chainEntryAddress = pageAddress + start;
+			// Chains never leave their page, so every page is walked independently out of one read of the
+			// whole segment. Entries are collected per page and defined afterwards in page order.
+			uint64_t segmentAddress = GetStart() + starts.segment_offset;
+			DataBuffer segmentData = ReadBuffer(segmentAddress, (uint64_t)pageStartOffsets.size() * starts.page_size);
+			const uint8_t* segmentBytes = (const uint8_t*)segmentData.GetData();
+			size_t pointerSize = (format == Generic32FixupFormat || format == Firmware32FixupFormat) ? 4 : 8;
+			vector<vector<ChainedFixupEntry>> pageFixups(pageStartOffsets.size());
 
-					bool fixupsDone = false;
-
-					while (!fixupsDone)
+			ParallelForRanges(pageStartOffsets.size(), 16, [&](size_t firstPage, size_t endPage) {
+				for (size_t i = firstPage; i < endPage; i++)
+				{
+					uint64_t pageOffset = i * starts.page_size;
+					for (uint16_t start : pageStartOffsets[i])
 					{
-						ChainedFixupPointer pointer;
-						parentReader.Seek(chainEntryAddress);
-						mappedReader.Seek(chainEntryAddress - m_universalImageOffset + GetStart());
-						if (format == Generic32FixupFormat || format == Firmware32FixupFormat)
-							pointer.raw32 = (uint32_t)(uintptr_t)mappedReader.Read32();
-						else
-							pointer.raw64 = (uintptr_t)mappedReader.Read64();
+						if (start == DYLD_CHAINED_PTR_START_NONE)
+							continue;
+
+						uint64_t chainEntryOffset = pageOffset + start;
 
-						bool bind = false;
-						uint64_t nextEntryStrideCount;
+						bool fixupsDone = false;
 
-						switch (format)
+						while (!fixupsDone)
 						{
-						case Generic32FixupFormat:
-							bind = pointer.generic32.bind.bind;
-							nextEntryStrideCount = pointer.generic32.rebase.next;
-							break;
-						case Generic64FixupFormat:
-							bind = pointer.generic64.bind.bind;
-							nextEntryStrideCount = pointer.generic64.rebase.next;
-							break;
-						case GenericArm64eFixupFormat:
-							bind = pointer.arm64e.bind.bind;
-							nextEntryStrideCount = pointer.arm64e.rebase.next;
-							break;
-						case Firmware32FixupFormat:
-							nextEntryStrideCount = pointer.firmware32.next;
-							bind = false;
-							break;
-						}
+							uint64_t chainEntryAddress = segmentAddress + chainEntryOffset;
+							if (chainEntryOffset + pointerSize > segmentData.GetLength())
+							{
+								m_logger->LogError("Chained Fixups: Pointer at %llx is outside of the segment", chainEntryAddress);
+								break;
+							}
 
-						m_logger->LogTrace("Chained Fixups: @ 0x%llx ( 0x%llx ) - %d 0x%llx", chainEntryAddress,
-							GetStart() + (chainEntryAddress - m_universalImageOffset),
-							bind, nextEntryStrideCount);
+							ChainedFixupPointer pointer;
+							if (pointerSize == 4)
+								memcpy(&pointer.raw32, segmentBytes + chainEntryOffset, sizeof(pointer.raw32));
+							else
+								memcpy(&pointer.raw64, segmentBytes + chainEntryOffset, sizeof(pointer.raw64));
 
-						if (bind && processBinds)
-						{
-							uint64_t ordinal;
+							bool bind = false;
+							uint64_t nextEntryStrideCount;
 
-							switch (starts.pointer_format)
+							switch (format)
 							{
-							case DYLD_CHAINED_PTR_64:
-							case DYLD_CHAINED_PTR_64_OFFSET:
-								ordinal = pointer.generic64.bind.ordinal;
+							case Generic32FixupFormat:
+								bind = pointer.generic32.bind.bind;
+								nextEntryStrideCount = pointer.generic32.rebase.next;
 								break;
-							// case DYLD_CHAINED_PTR_ARM64E_OFFSET: ; old _KERNEL name.
-							case DYLD_CHAINED_PTR_ARM64E:
-							case DYLD_CHAINED_PTR_ARM64E_USERLAND24:
-							case DYLD_CHAINED_PTR_ARM64E_KERNEL:
-								if (pointer.arm64e.bind.auth)
-									ordinal = starts.pointer_format == DYLD_CHAINED_PTR_ARM64E_USERLAND24
-										? pointer.arm64e.authBind24.ordinal : pointer.arm64e.authBind.ordinal;
-								else
-									ordinal = starts.pointer_format == DYLD_CHAINED_PTR_ARM64E_USERLAND24
-										? pointer.arm64e.bind24.ordinal : pointer.arm64e.bind.ordinal;
+							case Generic64FixupFormat:
+								bind = pointer.generic64.bind.bind;
+								nextEntryStrideCount = pointer.generic64.rebase.next;
 								break;
-							case DYLD_CHAINED_PTR_32:
-								ordinal = pointer.generic32.bind.ordinal;
+							case GenericArm64eFixupFormat:
+								bind = pointer.arm64e.bind.bind;
+								nextEntryStrideCount = pointer.arm64e.rebase.next;
 								break;
-							default:
-								m_logger->LogWarn("Chained Fixups: Unknown Bind Pointer Format at %llx",
-									GetStart() + (chainEntryAddress - m_universalImageOffset));
+							case Firmware32FixupFormat:
+								nextEntryStrideCount = pointer.firmware32.next;
+								bind = false;
+								break;
+							}
+
+							m_logger->LogTrace("Chained Fixups: @ 0x%llx ( 0x%llx ) - %d 0x%llx",
+								m_universalImageOffset + starts.segment_offset + chainEntryOffset, chainEntryAddress,
+								bind, nextEntryStrideCount);
 
-								chainEntryAddress += (nextEntryStrideCount * strideSize);
-								if (chainEntryAddress > pageAddress + starts.page_size)
+							if (bind && processBinds)
+							{
+								uint64_t ordinal = 0;
+								bool knownFormat = true;
+
+								switch (starts.pointer_format)
 								{
-									m_logger->LogDebug("Chained Fixups: Pointer at %llx left page",
-										GetStart() + ((chainEntryAddress - (nextEntryStrideCount * strideSize))) - m_universalImageOffset);
-									fixupsDone = true;
+								case DYLD_CHAINED_PTR_64:
+								case DYLD_CHAINED_PTR_64_OFFSET:
+									ordinal = pointer.generic64.bind.ordinal;
+									break;
+								// case DYLD_CHAINED_PTR_ARM64E_OFFSET: ; old _KERNEL name.
+								case DYLD_CHAINED_PTR_ARM64E:
+								case DYLD_CHAINED_PTR_ARM64E_USERLAND24:
+								case DYLD_CHAINED_PTR_ARM64E_KERNEL:
+									if (pointer.arm64e.bind.auth)
+										ordinal = starts.pointer_format == DYLD_CHAINED_PTR_ARM64E_USERLAND24
+											? pointer.arm64e.authBind24.ordinal : pointer.arm64e.authBind.ordinal;
+									else
+										ordinal = starts.pointer_format == DYLD_CHAINED_PTR_ARM64E_USERLAND24
+											? pointer.arm64e.bind24.ordinal : pointer.arm64e.bind.ordinal;
+									break;
+								case DYLD_CHAINED_PTR_32:
+									ordinal = pointer.generic32.bind.ordinal;
+									break;
+								default:
+									m_logger->LogWarn("Chained Fixups: Unknown Bind Pointer Format at %llx", chainEntryAddress);
+									knownFormat = false;
+									break;
 								}
-								if (nextEntryStrideCount == 0)
-									fixupsDone = true;
 
-								continue;
+								if (knownFormat)
+									pageFixups[i].push_back({chainEntryAddress, ordinal, true});
 							}
-
-							if (ordinal < importTable.size())
+							else if (!bind)
 							{
-								import_entry entry = importTable.at(ordinal);
-								uint64_t targetAddress = GetStart() + (chainEntryAddress - m_universalImageOffset);
-
-								if (!entry.name.empty())
+								uint64_t entryOffset = 0;
+								switch (starts.pointer_format)
 								{
-									reloc.address = targetAddress;
-									DefineMachoSymbol(ImportAddressSymbol, entry.name,
-										targetAddress,
-										entry.weak ? WeakBinding : GlobalBinding, true);
-
-									BNRelocationInfo externReloc;
-									memset(&externReloc, 0, sizeof(externReloc));
-									externReloc.nativeType = BINARYNINJA_MANUAL_RELOCATION;
-									externReloc.address = targetAddress;
-									externReloc.size = m_addressSize;
-									externReloc.pcRelative = false;
-									externReloc.external = true;
-									header.externalRelocations.emplace_back(externReloc, entry.name);
-								}
-								else
+								case DYLD_CHAINED_PTR_ARM64E:
+								case DYLD_CHAINED_PTR_ARM64E_KERNEL:
+								case DYLD_CHAINED_PTR_ARM64E_USERLAND:
+								case DYLD_CHAINED_PTR_ARM64E_USERLAND24:
 								{
-									m_logger->LogWarn("Chained Fixups: Import Table entry %llx has no symbol; "
-										"Unable to bind item at %llx", ordinal, targetAddress);
+									if (pointer.arm64e.bind.auth)
+										entryOffset = pointer.arm64e.authRebase.target;
+									else
+										entryOffset = pointer.arm64e.rebase.target;
+
+									if ( starts.pointer_format != DYLD_CHAINED_PTR_ARM64E || pointer.arm64e.bind.auth)
+										entryOffset += GetStart();
+
+									break;
 								}
+								case DYLD_CHAINED_PTR_64:
+									entryOffset = pointer.generic64.rebase.target;
+									break;
+								case DYLD_CHAINED_PTR_64_OFFSET:
+									entryOffset = pointer.generic64.rebase.target + GetStart();
+									break;
+								case DYLD_CHAINED_PTR_64_KERNEL_CACHE:
+								case DYLD_CHAINED_PTR_X86_64_KERNEL_CACHE:
+									entryOffset = pointer.kernel64.target;
+									break;
+								case DYLD_CHAINED_PTR_32:
+								case DYLD_CHAINED_PTR_32_CACHE:
+									entryOffset = pointer.generic32.rebase.target;
+									break;
+								case DYLD_CHAINED_PTR_32_FIRMWARE:
+									entryOffset = pointer.firmware32.target;
+									break;
+								}
+
+								pageFixups[i].push_back({chainEntryAddress, entryOffset, false});
 							}
-						}
-						else if (!bind)
-						{
-							uint64_t entryOffset;
-							switch (starts.pointer_format)
-							{
-							case DYLD_CHAINED_PTR_ARM64E:
-							case DYLD_CHAINED_PTR_ARM64E_KERNEL:
-							case DYLD_CHAINED_PTR_ARM64E_USERLAND:
-							case DYLD_CHAINED_PTR_ARM64E_USERLAND24:
-							{
-								if (pointer.arm64e.bind.auth)
-									entryOffset = pointer.arm64e.authRebase.target;
-								else
-									entryOffset = pointer.arm64e.rebase.target;
 
-								if ( starts.pointer_format != DYLD_CHAINED_PTR_ARM64E || pointer.arm64e.bind.auth)
-									entryOffset += GetStart();
+							chainEntryOffset += (nextEntryStrideCount * strideSize);
 
-								break;
-							}
-							case DYLD_CHAINED_PTR_64:
-								entryOffset = pointer.generic64.rebase.target;
-								break;
-							case DYLD_CHAINED_PTR_64_OFFSET:
-								entryOffset = pointer.generic64.rebase.target + GetStart();
-								break;
-							case DYLD_CHAINED_PTR_64_KERNEL_CACHE:
-							case DYLD_CHAINED_PTR_X86_64_KERNEL_CACHE:
-								entryOffset = pointer.kernel64.target;
-								break;
-							case DYLD_CHAINED_PTR_32:
-							case DYLD_CHAINED_PTR_32_CACHE:
-								entryOffset = pointer.generic32.rebase.target;
-								break;
-							case DYLD_CHAINED_PTR_32_FIRMWARE:
-								entryOffset = pointer.firmware32.target;
-								break;
+							if (chainEntryOffset > pageOffset + starts.page_size)
+							{
+								// Something is seriously wrong here. likely malformed binary, or our parsing failed elsewhere.
+								// This will log the pointer in mapped memory.
+								m_logger->LogError("Chained Fixups: Pointer at %llx left page", chainEntryAddress);
+								fixupsDone = true;
 							}
 
-							reloc.address = GetStart() + (chainEntryAddress - m_universalImageOffset);
-							DefineRelocation(m_arch, reloc, entryOffset, reloc.address);
+							if (nextEntryStrideCount == 0)
+								fixupsDone = true;
+						}
+					}
+				}
+			});
 
-							if (m_objcProcessor)
+			for (const auto& fixups : pageFixups)
+			{
+				for (const ChainedFixupEntry& fixup : fixups)
+				{
+					if (fixup.bind)
+					{
+						uint64_t ordinal = fixup.target;
+						if (ordinal < importTable.size())
+						{
+							const import_entry& entry = importTable[ordinal];
+							uint64_t targetAddress = fixup.address;
+
+							if (!entry.name.empty())
+							{
+								reloc.address = targetAddress;
+								DefineMachoSymbol(ImportAddressSymbol, entry.name,
+									targetAddress,
+									entry.weak ? WeakBinding : GlobalBinding, true);
+
+								BNRelocationInfo externReloc;
+								memset(&externReloc, 0, sizeof(externReloc));
+								externReloc.nativeType = BINARYNINJA_MANUAL_RELOCATION;
+								externReloc.address = targetAddress;
+								externReloc.size = m_addressSize;
+								externReloc.pcRelative = false;
+								externReloc.external = true;
+								header.externalRelocations.emplace_back(externReloc, entry.name);
+							}
+							else
 							{
-								m_objcProcessor->AddRelocatedPointer(reloc.address, entryOffset);
+								m_logger->LogWarn("Chained Fixups: Import Table entry %llx has no symbol; "
+									"Unable to bind item at %llx", ordinal, targetAddress);
 							}
 						}
+					}
+					else
+					{
+						reloc.address = fixup.address;
+						DefineRelocation(m_arch, reloc, fixup.target, reloc.address);
 
-						chainEntryAddress += (nextEntryStrideCount * strideSize);
-
-						if (chainEntryAddress > pageAddress + starts.page_size)
+						if (m_objcProcessor)
 						{
-							// Something is seriously wrong here. likely malformed binary, or our parsing failed elsewhere.
-							// This will log the pointer in mapped memory.
-							m_logger->LogError("Chained Fixups: Pointer at %llx left page",
-								GetStart() + ((chainEntryAddress - (nextEntryStrideCount * strideSize))) - m_universalImageOffset);
-							fixupsDone = true;
+							m_objcProcessor->AddRelocatedPointer(reloc.address, fixup.target);
 						}
-
-						if (nextEntryStrideCount == 0)
-							fixupsDone = true;
 					}
 				}
 			}
@@ -1234,6 +1234,14 @@ namespace BinaryNinja
 		std::string name;
 	};
 
+	// A decoded chain entry, collected per page before relocations and symbols are defined
+	struct ChainedFixupEntry
+	{
+		uint64_t address;
+		uint64_t target; // Rebase target, or the import ordinal for binds
+		bool bind;
+	};
+
 #ifndef EXPORT_SYMBOL_FLAGS_KIND_MASK
 	enum EXPORT_SYMBOL_FLAGS {
 		EXPORT_SYMBOL_FLAGS_KIND_MASK           = 0x03u, ///< Mask to access to EXPORT_SYMBOL_KINDS
@@ -1365,8 +1373,6 @@ namespace BinaryNinja
 		bool ParseRelocationEntry(const relocation_info& info, uint64_t start, BNRelocationInfo& result);
 
 		void ParseExportTrie(BinaryReader& reader, linkedit_data_command exportTrie);
-		void ReadExportNode(uint64_t viewStart, DataBuffer& buffer, const std::string& currentText,
-			size_t cursor, uint32_t endGuard);
 
 		void ParseRebaseTable(BinaryReader& reader, MachOHeader& header, uint32_t tableOffset, uint32_t tableSize);
 		void ParseDynamicTable(BinaryReader& reader, MachOHeader& header, BNSymbolType type, uint32_t tableOffset, uint32_t tableSize,
@@ -1,4 +1,5 @@
 #include "objc.h"
+#include "objcmetadata.h"
 #include "machoview.h"
 #include "inttypes.h"
 #include "rapidjson/rapidjson.h"
@@ -8,97 +9,36 @@
 
 using namespace BinaryNinja;
 
-Ref<Metadata> ObjCProcessor::SerializeMethod(uint64_t loc, const Method& method)
-{
-	std::map<std::string, Ref<Metadata>> methodMeta;
-
-	methodMeta["loc"] = new Metadata(loc);
-	methodMeta["name"] = new Metadata(method.name);
-	methodMeta["types"] = new Metadata(method.types);
-	methodMeta["imp"] = new Metadata(method.imp);
-
-	return new Metadata(methodMeta);
-}
-
-
-Ref<Metadata> ObjCProcessor::SerializeClass(uint64_t loc, const Class& cls)
-{
-	std::map<std::string, Ref<Metadata>> clsMeta;
-
-	clsMeta["loc"] = new Metadata(loc);
-	clsMeta["name"] = new Metadata(cls.name);
-	clsMeta["typeName"] = new Metadata(cls.associatedName.GetString());
-
-	std::vector<uint64_t> instanceMethods;
-	std::vector<uint64_t> classMethods;
-	instanceMethods.reserve(cls.instanceClass.methodList.size());
-	classMethods.reserve(cls.metaClass.methodList.size());
-	for (const auto& [location, _] : cls.instanceClass.methodList)
-		instanceMethods.push_back(location);
-
-	clsMeta["instanceMethods"] = new Metadata(instanceMethods);
-	clsMeta["classMethods"] = new Metadata(classMethods);
-
-	return new Metadata(clsMeta);
-}
-
 Ref<Metadata> ObjCProcessor::SerializeMetadata()
 {
-	std::map<std::string, Ref<Metadata>> viewMeta;
-	viewMeta["version"] = new Metadata((uint64_t)1);
-
-	std::vector<Ref<Metadata>> classes;
-	classes.reserve(m_classes.size());
-	std::vector<Ref<Metadata>> categories;
-	categories.reserve(m_categories.size());
-	std::vector<Ref<Metadata>> methods;
-	methods.reserve(m_localMethods.size());
-
+	ObjCMetadataWriter writer;
+
+	auto methodLocations = [](const ClassBase& cls) {
+		std::vector<uint64_t> locations;
+		locations.reserve(cls.methodList.size());
+		for (const auto& [location, _] : cls.methodList)
+			locations.push_back(location);
+		return locations;
+	};
 	for (const auto& [clsLoc, cls] : m_classes)
-		classes.push_back(SerializeClass(clsLoc, cls));
-	viewMeta["classes"] = new Metadata(classes);
+		writer.AddClass(clsLoc, cls.name, cls.associatedName.GetString(), methodLocations(cls.instanceClass),
+			methodLocations(cls.metaClass));
 	for (const auto& [catLoc, cat] : m_categories)
-		categories.push_back(SerializeClass(catLoc, cat));
-	viewMeta["categories"] = new Metadata(categories);
+		writer.AddCategory(catLoc, cat.name, cat.associatedName.GetString(), methodLocations(cat.instanceClass),
+			methodLocations(cat.metaClass));
 	for (const auto& [methodLoc, method] : m_localMethods)
-		methods.push_back(SerializeMethod(methodLoc, method));
-	viewMeta["methods"] = new Metadata(methods);
+		writer.AddMethod(methodLoc, method.name, method.types, method.imp);
 
 	// Required for workflow_objc type guessing, should be removed when that is no longer a thing.
-	std::vector<Ref<Metadata>> selRefToImps;
-	selRefToImps.reserve(m_selRefToImplementations.size());
 	for (const auto& [selRef, imps] : m_selRefToImplementations)
-	{
-		std::vector<Ref<Metadata>> mapBase = {new Metadata(selRef), new Metadata(imps)};
-		Ref<Metadata> mapObject = new Metadata(mapBase);
-		selRefToImps.push_back(mapObject);
-	}
-	viewMeta["selRefImplementations"] = new Metadata(selRefToImps);
-
-	std::vector<Ref<Metadata>> selToImps;
-	selToImps.reserve(m_selToImplementations.size());
-	for (const auto& [selRef, imps] : m_selToImplementations)
-	{
-		std::vector<Ref<Metadata>> mapBase = {new Metadata(selRef), new Metadata(imps)};
-		Ref<Metadata> mapObject = new Metadata(mapBase);
-		selToImps.push_back(mapObject);
-	}
-	viewMeta["selImplementations"] = new Metadata(selToImps);
-
-	std::vector<Ref<Metadata>> selRefToName;
-	selRefToName.reserve(m_selRefToName.size());
+		writer.AddSelRefImplementations(selRef, imps);
+	for (const auto& [sel, imps] : m_selToImplementations)
+		writer.AddSelImplementations(sel, imps);
 	for (const auto& [selRef, name] : m_selRefToName)
-	{
-		std::vector<Ref<Metadata>> mapBase = {new Metadata(selRef), new Metadata(name)};
-		Ref<Metadata> mapObject = new Metadata(mapBase);
-		selRefToName.push_back(mapObject);
-	}
-	viewMeta["selRefToName"] = new Metadata(selRefToName);
+		writer.AddSelRefName(selRef, name);
 	// ---
 
-
-
-	return new Metadata(viewMeta);
+	return new Metadata(writer.Finalize());
 }
 
 std::vector<QualifiedNameOrType> ObjCProcessor::ParseEncodedType(const std::string& encodedType)
@@ -333,198 +273,287 @@ void ObjCProcessor::DefineObjCSymbol(
 	}
 }
 
-void ObjCProcessor::LoadClasses(BinaryReader* reader, Ref<Section> classPtrSection)
+ObjCProcessor::ClassRecord ObjCProcessor::ReadClass(BinaryReader* reader, view_ptr_t classPointerLocation)
 {
-	if (!classPtrSection)
-		return;
-	auto size = classPtrSection->GetEnd() - classPtrSection->GetStart();
-	if (size == 0)
-		return;
-	auto ptrCount = size / m_data->GetAddressSize();
+	ClassRecord record;
+	auto addressSize = m_data->GetAddressSize();
+	class_t& clsStruct = record.clsStruct;
+	class_ro_t& classRO = record.classRO;
+	class_t& metaClsStruct = record.metaClsStruct;
+	class_ro_t metaClassRO;
 
-	auto classPtrSectionStart = classPtrSection->GetStart();
-	for (size_t i = 0; i < ptrCount; i++)
-	{
-		Class cls;
+	record.classPointerLocation = classPointerLocation;
+	reader->Seek(classPointerLocation);
 
-		view_ptr_t classPtr;
-		class_t clsStruct;
-		class_ro_t classRO;
+	try
+	{
+		record.classPtr = ReadPointerAccountingForRelocations(reader);
+		reader->Seek(record.classPtr);
+		clsStruct.isa = ReadPointerAccountingForRelocations(reader);
+		clsStruct.super = reader->ReadPointer();
+		clsStruct.cache = reader->ReadPointer();
+		clsStruct.vtable = reader->ReadPointer();
+		clsStruct.data = ReadPointerAccountingForRelocations(reader);
+	}
+	catch (ReadException& ex)
+	{
+		m_logger->LogError("Failed to read class data at 0x%llx pointed to by @ 0x%llx", reader->GetOffset(),
+			classPointerLocation);
+		return record;
+	}
+	if (clsStruct.data & 1)
+	{
+		m_logger->LogInfo("Skipping class at 0x%llx as it contains swift types", record.classPtr);
+		return record;
+	}
+	// unset first two bits
+	record.classROPtr = clsStruct.data & ~3;
+	reader->Seek(record.classROPtr);
+	try
+	{
+		classRO.flags = reader->Read32();
+		classRO.instanceStart = reader->Read32();
+		classRO.instanceSize = reader->Read32();
+		if (addressSize == 8)
+			classRO.reserved = reader->Read32();
+		classRO.ivarLayout = ReadPointerAccountingForRelocations(reader);
+		classRO.name = ReadPointerAccountingForRelocations(reader);
+		classRO.baseMethods = ReadPointerAccountingForRelocations(reader);
+		classRO.baseProtocols = ReadPointerAccountingForRelocations(reader);
+		classRO.ivars = ReadPointerAccountingForRelocations(reader);
+		classRO.weakIvarLayout = ReadPointerAccountingForRelocations(reader);
+		classRO.baseProperties = ReadPointerAccountingForRelocations(reader);
+	}
+	catch (ReadException& ex)
+	{
+		m_logger->LogError("Failed to read class RO data at 0x%llx. 0x%llx, objc_class_t @ 0x%llx",
+			reader->GetOffset(), classPointerLocation, record.classROPtr);
+		return record;
+	}
 
-		bool hasValidMetaClass = false;
-		bool hasValidMetaClassRO = false;
-		class_t metaClsStruct;
-		class_ro_t metaClassRO;
+	auto namePtr = classRO.name;
 
-		view_ptr_t classPointerLocation = classPtrSectionStart + (i * m_data->GetAddressSize());
-		reader->Seek(classPointerLocation);
+	reader->Seek(namePtr);
+	try
+	{
+		record.name = reader->ReadCString(500);
+	}
+	catch (ReadException& ex)
+	{
+		m_logger->LogWarn(
+			"Failed to read class name at 0x%llx. Class has been given the placeholder name \"0x%llx\" ", namePtr,
+			record.classPtr);
+		char hexString[9];
+		hexString[8] = 0;
+		snprintf(hexString, sizeof(hexString), "%llx", record.classPtr);
+		record.name = "0x" + std::string(hexString);
+	}
+	record.valid = true;
 
-		classPtr = ReadPointerAccountingForRelocations(reader);
-		reader->Seek(classPtr);
+	if (clsStruct.isa)
+	{
+		reader->Seek(clsStruct.isa);
 		try
 		{
-			clsStruct.isa = ReadPointerAccountingForRelocations(reader);
-			clsStruct.super = reader->ReadPointer();
-			clsStruct.cache = reader->ReadPointer();
-			clsStruct.vtable = reader->ReadPointer();
-			clsStruct.data = ReadPointerAccountingForRelocations(reader);
+			metaClsStruct.isa = ReadPointerAccountingForRelocations(reader);
+			metaClsStruct.super = reader->ReadPointer();
+			metaClsStruct.cache = reader->ReadPointer();
+			metaClsStruct.vtable = reader->ReadPointer();
+			metaClsStruct.data = ReadPointerAccountingForRelocations(reader) & ~1;
+			record.hasValidMetaClass = true;
 		}
 		catch (ReadException& ex)
 		{
-			m_logger->LogError("Failed to read class data at 0x%llx pointed to by @ 0x%llx", reader->GetOffset(),
-				classPointerLocation);
-			continue;
+			m_logger->LogWarn("Failed to read metaclass data at 0x%llx pointed to by objc_class_t @ 0x%llx",
+				reader->GetOffset(), record.classPtr);
 		}
-		if (clsStruct.data & 1)
+	}
+	bool hasValidMetaClass = record.hasValidMetaClass;
+	if (hasValidMetaClass && (metaClsStruct.data & 1))
+	{
+		m_logger->LogInfo("Skipping metaclass at 0x%llx as it contains swift types", record.classPtr);
+		hasValidMetaClass = false;
+	}
+	if (hasValidMetaClass)
+	{
+		reader->Seek(metaClsStruct.data);
+		try
 		{
-			m_logger->LogInfo("Skipping class at 0x%llx as it contains swift types", classPtr);
-			continue;
+			metaClassRO.flags = reader->Read32();
+			metaClassRO.instanceStart = reader->Read32();
+			metaClassRO.instanceSize = reader->Read32();
+			if (addressSize == 8)
+				metaClassRO.reserved = reader->Read32();
+			metaClassRO.ivarLayout = ReadPointerAccountingForRelocations(reader);
+			metaClassRO.name = ReadPointerAccountingForRelocations(reader);
+			metaClassRO.baseMethods = ReadPointerAccountingForRelocations(reader);
+			metaClassRO.baseProtocols = ReadPointerAccountingForRelocations(reader);
+			metaClassRO.ivars = ReadPointerAccountingForRelocations(reader);
+			metaClassRO.weakIvarLayout = ReadPointerAccountingForRelocations(reader);
+			metaClassRO.baseProperties = ReadPointerAccountingForRelocations(reader);
+			record.hasValidMetaClassRO = true;
+		}
+		catch (ReadException& ex)
+		{
+			m_logger->LogWarn("Failed to read metaclass RO data at 0x%llx pointed to by meta objc_class_t @ 0x%llx",
+				reader->GetOffset(), clsStruct.isa);
 		}
-		// unset first two bits
-		view_ptr_t classROPtr = clsStruct.data & ~3;
-		reader->Seek(classROPtr);
+	}
+
+	if (classRO.baseMethods)
+	{
 		try
 		{
-			classRO.flags = reader->Read32();
-			classRO.instanceStart = reader->Read32();
-			classRO.instanceSize = reader->Read32();
-			if (m_data->GetAddressSize() == 8)
-				classRO.reserved = reader->Read32();
-			classRO.ivarLayout = ReadPointerAccountingForRelocations(reader);
-			classRO.name = ReadPointerAccountingForRelocations(reader);
-			classRO.baseMethods = ReadPointerAccountingForRelocations(reader);
-			classRO.baseProtocols = ReadPointerAccountingForRelocations(reader);
-			classRO.ivars = ReadPointerAccountingForRelocations(reader);
-			classRO.weakIvarLayout = ReadPointerAccountingForRelocations(reader);
-			classRO.baseProperties = ReadPointerAccountingForRelocations(reader);
+			record.methods = ReadMethodList(reader, classRO.baseMethods);
 		}
 		catch (ReadException& ex)
 		{
-			m_logger->LogError("Failed to read class RO data at 0x%llx. 0x%llx, objc_class_t @ 0x%llx",
-				reader->GetOffset(), classPointerLocation, classROPtr);
-			continue;
+			m_logger->LogError("Failed to read the method list for class pointed to by 0x%llx", clsStruct.data);
 		}
+	}
+	if (record.hasValidMetaClassRO && metaClassRO.baseMethods)
+	{
+		try
+		{
+			record.metaMethods = ReadMethodList(reader, metaClassRO.baseMethods);
+		}
+		catch (ReadException& ex)
+		{
+			m_logger->LogError("Failed to read the method list for metaclass pointed to by 0x%llx", clsStruct.data);
+		}
+	}
 
-		auto namePtr = classRO.name;
-
-		std::string name;
-
-		reader->Seek(namePtr);
+	if (classRO.ivars)
+	{
 		try
 		{
-			name = reader->ReadCString(500);
+			record.ivars = ReadIvarList(reader, classRO.ivars);
 		}
 		catch (ReadException& ex)
 		{
-			m_logger->LogWarn(
-				"Failed to read class name at 0x%llx. Class has been given the placeholder name \"0x%llx\" ", namePtr,
-				classPtr);
-			char hexString[9];
-			hexString[8] = 0;
-			snprintf(hexString, sizeof(hexString), "%llx", classPtr);
-			name = "0x" + std::string(hexString);
+			m_logger->LogError("Failed to process ivars for class at 0x%llx", clsStruct.data);
 		}
+	}
+	return record;
+}
 
+void ObjCProcessor::LoadClasses(Ref<Section> classPtrSection)
+{
+	if (!classPtrSection)
+		return;
+	auto size = classPtrSection->GetEnd() - classPtrSection->GetStart();
+	if (size == 0)
+		return;
+	auto addressSize = m_data->GetAddressSize();
+	auto ptrCount = size / addressSize;
+
+	// Classes are independent of each other, so they are read on worker threads with a reader each
+	auto classPtrSectionStart = classPtrSection->GetStart();
+	std::vector<ClassRecord> records(ptrCount);
+	ParallelForRanges(ptrCount, 256, [&](size_t begin, size_t end) {
+		BinaryReader reader(m_data);
+		reader.SetBufferSize();
+		for (size_t i = begin; i < end; i++)
+			records[i] = ReadClass(&reader, classPtrSectionStart + (i * addressSize));
+	});
+
+	for (const auto& record : records)
+	{
+		if (!record.valid)
+			continue;
+
+		Class cls;
+		const std::string& name = record.name;
 		cls.name = name;
 
 		DefineObjCSymbol(BNSymbolType::DataSymbol,
-			Type::PointerType(m_data->GetAddressSize(), m_data->GetTypeByName(m_typeNames.cls)), "clsPtr_" + name,
-			classPointerLocation, true);
-		DefineObjCSymbol(BNSymbolType::DataSymbol, m_typeNames.cls, "cls_" + name, classPtr, true);
-		DefineObjCSymbol(BNSymbolType::DataSymbol, m_typeNames.classRO, "cls_ro_" + name, classROPtr, true);
-		DefineObjCSymbol(BNSymbolType::DataSymbol, Type::ArrayType(Type::IntegerType(1, true), name.size()+1), "clsName_" + name, classRO.name, true);
+			Type::PointerType(addressSize, m_data->GetTypeByName(m_typeNames.cls)), "clsPtr_" + name,
+			record.classPointerLocation, true);
+		DefineObjCSymbol(BNSymbolType::DataSymbol, m_typeNames.cls, "cls_" + name, record.classPtr, true);
+		DefineObjCSymbol(BNSymbolType::DataSymbol, m_typeNames.classRO, "cls_ro_" + name, record.classROPtr, true);
+		DefineObjCSymbol(BNSymbolType::DataSymbol, Type::ArrayType(Type::IntegerType(1, true), name.size()+1), "clsName_" + name, record.classRO.name, true);
+
+		if (record.hasValidMetaClass)
+			DefineObjCSymbol(BNSymbolType::DataSymbol, m_typeNames.cls, "metacls_" + name, record.clsStruct.isa, true);
+		if (record.hasValidMetaClassRO)
+			DefineObjCSymbol(
+				BNSymbolType::DataSymbol, m_typeNames.classRO, "metacls_ro_" + name, record.metaClsStruct.data, true);
+
+		if (record.methods)
+			DefineMethodList(*record.methods, cls.instanceClass, name);
+		if (record.metaMethods)
+			DefineMethodList(*record.metaMethods, cls.metaClass, name);
+		if (record.ivars)
+			DefineIvarList(*record.ivars, cls.instanceClass, name);
+		m_classes[record.classPtr] = cls;
+	}
+}
 
-		if (clsStruct.isa)
-		{
-			reader->Seek(clsStruct.isa);
-			try
-			{
-				metaClsStruct.isa = ReadPointerAccountingForRelocations(reader);
-				metaClsStruct.super = reader->ReadPointer();
-				metaClsStruct.cache = reader->ReadPointer();
-				metaClsStruct.vtable = reader->ReadPointer();
-				metaClsStruct.data = ReadPointerAccountingForRelocations(reader) & ~1;
-				DefineObjCSymbol(BNSymbolType::DataSymbol, m_typeNames.cls, "metacls_" + name, clsStruct.isa, true);
-				hasValidMetaClass = true;
-			}
-			catch (ReadException& ex)
-			{
-				m_logger->LogWarn("Failed to read metaclass data at 0x%llx pointed to by objc_class_t @ 0x%llx",
-					reader->GetOffset(), classPtr);
-			}
-		}
-		if (hasValidMetaClass && (metaClsStruct.data & 1))
-		{
-			m_logger->LogInfo("Skipping metaclass at 0x%llx as it contains swift types", classPtr);
-			hasValidMetaClass = false;
-		}
-		if (hasValidMetaClass)
+ObjCProcessor::CategoryRecord ObjCProcessor::ReadCategory(BinaryReader* reader, view_ptr_t location)
+{
+	CategoryRecord record;
+	category_t& cat = record.cat;
+
+	reader->Seek(location);
+	try
+	{
+		record.catLocation = ReadPointerAccountingForRelocations(reader);
+		reader->Seek(record.catLocation);
+		cat.name = ReadPointerAccountingForRelocations(reader);
+		cat.cls = ReadPointerAccountingForRelocations(reader);
+		cat.instanceMethods = ReadPointerAccountingForRelocations(reader);
+		cat.classMethods = ReadPointerAccountingForRelocations(reader);
+		cat.protocols = ReadPointerAccountingForRelocations(reader);
+		cat.instanceProperties = ReadPointerAccountingForRelocations(reader);
+	}
+	catch (ReadException& ex)
+	{
+		m_logger->LogError("Failed to read category pointed to by 0x%llx", location);
+		return record;
+	}
+	record.valid = true;
+
+	try
+	{
+		reader->Seek(cat.name);
+		record.additionsName = reader->ReadCString();
+	}
+	catch (ReadException& ex)
+	{
+		m_logger->LogError(
+			"Failed to read category name for category at 0x%llx. Using base address as stand-in category name",
+			record.catLocation);
+		record.additionsName = std::to_string(record.catLocation);
+	}
+
+	if (cat.instanceMethods)
+	{
+		try
 		{
-			reader->Seek(metaClsStruct.data);
-			try
-			{
-				metaClassRO.flags = reader->Read32();
-				metaClassRO.instanceStart = reader->Read32();
-				metaClassRO.instanceSize = reader->Read32();
-				if (m_data->GetAddressSize() == 8)
-					metaClassRO.reserved = reader->Read32();
-				metaClassRO.ivarLayout = ReadPointerAccountingForRelocations(reader);
-				metaClassRO.name = ReadPointerAccountingForRelocations(reader);
-				metaClassRO.baseMethods = ReadPointerAccountingForRelocations(reader);
-				metaClassRO.baseProtocols = ReadPointerAccountingForRelocations(reader);
-				metaClassRO.ivars = ReadPointerAccountingForRelocations(reader);
-				metaClassRO.weakIvarLayout = ReadPointerAccountingForRelocations(reader);
-				metaClassRO.baseProperties = ReadPointerAccountingForRelocations(reader);
-				DefineObjCSymbol(
-					BNSymbolType::DataSymbol, m_typeNames.classRO, "metacls_ro_" + name, metaClsStruct.data, true);
-				hasValidMetaClassRO = true;
-			}
-			catch (ReadException& ex)
-			{
-				m_logger->LogWarn("Failed to read metaclass RO data at 0x%llx pointed to by meta objc_class_t @ 0x%llx",
-					reader->GetOffset(), clsStruct.isa);
-			}
+			record.instanceMethods = ReadMethodList(reader, cat.instanceMethods);
 		}
-
-		if (classRO.baseMethods)
+		catch (ReadException& ex)
 		{
-			try
-			{
-				ReadMethodList(reader, cls.instanceClass, name, classRO.baseMethods);
-			}
-			catch (ReadException& ex)
-			{
-				m_logger->LogError("Failed to read the method list for class pointed to by 0x%llx", clsStruct.data);
-			}
+			m_logger->LogError(
+				"Failed to read the instance method list for category pointed to by 0x%llx", record.catLocation);
 		}
-		if (hasValidMetaClassRO && metaClassRO.baseMethods)
+	}
+	if (cat.classMethods)
+	{
+		try
 		{
-			try
-			{
-				ReadMethodList(reader, cls.metaClass, name, metaClassRO.baseMethods);
-			}
-			catch (ReadException& ex)
-			{
-				m_logger->LogError("Failed to read the method list for metaclass pointed to by 0x%llx", clsStruct.data);
-			}
+			record.classMethods = ReadMethodList(reader, cat.classMethods);
 		}
-
-		if (classRO.ivars)
+		catch (ReadException& ex)
 		{
-			try
-			{
-				ReadIvarList(reader, cls.instanceClass, name, classRO.ivars);
-			}
-			catch (ReadException& ex)
-			{
-				m_logger->LogError("Failed to process ivars for class at 0x%llx", clsStruct.data);
-			}
+			m_logger->LogError(
+				"Failed to read the class method list for category pointed to by 0x%llx", record.catLocation);
 		}
-		m_classes[classPtr] = cls;
 	}
+	return record;
 }
 
-void ObjCProcessor::LoadCategories(BinaryReader* reader, Ref<Section> classPtrSection)
+void ObjCProcessor::LoadCategories(Ref<Section> classPtrSection)
 {
 	if (!classPtrSection)
 		return;
@@ -532,48 +561,39 @@ void ObjCProcessor::LoadCategories(BinaryReader* reader, Ref<Section> classPtrSe
 	if (size == 0)
 		return;
 	auto ptrSize = m_data->GetAddressSize();
-	auto ptrCount = size / m_data->GetAddressSize();
+	auto ptrCount = size / ptrSize;
 
 	auto classPtrSectionStart = classPtrSection->GetStart();
-	auto classPtrSectionEnd = classPtrSection->GetEnd();
+
+	std::vector<CategoryRecord> records(ptrCount);
+	ParallelForRanges(ptrCount, 256, [&](size_t begin, size_t end) {
+		BinaryReader reader(m_data);
+		reader.SetBufferSize();
+		for (size_t i = begin; i < end; i++)
+			records[i] = ReadCategory(&reader, classPtrSectionStart + (i * ptrSize));
+	});
 
 	auto catType = Type::NamedType(m_data, m_typeNames.category);
 	auto ptrType = Type::PointerType(m_data->GetDefaultArchitecture(), catType);
-	for (size_t i = classPtrSectionStart; i < classPtrSectionEnd; i += ptrSize)
+	for (size_t i = 0; i < ptrCount; i++)
 	{
-		Class category;
-		category_t cat;
-
-		reader->Seek(i);
-		m_data->DefineDataVariable(i, ptrType);
-		auto catLocation = ReadPointerAccountingForRelocations(reader);
-		reader->Seek(catLocation);
-
-		try
-		{
-			cat.name = ReadPointerAccountingForRelocations(reader);
-			cat.cls = ReadPointerAccountingForRelocations(reader);
-			cat.instanceMethods = ReadPointerAccountingForRelocations(reader);
-			cat.classMethods = ReadPointerAccountingForRelocations(reader);
-			cat.protocols = ReadPointerAccountingForRelocations(reader);
-			cat.instanceProperties = ReadPointerAccountingForRelocations(reader);
-		}
-		catch (ReadException& ex)
-		{
-			m_logger->LogError("Failed to read category pointed to by 0x%llx", i);
+		const CategoryRecord& record = records[i];
+		m_data->DefineDataVariable(classPtrSectionStart + (i * ptrSize), ptrType);
+		if (!record.valid)
 			continue;
-		}
+
+		Class category;
+		auto catLocation = record.catLocation;
 		m_data->DefineDataVariable(catLocation, catType);
 
-		std::string categoryAdditionsName;
 		std::string categoryBaseClassName;
 
-		if (const auto& it = m_classes.find(cat.cls); it != m_classes.end())
+		if (const auto& it = m_classes.find(record.cat.cls); it != m_classes.end())
 		{
 			categoryBaseClassName = it->second.name;
 			category.associatedName = it->second.associatedName;
 		}
-		else if (auto symbol = m_data->GetSymbolByAddress(catLocation + m_data->GetAddressSize()))
+		else if (auto symbol = m_data->GetSymbolByAddress(catLocation + ptrSize))
 		{
 			if (symbol->GetType() == ImportedDataSymbol || symbol->GetType() == ImportAddressSymbol)
 			{
@@ -589,73 +609,55 @@ void ObjCProcessor::LoadCategories(BinaryReader* reader, Ref<Section> classPtrSe
 				catLocation);
 			categoryBaseClassName = std::to_string(catLocation);
 		}
-		try
-		{
-			reader->Seek(cat.name);
-			categoryAdditionsName = reader->ReadCString();
-		}
-		catch (ReadException& ex)
-		{
-			m_logger->LogError(
-				"Failed to read category name for category at 0x%llx. Using base address as stand-in category name",
-				catLocation);
-			categoryAdditionsName = std::to_string(catLocation);
-		}
-		category.name = categoryBaseClassName + " (" + categoryAdditionsName + ")";
+		category.name = categoryBaseClassName + " (" + record.additionsName + ")";
 
-		if (cat.instanceMethods)
-		{
-			try
-			{
-				ReadMethodList(reader, category.instanceClass, category.name, cat.instanceMethods);
-			}
-			catch (ReadException& ex)
-			{
-				m_logger->LogError(
-					"Failed to read the instance method list for category pointed to by 0x%llx", catLocation);
-			}
-		}
-		if (cat.classMethods)
-		{
-			try
-			{
-				ReadMethodList(reader, category.metaClass, category.name, cat.classMethods);
-			}
-			catch (ReadException& ex)
-			{
-				m_logger->LogError(
-					"Failed to read the class method list for category pointed to by 0x%llx", catLocation);
-			}
-		}
+		if (record.instanceMethods)
+			DefineMethodList(*record.instanceMethods, category.instanceClass, category.name);
+		if (record.classMethods)
+			DefineMethodList(*record.classMethods, category.metaClass, category.name);
 		m_categories[catLocation] = category;
 	}
 }
 
-void ObjCProcessor::ReadMethodList(BinaryReader* reader, ClassBase& cls, std::string name, view_ptr_t start)
+std::string ObjCProcessor::ReadSelectorName(BinaryReader* reader, view_ptr_t selRef)
 {
+	{
+		std::shared_lock<std::shared_mutex> lock(m_selectorCacheMutex);
+		if (const auto& it = m_selectorCache.find(selRef); it != m_selectorCache.end())
+			return it->second;
+	}
+
+	// Another thread may have read the same selector in the meantime, in which case its copy is kept
+	reader->Seek(selRef);
+	std::string name = reader->ReadCString(selRef);
+	std::unique_lock<std::shared_mutex> lock(m_selectorCacheMutex);
+	return m_selectorCache.emplace(selRef, std::move(name)).first->second;
+}
+
+ObjCProcessor::MethodListRecord ObjCProcessor::ReadMethodList(BinaryReader* reader, view_ptr_t start)
+{
+	MethodListRecord list;
+	list.start = start;
 	reader->Seek(start);
 	method_list_t head;
 	head.entsizeAndFlags = reader->Read32();
 	head.count = reader->Read32();
 	uint64_t pointerSize = m_data->GetAddressSize();
-	bool relativeOffsets = (head.entsizeAndFlags & 0xFFFF0000) & 0x80000000;
+	list.relativeOffsets = (head.entsizeAndFlags & 0xFFFF0000) & 0x80000000;
 	bool directSelectors = (head.entsizeAndFlags & 0xFFFF0000) & 0x40000000;
-	auto methodSize = relativeOffsets ? 12 : pointerSize * 3;
-	DefineObjCSymbol(DataSymbol, m_typeNames.methodList, "method_list_" + name, start, true);
+	auto methodSize = list.relativeOffsets ? 12 : pointerSize * 3;
 
 	for (unsigned i = 0; i < head.count; i++)
 	{
 		try
 		{
-			Method method;
+			MethodRecord record {};
+			Method& method = record.method;
+			method_t& meth = record.meth;
 			auto cursor = start + sizeof(method_list_t) + (i * methodSize);
+			record.cursor = cursor;
 			reader->Seek(cursor);
-			method_t meth;
-			// workflow_objc support
-			uint64_t selRefAddr = 0;
-			uint64_t selAddr = 0;
-			// --
-			if (relativeOffsets)
+			if (list.relativeOffsets)
 			{
 				meth.name = cursor + static_cast<int32_t>(reader->Read32());
 				meth.types = cursor + 4 + static_cast<int32_t>(reader->Read32());
@@ -667,55 +669,28 @@ void ObjCProcessor::ReadMethodList(BinaryReader* reader, ClassBase& cls, std::st
 				meth.types = ReadPointerAccountingForRelocations(reader);
 				meth.imp = ReadPointerAccountingForRelocations(reader);
 			}
-			if (!relativeOffsets || directSelectors)
+			record.directSelector = !list.relativeOffsets || directSelectors;
+			if (record.directSelector)
 			{
 				reader->Seek(meth.name);
-				selAddr = meth.name;
+				record.selAddr = meth.name;
 				method.name = reader->ReadCString();
 				reader->Seek(meth.types);
 				method.types = reader->ReadCString();
-				DefineObjCSymbol(DataSymbol, Type::ArrayType(Type::IntegerType(1, true), method.name.size() + 1),
-					"sel_" + method.name, meth.name, true);
-				DefineObjCSymbol(DataSymbol, Type::ArrayType(Type::IntegerType(1, true), method.types.size() + 1),
-					"selTypes_" + method.name, meth.types, true);
 			}
 			else
 			{
-				std::string sel;
 				view_ptr_t selRef;
 				reader->Seek(meth.name);
-				selRefAddr = meth.name;
+				record.selRefAddr = meth.name;
 				selRef = ReadPointerAccountingForRelocations(reader);
 				reader->Seek(meth.types);
 				method.types = reader->ReadCString();
-				selAddr = selRef;
-				if (const auto& it = m_selectorCache.find(selRef); it != m_selectorCache.end())
-					method.name = it->second;
-				else
-				{
-					reader->Seek(selRef);
-					method.name = reader->ReadCString(selRef);
-					m_selectorCache[selRef] = method.name;
-				}
-				auto selType = Type::ArrayType(Type::IntegerType(1, true), method.name.size() + 1);
-				DefineObjCSymbol(DataSymbol, selType, "sel_" + method.name, selRef, true);
-				DefineObjCSymbol(DataSymbol, Type::ArrayType(Type::IntegerType(1, true), method.types.size() + 1),
-					"selTypes_" + method.name, meth.types, true);
-				DefineObjCSymbol(DataSymbol, Type::PointerType(m_data->GetAddressSize(), selType),
-					"selRef_" + method.name, meth.name, true);
+				record.selAddr = selRef;
+				method.name = ReadSelectorName(reader, selRef);
 			}
-			// workflow objc support
-			if (selAddr)
-				m_selToImplementations[selAddr].push_back(meth.imp);
-			if (selRefAddr)
-				m_selRefToImplementations[selRefAddr].push_back(meth.imp);
-			// --
-
-			DefineObjCSymbol(DataSymbol, relativeOffsets ? m_typeNames.methodEntry : m_typeNames.method,
-				"method_" + method.name, cursor, true);
 			method.imp = meth.imp;
-			cls.methodList[cursor] = method;
-			m_localMethods[cursor] = method;
+			list.methods.push_back(std::move(record));
 		}
 		catch (ReadException& ex)
 		{
@@ -723,23 +698,65 @@ void ObjCProcessor::ReadMethodList(BinaryReader* reader, ClassBase& cls, std::st
 				"Failed to process a method at offset 0x%llx", start + sizeof(method_list_t) + (i * methodSize));
 		}
 	}
+	return list;
+}
+
+void ObjCProcessor::DefineMethodList(const MethodListRecord& list, ClassBase& cls, const std::string& name)
+{
+	DefineObjCSymbol(DataSymbol, m_typeNames.methodList, "method_list_" + name, list.start, true);
+
+	for (const auto& record : list.methods)
+	{
+		const Method& method = record.method;
+		const method_t& meth = record.meth;
+		if (record.directSelector)
+		{
+			DefineObjCSymbol(DataSymbol, Type::ArrayType(Type::IntegerType(1, true), method.name.size() + 1),
+				"sel_" + method.name, meth.name, true);
+			DefineObjCSymbol(DataSymbol, Type::ArrayType(Type::IntegerType(1, true), method.types.size() + 1),
+				"selTypes_" + method.name, meth.types, true);
+		}
+		else
+		{
+			auto selType = Type::ArrayType(Type::IntegerType(1, true), method.name.size() + 1);
+			DefineObjCSymbol(DataSymbol, selType, "sel_" + method.name, record.selAddr, true);
+			DefineObjCSymbol(DataSymbol, Type::ArrayType(Type::IntegerType(1, true), method.types.size() + 1),
+				"selTypes_" + method.name, meth.types, true);
+			DefineObjCSymbol(DataSymbol, Type::PointerType(m_data->GetAddressSize(), selType),
+				"selRef_" + method.name, meth.name, true);
+		}
+		// workflow objc support
+		if (record.selAddr)
+			m_selToImplementations[record.selAddr].push_back(meth.imp);
+		if (record.selRefAddr)
+			m_selRefToImplementations[record.selRefAddr].push_back(meth.imp);
+		// --
+
+		DefineObjCSymbol(DataSymbol, list.relativeOffsets ? m_typeNames.methodEntry : m_typeNames.method,
+			"method_" + method.name, record.cursor, true);
+		cls.methodList[record.cursor] = method;
+		m_localMethods[record.cursor] = method;
+	}
 }
 
-void ObjCProcessor::ReadIvarList(BinaryReader* reader, ClassBase& cls, std::string name, view_ptr_t start)
+ObjCProcessor::IvarListRecord ObjCProcessor::ReadIvarList(BinaryReader* reader, view_ptr_t start)
 {
+	IvarListRecord list;
+	list.start = start;
 	reader->Seek(start);
 	ivar_list_t head;
 	head.entsizeAndFlags = reader->Read32();
 	head.count = reader->Read32();
 	auto addressSize = m_data->GetAddressSize();
-	DefineObjCSymbol(DataSymbol, m_typeNames.ivarList, "ivar_list_" + name, start, true);
 	for (unsigned i = 0; i < head.count; i++)
 	{
 		try
 		{
-			Ivar ivar;
+			IvarRecord record;
+			Ivar& ivar = record.ivar;
 			ivar_t ivarStruct;
 			uint64_t cursor = start + (sizeof(ivar_list_t)) + (i * ((addressSize * 3) + 8));
+			record.cursor = cursor;
 			reader->Seek(cursor);
 			ivarStruct.offset = ReadPointerAccountingForRelocations(reader);
 			ivarStruct.name = ReadPointerAccountingForRelocations(reader);
@@ -754,9 +771,7 @@ void ObjCProcessor::ReadIvarList(BinaryReader* reader, ClassBase& cls, std::stri
 			reader->Seek(ivarStruct.type);
 			ivar.type = reader->ReadCString();
 
-			DefineObjCSymbol(DataSymbol, m_typeNames.ivar, "ivar_" + ivar.name, cursor, true);
-
-			cls.ivarList[cursor] = ivar;
+			list.ivars.push_back(std::move(record));
 		}
 		catch (ReadException& ex)
 		{
@@ -764,6 +779,17 @@ void ObjCProcessor::ReadIvarList(BinaryReader* reader, ClassBase& cls, std::stri
 				start + (sizeof(ivar_list_t)) + (i * ((addressSize * 3) + 8)));
 		}
 	}
+	return list;
+}
+
+void ObjCProcessor::DefineIvarList(const IvarListRecord& list, ClassBase& cls, const std::string& name)
+{
+	DefineObjCSymbol(DataSymbol, m_typeNames.ivarList, "ivar_list_" + name, list.start, true);
+	for (const auto& record : list.ivars)
+	{
+		DefineObjCSymbol(DataSymbol, m_typeNames.ivar, "ivar_" + record.ivar.name, record.cursor, true);
+		cls.ivarList[record.cursor] = record.ivar;
+	}
 }
 
 bool ObjCProcessor::ViewHasObjCMetadata(BinaryNinja::BinaryView* data)
@@ -1212,16 +1238,16 @@ void ObjCProcessor::ProcessObjCData()
 	auto reader = BinaryReader(m_data);
 	m_data->BeginBulkModifySymbols();
 	if (auto classList = m_data->GetSectionByName("__objc_classlist"))
-		LoadClasses(&reader, classList);
+		LoadClasses(classList);
 	if (auto nonLazyClassList = m_data->GetSectionByName("__objc_nlclslist"))
-		LoadClasses(&reader, nonLazyClassList);  // See: https://stackoverflow.com/a/15318325
+		LoadClasses(nonLazyClassList);  // See: https://stackoverflow.com/a/15318325
 
 	GenerateClassTypes();
 	for (auto& [_, cls] : m_classes)
 		ApplyMethodTypes(cls);
 
 	if (auto catList = m_data->GetSectionByName("__objc_catlist"))  // Do this after loading class type data.
-		LoadCategories(&reader, catList);
+		LoadCategories(catList);
 	for (auto& [_, cat] : m_categories)
 		ApplyMethodTypes(cat);
 
@@ -1232,7 +1258,7 @@ void ObjCProcessor::ProcessObjCData()
 	delete m_symbolQueue;
 
 	auto meta = SerializeMetadata();
-	m_data->StoreMetadata("Objective-C", meta, true);
+	m_data->StoreMetadata(ObjCMetadata::MetadataKey, meta, true);
 
 	m_relocationPointerRewrites.clear();
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <optional>
+#include <shared_mutex>
 #include <binaryninjaapi.h>
 
 namespace BinaryNinja {
@@ -135,6 +137,59 @@ namespace BinaryNinja {
 	};
 
 	class ObjCProcessor {
+		// Raw records filled in by the (parallel) read phase. Symbols and types for them are only
+		// defined afterwards, on one thread and in list order.
+		struct MethodRecord {
+			uint64_t cursor;
+			method_t meth;
+			Method method;
+			bool directSelector;
+			// workflow_objc support
+			uint64_t selRefAddr;
+			uint64_t selAddr;
+		};
+
+		struct MethodListRecord {
+			view_ptr_t start;
+			bool relativeOffsets;
+			std::vector<MethodRecord> methods;
+		};
+
+		struct IvarRecord {
+			uint64_t cursor;
+			Ivar ivar;
+		};
+
+		struct IvarListRecord {
+			view_ptr_t start;
+			std::vector<IvarRecord> ivars;
+		};
+
+		struct ClassRecord {
+			bool valid = false;
+			view_ptr_t classPointerLocation;
+			view_ptr_t classPtr;
+			view_ptr_t classROPtr;
+			class_t clsStruct;
+			class_ro_t classRO;
+			std::string name;
+			bool hasValidMetaClass = false;
+			bool hasValidMetaClassRO = false;
+			class_t metaClsStruct;
+			std::optional<MethodListRecord> methods;
+			std::optional<MethodListRecord> metaMethods;
+			std::optional<IvarListRecord> ivars;
+		};
+
+		struct CategoryRecord {
+			bool valid = false;
+			view_ptr_t catLocation;
+			category_t cat;
+			std::string additionsName;
+			std::optional<MethodListRecord> instanceMethods;
+			std::optional<MethodListRecord> classMethods;
+		};
+
 		struct Types {
 			QualifiedName relativePtr;
 			QualifiedName id;
@@ -166,6 +221,7 @@ namespace BinaryNinja {
 		Ref<Logger> m_logger;
 		std::map<uint64_t, Class> m_classes;
 		std::map<uint64_t, Class> m_categories;
+		std::shared_mutex m_selectorCacheMutex;
 		std::unordered_map<uint64_t, std::string> m_selectorCache;
 		std::unordered_map<uint64_t, Method> m_localMethods;
 
@@ -178,17 +234,19 @@ namespace BinaryNinja {
 		uint64_t ReadPointerAccountingForRelocations(BinaryReader* reader);
 		std::unordered_map<uint64_t, uint64_t> m_relocationPointerRewrites;
 
-		static Ref<Metadata> SerializeMethod(uint64_t loc, const Method& method);
-		static Ref<Metadata> SerializeClass(uint64_t loc, const Class& cls);
-
 		Ref<Metadata> SerializeMetadata();
 		std::vector<QualifiedNameOrType> ParseEncodedType(const std::string& type);
 		void DefineObjCSymbol(BNSymbolType symbolType, QualifiedName typeName, const std::string& name, uint64_t addr, bool deferred);
 		void DefineObjCSymbol(BNSymbolType symbolType, Ref<Type> type, const std::string& name, uint64_t addr, bool deferred);
-		void ReadIvarList(BinaryReader* reader, ClassBase& cls, std::string name, view_ptr_t start);
-		void ReadMethodList(BinaryReader* reader, ClassBase& cls, std::string name, view_ptr_t start);
-		void LoadClasses(BinaryReader* reader, Ref<Section> listSection);
-		void LoadCategories(BinaryReader* reader, Ref<Section> listSection);
+		std::string ReadSelectorName(BinaryReader* reader, view_ptr_t selRef);
+		IvarListRecord ReadIvarList(BinaryReader* reader, view_ptr_t start);
+		MethodListRecord ReadMethodList(BinaryReader* reader, view_ptr_t start);
+		ClassRecord ReadClass(BinaryReader* reader, view_ptr_t classPointerLocation);
+		CategoryRecord ReadCategory(BinaryReader* reader, view_ptr_t location);
+		void DefineIvarList(const IvarListRecord& list, ClassBase& cls, const std::string& name);
+		void DefineMethodList(const MethodListRecord& list, ClassBase& cls, const std::string& name);
+		void LoadClasses(Ref<Section> listSection);
+		void LoadCategories(Ref<Section> listSection);
 		void GenerateClassTypes();
 		bool ApplyMethodType(Class& cls, Method& method, bool isInstanceMethod);
 		void ApplyMethodTypes(Class& cls);
@@ -0,0 +1,271 @@
+#include <algorithm>
+#include <cstring>
+#include "objcmetadata.h"
+
+using namespace BinaryNinja;
+using namespace BinaryNinja::ObjCMetadata;
+
+
+static const size_t g_entrySizes[TableCount] = {
+	1,
+	sizeof(ClassEntry),
+	sizeof(ClassEntry),
+	sizeof(MethodEntry),
+	sizeof(uint64_t),
+	sizeof(SelectorImplementationsEntry),
+	sizeof(SelectorImplementationsEntry),
+	sizeof(uint64_t),
+	sizeof(SelectorNameEntry),
+};
+
+
+uint32_t ObjCMetadataWriter::AddString(const std::string& str)
+{
+	auto [it, inserted] = m_stringOffsets.try_emplace(str, (uint32_t)m_strings.size());
+	if (inserted)
+		m_strings.append(str.c_str(), str.size() + 1);
+	return it->second;
+}
+
+
+ClassEntry ObjCMetadataWriter::MakeClassEntry(uint64_t location, const std::string& name, const std::string& typeName,
+	const std::vector<uint64_t>& instanceMethods, const std::vector<uint64_t>& classMethods)
+{
+	ClassEntry entry {};
+	entry.location = location;
+	entry.name = AddString(name);
+	entry.typeName = AddString(typeName);
+	entry.firstInstanceMethod = (uint32_t)m_methodLocations.size();
+	entry.instanceMethodCount = (uint32_t)instanceMethods.size();
+	m_methodLocations.insert(m_methodLocations.end(), instanceMethods.begin(), instanceMethods.end());
+	entry.firstClassMethod = (uint32_t)m_methodLocations.size();
+	entry.classMethodCount = (uint32_t)classMethods.size();
+	m_methodLocations.insert(m_methodLocations.end(), classMethods.begin(), classMethods.end());
+	return entry;
+}
+
+
+void ObjCMetadataWriter::AddClass(uint64_t location, const std::string& name, const std::string& typeName,
+	const std::vector<uint64_t>& instanceMethods, const std::vector<uint64_t>& classMethods)
+{
+	m_classes.push_back(MakeClassEntry(location, name, typeName, instanceMethods, classMethods));
+}
+
+
+void ObjCMetadataWriter::AddCategory(uint64_t location, const std::string& name, const std::string& typeName,
+	const std::vector<uint64_t>& instanceMethods, const std::vector<uint64_t>& classMethods)
+{
+	m_categories.push_back(MakeClassEntry(location, name, typeName, instanceMethods, classMethods));
+}
+
+
+void ObjCMetadataWriter::AddMethod(uint64_t location, const std::string& name, const std::string& types, uint64_t imp)
+{
+	MethodEntry entry {};
+	entry.location = location;
+	entry.imp = imp;
+	entry.name = AddString(name);
+	entry.types = AddString(types);
+	m_methods.push_back(entry);
+}
+
+
+void ObjCMetadataWriter::AddSelRefImplementations(uint64_t selRef, const std::vector<uint64_t>& imps)
+{
+	m_selRefImplementations.push_back({selRef, (uint32_t)m_implementations.size(), (uint32_t)imps.size()});
+	m_implementations.insert(m_implementations.end(), imps.begin(), imps.end());
+}
+
+
+void ObjCMetadataWriter::AddSelImplementations(uint64_t sel, const std::vector<uint64_t>& imps)
+{
+	m_selImplementations.push_back({sel, (uint32_t)m_implementations.size(), (uint32_t)imps.size()});
+	m_implementations.insert(m_implementations.end(), imps.begin(), imps.end());
+}
+
+
+void ObjCMetadataWriter::AddSelRefName(uint64_t selRef, const std::string& name)
+{
+	m_selRefNames.push_back({selRef, AddString(name), 0});
+}
+
+
+std::vector<uint8_t> ObjCMetadataWriter::Finalize()
+{
+	auto bySelector = [](const SelectorImplementationsEntry& a, const SelectorImplementationsEntry& b) {
+		return a.selector < b.selector;
+	};
+	std::sort(m_selRefImplementations.begin(), m_selRefImplementations.end(), bySelector);
+	std::sort(m_selImplementations.begin(), m_selImplementations.end(), bySelector);
+	std::sort(m_selRefNames.begin(), m_selRefNames.end(),
+		[](const SelectorNameEntry& a, const SelectorNameEntry& b) { return a.selRef < b.selRef; });
+
+	const std::pair<const void*, size_t> tables[TableCount] = {
+		{m_strings.data(), m_strings.size()},
+		{m_classes.data(), m_classes.size()},
+		{m_categories.data(), m_categories.size()},
+		{m_methods.data(), m_methods.size()},
+		{m_methodLocations.data(), m_methodLocations.size()},
+		{m_selRefImplementations.data(), m_selRefImplementations.size()},
+		{m_selImplementations.data(), m_selImplementations.size()},
+		{m_implementations.data(), m_implementations.size()},
+		{m_selRefNames.data(), m_selRefNames.size()},
+	};
+
+	Header header {};
+	header.magic = Magic;
+	header.version = Version;
+	size_t size = sizeof(Header);
+	for (size_t i = 0; i < TableCount; i++)
+	{
+		size = (size + 7) & ~(size_t)7;
+		header.tables[i].offset = (uint32_t)size;
+		header.tables[i].count = (uint32_t)tables[i].second;
+		size += tables[i].second * g_entrySizes[i];
+	}
+
+	std::vector<uint8_t> result(size);
+	memcpy(result.data(), &header, sizeof(header));
+	for (size_t i = 0; i < TableCount; i++)
+	{
+		if (tables[i].second)
+			memcpy(result.data() + header.tables[i].offset, tables[i].first, tables[i].second * g_entrySizes[i]);
+	}
+	return result;
+}
+
+
+bool ObjCMetadataReader::Load(std::vector<uint8_t> data)
+{
+	m_data = std::move(data);
+	m_header = {};
+	if (m_data.size() < sizeof(Header))
+		return false;
+
+	Header header;
+	memcpy(&header, m_data.data(), sizeof(header));
+	if ((header.magic != Magic) || (header.version != Version))
+		return false;
+	for (size_t i = 0; i < TableCount; i++)
+	{
+		if ((uint64_t)header.tables[i].offset + ((uint64_t)header.tables[i].count * g_entrySizes[i]) > m_data.size())
+			return false;
+	}
+	m_header = header;
+	return true;
+}
+
+
+template <typename T>
+T ObjCMetadataReader::GetEntry(Table table, size_t index) const
+{
+	T result;
+	memcpy(&result, m_data.data() + m_header.tables[table].offset + (index * sizeof(T)), sizeof(T));
+	return result;
+}
+
+
+std::string_view ObjCMetadataReader::GetString(uint32_t offset) const
+{
+	const TableLocation& strings = m_header.tables[StringTable];
+	if (offset >= strings.count)
+		return {};
+	const char* start = (const char*)m_data.data() + strings.offset + offset;
+	const void* end = memchr(start, 0, strings.count - offset);
+	return std::string_view(start, end ? (const char*)end - start : strings.count - offset);
+}
+
+
+std::vector<uint64_t> ObjCMetadataReader::GetLocations(Table table, uint32_t first, uint32_t count) const
+{
+	std::vector<uint64_t> result;
+	if ((uint64_t)first + count > m_header.tables[table].count)
+		return result;
+	result.resize(count);
+	if (count)
+		memcpy(result.data(), m_data.data() + m_header.tables[table].offset + (first * sizeof(uint64_t)),
+			count * sizeof(uint64_t));
+	return result;
+}
+
+
+ObjCMetadataClass ObjCMetadataReader::DecodeClass(const ClassEntry& entry) const
+{
+	ObjCMetadataClass result;
+	result.location = entry.location;
+	result.name = GetString(entry.name);
+	result.typeName = GetString(entry.typeName);
+	result.instanceMethods = GetLocations(MethodLocationTable, entry.firstInstanceMethod, entry.instanceMethodCount);
+	result.classMethods = GetLocations(MethodLocationTable, entry.firstClassMethod, entry.classMethodCount);
+	return result;
+}
+
+
+ObjCMetadataClass ObjCMetadataReader::GetClass(size_t index) const
+{
+	return DecodeClass(GetEntry<ClassEntry>(ClassTable, index));
+}
+
+
+ObjCMetadataClass ObjCMetadataReader::GetCategory(size_t index) const
+{
+	return DecodeClass(GetEntry<ClassEntry>(CategoryTable, index));
+}
+
+
+ObjCMetadataMethod ObjCMetadataReader::GetMethod(size_t index) const
+{
+	auto entry = GetEntry<MethodEntry>(MethodTable, index);
+	return {entry.location, GetString(entry.name), GetString(entry.types), entry.imp};
+}
+
+
+std::vector<uint64_t> ObjCMetadataReader::FindImplementations(Table table, uint64_t selector) const
+{
+	// Binary search directly over the encoded, sorted table
+	size_t low = 0;
+	size_t high = m_header.tables[table].count;
+	while (low < high)
+	{
+		size_t mid = low + (high - low) / 2;
+		auto entry = GetEntry<SelectorImplementationsEntry>(table, mid);
+		if (entry.selector == selector)
+			return GetLocations(ImplementationTable, entry.firstImplementation, entry.implementationCount);
+		if (entry.selector < selector)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+	return {};
+}
+
+
+std::vector<uint64_t> ObjCMetadataReader::GetSelRefImplementations(uint64_t selRef) const
+{
+	return FindImplementations(SelRefImplementationTable, selRef);
+}
+
+
+std::vector<uint64_t> ObjCMetadataReader::GetSelImplementations(uint64_t sel) const
+{
+	return FindImplementations(SelImplementationTable, sel);
+}
+
+
+std::optional<std::string_view> ObjCMetadataReader::GetSelRefName(uint64_t selRef) const
+{
+	size_t low = 0;
+	size_t high = m_header.tables[SelRefNameTable].count;
+	while (low < high)
+	{
+		size_t mid = low + (high - low) / 2;
+		auto entry = GetEntry<SelectorNameEntry>(SelRefNameTable, mid);
+		if (entry.selRef == selRef)
+			return GetString(entry.name);
+		if (entry.selRef < selRef)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+	return std::nullopt;
+}
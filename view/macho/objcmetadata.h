@@ -0,0 +1,237 @@
+#pragma once
+
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+#include <binaryninjaapi.h>
+
+namespace BinaryNinja {
+	// Compact encoding of the "Objective-C" view metadata stored by ObjCProcessor.
+	//
+	// The metadata is a single raw blob: a header with the offset and entry count of every table,
+	// followed by the tables themselves. Integers are stored in the byte order of the host that wrote
+	// the blob; a blob written with the other byte order fails the magic check in Load. Strings are
+	// stored once in a table of NUL terminated strings and referenced by their offset into it. The
+	// selector tables are sorted by address so that consumers can look up a single selector without
+	// decoding the rest of the blob.
+	//
+	// This is version 2 of the metadata. Version 1 stored the same contents as nested key/value
+	// metadata under the same key; Load(BinaryView*) still reads it from databases saved before.
+	namespace ObjCMetadata {
+		constexpr const char* MetadataKey = "Objective-C";
+		constexpr uint32_t Magic = 0x434a424f;  // "OBJC"
+		constexpr uint32_t Version = 2;
+
+		enum Table : uint32_t {
+			StringTable,            // char
+			ClassTable,             // ClassEntry
+			CategoryTable,          // ClassEntry
+			MethodTable,            // MethodEntry
+			MethodLocationTable,    // uint64_t, ranges of it are referenced by ClassEntry
+			SelRefImplementationTable,  // SelectorImplementationsEntry
+			SelImplementationTable,     // SelectorImplementationsEntry
+			ImplementationTable,    // uint64_t, ranges of it are referenced by SelectorImplementationsEntry
+			SelRefNameTable,        // SelectorNameEntry
+			TableCount
+		};
+
+		struct TableLocation {
+			uint32_t offset;
+			uint32_t count;
+		};
+
+		struct Header {
+			uint32_t magic;
+			uint32_t version;
+			TableLocation tables[TableCount];
+		};
+
+		struct ClassEntry {
+			uint64_t location;
+			uint32_t name;
+			uint32_t typeName;
+			uint32_t firstInstanceMethod;
+			uint32_t instanceMethodCount;
+			uint32_t firstClassMethod;
+			uint32_t classMethodCount;
+		};
+
+		struct MethodEntry {
+			uint64_t location;
+			uint64_t imp;
+			uint32_t name;
+			uint32_t types;
+		};
+
+		struct SelectorImplementationsEntry {
+			uint64_t selector;
+			uint32_t firstImplementation;
+			uint32_t implementationCount;
+		};
+
+		struct SelectorNameEntry {
+			uint64_t selRef;
+			uint32_t name;
+			uint32_t reserved;
+		};
+	}
+
+	struct ObjCMetadataClass {
+		uint64_t location;
+		std::string_view name;
+		std::string_view typeName;
+		std::vector<uint64_t> instanceMethods;
+		std::vector<uint64_t> classMethods;
+	};
+
+	struct ObjCMetadataMethod {
+		uint64_t location;
+		std::string_view name;
+		std::string_view types;
+		uint64_t imp;
+	};
+
+	class ObjCMetadataWriter {
+		std::string m_strings;
+		std::unordered_map<std::string, uint32_t> m_stringOffsets;
+		std::vector<ObjCMetadata::ClassEntry> m_classes;
+		std::vector<ObjCMetadata::ClassEntry> m_categories;
+		std::vector<ObjCMetadata::MethodEntry> m_methods;
+		std::vector<uint64_t> m_methodLocations;
+		std::vector<ObjCMetadata::SelectorImplementationsEntry> m_selRefImplementations;
+		std::vector<ObjCMetadata::SelectorImplementationsEntry> m_selImplementations;
+		std::vector<uint64_t> m_implementations;
+		std::vector<ObjCMetadata::SelectorNameEntry> m_selRefNames;
+
+		uint32_t AddString(const std::string& str);
+		ObjCMetadata::ClassEntry MakeClassEntry(uint64_t location, const std::string& name, const std::string& typeName,
+			const std::vector<uint64_t>& instanceMethods, const std::vector<uint64_t>& classMethods);
+
+	public:
+		void AddClass(uint64_t location, const std::string& name, const std::string& typeName,
+			const std::vector<uint64_t>& instanceMethods, const std::vector<uint64_t>& classMethods);
+		void AddCategory(uint64_t location, const std::string& name, const std::string& typeName,
+			const std::vector<uint64_t>& instanceMethods, const std::vector<uint64_t>& classMethods);
+		void AddMethod(uint64_t location, const std::string& name, const std::string& types, uint64_t imp);
+		void AddSelRefImplementations(uint64_t selRef, const std::vector<uint64_t>& imps);
+		void AddSelImplementations(uint64_t sel, const std::vector<uint64_t>& imps);
+		void AddSelRefName(uint64_t selRef, const std::string& name);
+
+		std::vector<uint8_t> Finalize();
+	};
+
+	// Read access to the encoded metadata. Lookups decode only the entries they return.
+	class ObjCMetadataReader {
+		std::vector<uint8_t> m_data;
+		ObjCMetadata::Header m_header {};
+
+		template <typename T>
+		T GetEntry(ObjCMetadata::Table table, size_t index) const;
+		std::vector<uint64_t> GetLocations(ObjCMetadata::Table table, uint32_t first, uint32_t count) const;
+		std::vector<uint64_t> FindImplementations(ObjCMetadata::Table table, uint64_t selector) const;
+		ObjCMetadataClass DecodeClass(const ObjCMetadata::ClassEntry& entry) const;
+		static std::vector<uint8_t> EncodeVersion1(Metadata* metadata);
+
+	public:
+		// Returns false if the data is not compact Objective-C metadata of a supported version
+		bool Load(std::vector<uint8_t> data);
+		// Loads the metadata of a view, of either version. Returns false if the view has none.
+		bool Load(BinaryView* view);
+
+		std::string_view GetString(uint32_t offset) const;
+
+		size_t GetClassCount() const { return m_header.tables[ObjCMetadata::ClassTable].count; }
+		ObjCMetadataClass GetClass(size_t index) const;
+		size_t GetCategoryCount() const { return m_header.tables[ObjCMetadata::CategoryTable].count; }
+		ObjCMetadataClass GetCategory(size_t index) const;
+		size_t GetMethodCount() const { return m_header.tables[ObjCMetadata::MethodTable].count; }
+		ObjCMetadataMethod GetMethod(size_t index) const;
+
+		std::vector<uint64_t> GetSelRefImplementations(uint64_t selRef) const;
+		std::vector<uint64_t> GetSelImplementations(uint64_t sel) const;
+		std::optional<std::string_view> GetSelRefName(uint64_t selRef) const;
+	};
+	// The view based loading is defined here rather than in objcmetadata.cpp, so that the encoding itself
+	// builds without the core. Version 1 metadata is converted to the compact encoding, so that both
+	// versions are read the same way.
+	inline std::vector<uint8_t> ObjCMetadataReader::EncodeVersion1(Metadata* metadata)
+	{
+		auto get = [](const std::map<std::string, Ref<Metadata>>& store, const std::string& key) {
+			auto i = store.find(key);
+			return (i != store.end()) ? i->second : Ref<Metadata>();
+		};
+		auto getString = [](const Ref<Metadata>& value) {
+			return (value && value->IsString()) ? value->GetString() : std::string();
+		};
+		auto getInteger = [](const Ref<Metadata>& value) {
+			return (value && value->IsUnsignedInteger()) ? value->GetUnsignedInteger() : 0;
+		};
+		auto getIntegers = [](const Ref<Metadata>& value) {
+			return (value && value->IsUnsignedIntegerList()) ? value->GetUnsignedIntegerList() : std::vector<uint64_t>();
+		};
+		auto getArray = [](const Ref<Metadata>& value) {
+			return (value && value->IsArray()) ? value->GetArray() : std::vector<Ref<Metadata>>();
+		};
+
+		ObjCMetadataWriter writer;
+		const auto view = metadata->GetKeyValueStore();
+		auto readClasses = [&](const std::string& key, bool categories) {
+			for (const auto& cls : getArray(get(view, key)))
+			{
+				if (!cls->IsKeyValueStore())
+					continue;
+				const auto store = cls->GetKeyValueStore();
+				(writer.*(categories ? &ObjCMetadataWriter::AddCategory : &ObjCMetadataWriter::AddClass))(
+					getInteger(get(store, "loc")), getString(get(store, "name")), getString(get(store, "typeName")),
+					getIntegers(get(store, "instanceMethods")), getIntegers(get(store, "classMethods")));
+			}
+		};
+		readClasses("classes", false);
+		readClasses("categories", true);
+		for (const auto& method : getArray(get(view, "methods")))
+		{
+			if (!method->IsKeyValueStore())
+				continue;
+			const auto store = method->GetKeyValueStore();
+			writer.AddMethod(getInteger(get(store, "loc")), getString(get(store, "name")),
+				getString(get(store, "types")), getInteger(get(store, "imp")));
+		}
+
+		// The selector maps are arrays of [key, value] pairs
+		for (const auto& pair : getArray(get(view, "selRefImplementations")))
+		{
+			auto entry = getArray(pair);
+			if (entry.size() == 2)
+				writer.AddSelRefImplementations(getInteger(entry[0]), getIntegers(entry[1]));
+		}
+		for (const auto& pair : getArray(get(view, "selImplementations")))
+		{
+			auto entry = getArray(pair);
+			if (entry.size() == 2)
+				writer.AddSelImplementations(getInteger(entry[0]), getIntegers(entry[1]));
+		}
+		for (const auto& pair : getArray(get(view, "selRefToName")))
+		{
+			auto entry = getArray(pair);
+			if (entry.size() == 2)
+				writer.AddSelRefName(getInteger(entry[0]), getString(entry[1]));
+		}
+		return writer.Finalize();
+	}
+
+	inline bool ObjCMetadataReader::Load(BinaryView* view)
+	{
+		Ref<Metadata> metadata = view->QueryMetadata(ObjCMetadata::MetadataKey);
+		if (!metadata)
+			return false;
+		if (metadata->IsRaw())
+			return Load(metadata->GetRaw());
+		if (metadata->IsKeyValueStore())
+		{
+			auto version = metadata->Get("version");
+			if (version && version->IsUnsignedInteger() && (version->GetUnsignedInteger() == 1))
+				return Load(EncodeVersion1(metadata));
+		}
+		return false;
+	}
+}
@@ -0,0 +1,137 @@
+// Round trip test for the compact Objective-C metadata encoding (objcmetadata.h).
+//
+// Writes a blob with ObjCMetadataWriter, reads it back with ObjCMetadataReader and checks every
+// entry, then checks that truncated or foreign blobs are rejected.
+//
+//   macho_objcmetadata_test
+
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include "objcmetadata.h"
+
+using namespace std;
+using namespace BinaryNinja;
+
+static size_t g_failures = 0;
+
+#define CHECK(cond) \
+	do \
+	{ \
+		if (!(cond)) \
+		{ \
+			fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+			g_failures++; \
+		} \
+	} while (0)
+
+
+static vector<uint8_t> WriteSample()
+{
+	ObjCMetadataWriter writer;
+	writer.AddClass(0x1000, "NSFoo", "NSFoo", {0x2000, 0x2020}, {0x2040});
+	writer.AddClass(0x1100, "NSBar", "", {}, {});
+	writer.AddCategory(0x1200, "NSFoo(Extras)", "NSFoo", {0x2060}, {});
+	writer.AddMethod(0x2000, "init", "@16@0:8", 0x3000);
+	writer.AddMethod(0x2020, "initWithBar:", "@24@0:8@16", 0x3040);
+	// Added out of order, the writer sorts the selector tables
+	writer.AddSelRefImplementations(0x5010, {0x3040});
+	writer.AddSelRefImplementations(0x5000, {0x3000, 0x3080});
+	writer.AddSelImplementations(0x6000, {0x3000});
+	writer.AddSelRefName(0x5010, "initWithBar:");
+	writer.AddSelRefName(0x5000, "init");
+	return writer.Finalize();
+}
+
+
+static void TestRoundTrip()
+{
+	ObjCMetadataReader reader;
+	CHECK(reader.Load(WriteSample()));
+
+	CHECK(reader.GetClassCount() == 2);
+	ObjCMetadataClass cls = reader.GetClass(0);
+	CHECK(cls.location == 0x1000);
+	CHECK(cls.name == "NSFoo");
+	CHECK(cls.typeName == "NSFoo");
+	CHECK((cls.instanceMethods == vector<uint64_t> {0x2000, 0x2020}));
+	CHECK((cls.classMethods == vector<uint64_t> {0x2040}));
+	cls = reader.GetClass(1);
+	CHECK(cls.name == "NSBar");
+	CHECK(cls.typeName.empty());
+	CHECK(cls.instanceMethods.empty() && cls.classMethods.empty());
+
+	CHECK(reader.GetCategoryCount() == 1);
+	ObjCMetadataClass category = reader.GetCategory(0);
+	CHECK(category.location == 0x1200);
+	CHECK(category.name == "NSFoo(Extras)");
+	CHECK((category.instanceMethods == vector<uint64_t> {0x2060}));
+
+	CHECK(reader.GetMethodCount() == 2);
+	ObjCMetadataMethod method = reader.GetMethod(1);
+	CHECK(method.location == 0x2020);
+	CHECK(method.name == "initWithBar:");
+	CHECK(method.types == "@24@0:8@16");
+	CHECK(method.imp == 0x3040);
+
+	CHECK((reader.GetSelRefImplementations(0x5000) == vector<uint64_t> {0x3000, 0x3080}));
+	CHECK((reader.GetSelRefImplementations(0x5010) == vector<uint64_t> {0x3040}));
+	CHECK(reader.GetSelRefImplementations(0x5008).empty());
+	CHECK((reader.GetSelImplementations(0x6000) == vector<uint64_t> {0x3000}));
+	CHECK(reader.GetSelImplementations(0x5000).empty());
+	CHECK(reader.GetSelRefName(0x5000) == "init");
+	CHECK(reader.GetSelRefName(0x5010) == "initWithBar:");
+	CHECK(!reader.GetSelRefName(0x6000).has_value());
+}
+
+
+static void TestEmpty()
+{
+	ObjCMetadataReader reader;
+	CHECK(reader.Load(ObjCMetadataWriter().Finalize()));
+	CHECK(reader.GetClassCount() == 0);
+	CHECK(reader.GetCategoryCount() == 0);
+	CHECK(reader.GetMethodCount() == 0);
+	CHECK(reader.GetSelRefImplementations(0).empty());
+	CHECK(!reader.GetSelRefName(0).has_value());
+}
+
+
+static void TestRejected()
+{
+	vector<uint8_t> blob = WriteSample();
+	ObjCMetadataReader reader;
+
+	// Any truncation cuts into the last table or the header
+	for (size_t size = 0; size < blob.size(); size++)
+		CHECK(!reader.Load(vector<uint8_t>(blob.begin(), blob.begin() + size)));
+
+	vector<uint8_t> badMagic = blob;
+	badMagic[0] ^= 0xff;
+	CHECK(!reader.Load(badMagic));
+
+	vector<uint8_t> badVersion = blob;
+	uint32_t version = ObjCMetadata::Version + 1;
+	memcpy(&badVersion[offsetof(ObjCMetadata::Header, version)], &version, sizeof(version));
+	CHECK(!reader.Load(badVersion));
+
+	// A failed load leaves an empty reader behind
+	CHECK(reader.GetClassCount() == 0);
+	CHECK(reader.GetSelRefImplementations(0x5000).empty());
+}
+
+
+int main()
+{
+	TestRoundTrip();
+	TestEmpty();
+	TestRejected();
+
+	if (g_failures)
+	{
+		printf("%zu checks failed\n", g_failures);
+		return 1;
+	}
+	printf("all checks passed\n");
+	return 0;
+}
@@ -1,7 +1,13 @@
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstring>
 #include <cctype>
+#include <condition_variable>
+#include <exception>
+#include <functional>
 #include <list>
+#include <memory>
 #include <string.h>
 #include <inttypes.h>
 #include <iomanip>
@@ -9,12 +15,17 @@
 #include <sstream>
 #include <type_traits>
 #include <utility>
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__)
+	#define PE_SIMD_SSE2
+	#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+	#define PE_SIMD_NEON
+	#include <arm_neon.h>
+#endif
 #include "peview.h"
 #include "coffview.h"
 #include "teview.h"
 
-#define STRING_READ_CHUNK_SIZE 32
-
 using namespace BinaryNinja;
 using namespace std;
 
@@ -365,6 +376,117 @@ const string &GetRichProductName(uint16_t buildNum) {
   }
 }
 
+static double MillisecondsSince(chrono::steady_clock::time_point start)
+{
+	return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+
+// Collects how long each directory took to define during PEView::Init. Stages that were read on the
+// worker pool also report how long the read itself took, which overlaps with the earlier stages.
+class PEStageTimer
+{
+	chrono::steady_clock::time_point m_last = chrono::steady_clock::now();
+	string m_report;
+
+public:
+	void Checkpoint(const char* stage, double readTime = -1)
+	{
+		auto now = chrono::steady_clock::now();
+		double elapsed = chrono::duration<double, milli>(now - m_last).count();
+		m_last = now;
+		if (!m_report.empty())
+			m_report += ", ";
+		if (readTime >= 0)
+			m_report += fmt::format("{}: {:.1f} ms (read {:.1f} ms)", stage, elapsed, readTime);
+		else
+			m_report += fmt::format("{}: {:.1f} ms", stage, elapsed);
+	}
+
+	const string& GetReport() const { return m_report; }
+};
+
+
+// Reads one directory on the worker pool while PEView::Init defines the earlier ones. If no worker
+// has started the read by the time Get is called, it runs on the calling thread instead, so Init
+// never waits on a worker that is not available (Init itself may be running on one).
+template <typename T>
+class PEReadStage
+{
+	struct State
+	{
+		function<T()> read;
+		atomic<bool> claimed = false;
+		mutex lock;
+		condition_variable finished;
+		bool done = false;
+		T result;
+		exception_ptr error;
+	};
+	shared_ptr<State> m_state;
+
+	static void Run(State& state)
+	{
+		try
+		{
+			state.result = state.read();
+		}
+		catch (...)
+		{
+			state.error = current_exception();
+		}
+		unique_lock<mutex> lock(state.lock);
+		state.done = true;
+		state.finished.notify_all();
+	}
+
+	void Wait()
+	{
+		if (!m_state->claimed.exchange(true))
+		{
+			Run(*m_state);
+			return;
+		}
+		unique_lock<mutex> lock(m_state->lock);
+		m_state->finished.wait(lock, [&]() { return m_state->done; });
+	}
+
+public:
+	PEReadStage() = default;
+	PEReadStage(const PEReadStage&) = delete;
+	PEReadStage& operator=(const PEReadStage&) = delete;
+
+	void Start(function<T()> read, const string& name)
+	{
+		m_state = make_shared<State>();
+		m_state->read = std::move(read);
+		WorkerPriorityEnqueue(
+			[state = m_state]() {
+				if (!state->claimed.exchange(true))
+					Run(*state);
+			},
+			name);
+	}
+
+	// The read may refer to the view, so it must not outlive Init even if Init returns early
+	~PEReadStage()
+	{
+		if (m_state)
+			Wait();
+	}
+
+	bool IsStarted() const { return m_state != nullptr; }
+
+	T Get()
+	{
+		Wait();
+		if (m_state->error)
+			rethrow_exception(m_state->error);
+		return std::move(m_state->result);
+	}
+};
+
+
 static string GetDebugTypeName(int type)
 {
 	switch (type)
@@ -1389,8 +1511,50 @@ bool PEView::Init()
 		m_logger->LogError("Failed to parse COFF symbol table: %s\n", e.what());
 	}
 
+	// The import, exception, export and base relocation directories are read on the worker pool with
+	// their own readers while the remaining directories are defined here. Defining types, symbols and
+	// relocations still happens on this thread, in the same order as before.
+	UpdateSectionIndex();
+	size_t exceptionEntrySize;
+	switch (header.machine)
+	{
+		case IMAGE_FILE_MACHINE_AMD64:
+		case IMAGE_FILE_MACHINE_IA64:
+			exceptionEntrySize = 12;
+			break;
+		case IMAGE_FILE_MACHINE_MIPSFPU:
+		case IMAGE_FILE_MACHINE_R4000:
+		case IMAGE_FILE_MACHINE_WCEMIPSV2:
+			exceptionEntrySize = 20;
+			break;
+		default:
+			exceptionEntrySize = 8;
+			break;
+	}
+	bool processExceptionTable = true;
+	if (settings && settings->Contains("loader.pe.processExceptionTable"))
+		processExceptionTable = settings->Get<bool>("loader.pe.processExceptionTable", this);
+	bool readExceptionTable = processExceptionTable && (m_dataDirs.size() > IMAGE_DIRECTORY_ENTRY_EXCEPTION)
+		&& m_dataDirs[IMAGE_DIRECTORY_ENTRY_EXCEPTION].size
+		&& ((m_dataDirs[IMAGE_DIRECTORY_ENTRY_EXCEPTION].size % exceptionEntrySize) == 0);
+
+	PEReadStage<PEImportDirectoryRecords> importStage;
+	PEReadStage<PEExceptionDirectoryRecords> exceptionStage;
+	PEReadStage<PEExportDirectoryRecords> exportStage;
+	PEReadStage<PEBaseRelocationRecords> baseRelocationStage;
+	importStage.Start([this]() { return ReadImportDirectory(); }, "PE Imports");
+	if (readExceptionTable)
+		exceptionStage.Start([this, machine = header.machine, exceptionEntrySize]() {
+			return ReadExceptionDirectory(machine, exceptionEntrySize);
+		}, "PE Exceptions");
+	exportStage.Start([this]() { return ReadExportDirectory(); }, "PE Exports");
+	baseRelocationStage.Start([this]() { return ReadBaseRelocationDirectory(); }, "PE Base Relocations");
+	PEStageTimer stageTimer;
+
+	PEImportDirectoryRecords importRecords = importStage.Get();
 	try
 	{
+		const PEImportDirectoryRecords& records = importRecords;
 		PEDataDirectory dir;
 		// Read import directory
 		if (m_dataDirs.size() > IMAGE_DIRECTORY_ENTRY_IMPORT)
@@ -1403,34 +1567,11 @@ bool PEView::Init()
 			size_t numImportEntries = 0;
 			vector<Ref<Metadata>> libraries;
 			vector<Ref<Metadata>> libraryFound;
-			while (true)
+			for (const PEImportRecord& record : records.imports)
 			{
-				// Read in next directory entry
-				reader.Seek(RVAToFileOffset(dir.virtualAddress + (numImportEntries * 20)));
-				PEImportDirectoryEntry importDirEntry;
-				importDirEntry.lookup = reader.Read32();
-				importDirEntry.timestamp = reader.Read32();
-				importDirEntry.forwardChain = reader.Read32();
-				importDirEntry.nameAddress = reader.Read32();
-				importDirEntry.iat = reader.Read32();
-
-				// Windows PE loader ignores the dir.size; instead, it looks for the first
-				// Import_Directory_Table that has a null nameAddress to stop the iteration
-				if (importDirEntry.nameAddress == 0)
-				{
-					if (numImportEntries + 1 != dir.size / 20)
-						m_logger->LogWarn(
-							"The number of Import_Directory_Table reported by the Data Directories is different from "
-							"its correct amount. "
-							"There are actually %d Import_Directory_Table in the file, but SizeOfImportTable reports "
-							"%d. "
-							"The PE parsing continues with the actual number of Import_Directory_Table",
-							numImportEntries + 1, dir.size / 20);
-					break;
-				}
+				const PEImportDirectoryEntry& importDirEntry = record.entry;
 
 				// Read name of imported DLL, and trim extension for creating symbol name
-				importDirEntry.name = ReadString(importDirEntry.nameAddress);
 				Ref<ExternalLibrary> externLib = GetExternalLibrary(importDirEntry.name);
 				if (!externLib)
 				{
@@ -1495,29 +1636,13 @@ bool PEView::Init()
 				// We should make this second unused data a structure containing this information information
 				// and default it to collapsed...IDA Just doesn't show anything at all
 				m_logger->LogDebug("Name: %s\n", dllName.c_str());
-				while (true)
+				for (const PEImportThunkRecord& thunk : record.thunks)
 				{
-					uint64_t entry;
-					bool isOrdinal;
-					if (m_is64)
-					{
-						entry = Read64(entryOffset);
-						isOrdinal = (entry & 0x8000000000000000LL) != 0;
-						entry &= 0x7fffffffffffffffLL;
-						DefineDataVariable(m_imageBase + entryOffset, Type::IntegerType(8, false));
-					}
-					else
-					{
-						entry = Read32(entryOffset);
-						isOrdinal = (entry & 0x80000000) != 0;
-						entry &= 0x7fffffff;
-						DefineDataVariable(m_imageBase + entryOffset, Type::IntegerType(4, false));
-					}
+					uint64_t entry = thunk.entry;
+					bool isOrdinal = thunk.isOrdinal;
+					DefineDataVariable(m_imageBase + entryOffset, Type::IntegerType(m_is64 ? 8 : 4, false));
 					m_logger->LogDebug("Entry 0x%llx isOrdinal: %s\n", entry, isOrdinal ? "True" : "False");
 
-					if ((!isOrdinal) && (entry == 0))
-						break;
-
 					string func;
 					uint16_t ordinal;
 					if (isOrdinal)
@@ -1536,8 +1661,8 @@ bool PEView::Init()
 					}
 					else
 					{
-						ordinal = Read16(entry);
-						func = ReadString(entry + 2);
+						ordinal = thunk.hint;
+						func = thunk.name;
 						DefineDataVariable(m_imageBase + entry, Type::IntegerType(2, false));
 						DefineAutoSymbol(new Symbol(DataSymbol, "__export_name_ptr_table_" + to_string(numImportEntries) + "(" + dllName + ":" + func + ")", m_imageBase + entry, NoBinding));
 						DefineDataVariable(m_imageBase + entry + 2, Type::ArrayType(Type::IntegerType(1, true), func.size() + 1));
@@ -1564,8 +1689,25 @@ bool PEView::Init()
 					iatOffset += m_is64 ? 8 : 4;
 				}
 
+				// The reader stopped inside this thunk list, anything after it was not read
+				if (!record.complete)
+					break;
+				DefineDataVariable(m_imageBase + entryOffset, Type::IntegerType(m_is64 ? 8 : 4, false));
 				numImportEntries++;
 			}
+			if (!records.error.empty())
+				throw PEFormatException(records.error);
+
+			// Windows PE loader ignores the dir.size; instead, it looks for the first
+			// Import_Directory_Table that has a null nameAddress to stop the iteration
+			if (records.terminated && (numImportEntries + 1 != dir.size / 20))
+				m_logger->LogWarn(
+					"The number of Import_Directory_Table reported by the Data Directories is different from "
+					"its correct amount. "
+					"There are actually %d Import_Directory_Table in the file, but SizeOfImportTable reports "
+					"%d. "
+					"The PE parsing continues with the actual number of Import_Directory_Table",
+					numImportEntries + 1, dir.size / 20);
 
 			StoreMetadata("Libraries", new Metadata(libraries), true);
 			StoreMetadata("LibraryFound", new Metadata(libraryFound), true);
@@ -1593,7 +1735,11 @@ bool PEView::Init()
 	{
 		m_logger->LogWarn("Failed to parse import directory: %s\n", e.what());
 	}
+	stageTimer.Checkpoint("imports", importRecords.readTime);
 
+	PEExceptionDirectoryRecords exceptionRecords;
+	if (exceptionStage.IsStarted())
+		exceptionRecords = exceptionStage.Get();
 	try
 	{
 		if ((m_dataDirs.size() > IMAGE_DIRECTORY_ENTRY_EXCEPTION) && m_dataDirs[IMAGE_DIRECTORY_ENTRY_EXCEPTION].size)
@@ -1652,11 +1798,9 @@ bool PEView::Init()
 			}
 
 			// parse exception table and add functions
-			bool processExceptionTable = true;
-			if (settings && settings->Contains("loader.pe.processExceptionTable"))
-				processExceptionTable = settings->Get<bool>("loader.pe.processExceptionTable", this);
 			if (processExceptionTable)
 			{
+				const PEExceptionDirectoryRecords& records = exceptionRecords;
 				StructureBuilder unwindInfoStructBuilder;
 				unwindInfoStructBuilder.AddMember(Type::IntegerType(1, false), "VersionAndFlag");
 				unwindInfoStructBuilder.AddMember(Type::IntegerType(1, false), "SizeOfProlog");
@@ -1669,21 +1813,18 @@ bool PEView::Init()
 				string unwindInfoTypeId = Type::GenerateAutoTypeId("pe", unwindInfoName);
 				QualifiedName unwindInfo = DefineType(unwindInfoTypeId, unwindInfoName, unwindInfoStructType);
 
-				BinaryReader unwindReader(GetParentView(), LittleEndian);
-				for (size_t i = 0; i < numExceptionEntries; i++)
+				for (const PEExceptionRecord& record : records.entries)
 				{
-					reader.Seek(RVAToFileOffset(m_dataDirs[IMAGE_DIRECTORY_ENTRY_EXCEPTION].virtualAddress + (i * entrySize)));
-					uint32_t beginAddress = reader.Read32();
 					switch (header.machine)
 					{
 						case IMAGE_FILE_MACHINE_AMD64:
 						case IMAGE_FILE_MACHINE_IA64:
 						{
-							reader.SeekRelative(4);  // EndAddress
-							uint32_t unwindRva = reader.Read32();
+							uint32_t unwindRva = record.unwindRva;
 							DefineDataVariable(m_imageBase + unwindRva, Type::NamedType(this, unwindInfo));
-							unwindReader.Seek(RVAToFileOffset(unwindRva));
-							uint32_t unwindInformation = unwindReader.Read32();
+							if (!record.unwindValid)
+								continue;
+							uint32_t unwindInformation = record.unwindInformation;
 							uint8_t unwindCodeCount = (unwindInformation >> 16) & 0xff;
 							if (unwindCodeCount > 0)
 								DefineDataVariable(m_imageBase + unwindRva + 4, Type::ArrayType(Type::IntegerType(2, false), unwindCodeCount));
@@ -1709,10 +1850,28 @@ bool PEView::Init()
 						default:
 							break;
 					}
-					uint64_t exceptionEntry = m_imageBase + beginAddress;
+				}
+
+				// The starts are already validated, deduplicated and sorted by the reader
+				vector<uint64_t> functionStarts;
+				vector<uint64_t> functionSizes;
+				functionStarts.reserve(records.functionStarts.size());
+				functionSizes.reserve(records.functionSizes.size());
+				for (size_t i = 0; i < records.functionStarts.size(); i++)
+				{
+					uint64_t exceptionEntry = m_imageBase + records.functionStarts[i];
+					functionStarts.push_back(exceptionEntry);
+					functionSizes.push_back(records.functionSizes[i]);
 					Ref<Platform> targetPlatform = platform->GetAssociatedPlatformByAddress(exceptionEntry);
 					AddFunctionForAnalysis(targetPlatform, exceptionEntry);
 				}
+				StoreMetadata("ExceptionDirectoryFunctions", new Metadata(map<string, Ref<Metadata>> {
+					{"starts", new Metadata(functionStarts)},
+					{"sizes", new Metadata(functionSizes)}}), true);
+				if (records.invalidEntries)
+					m_logger->LogWarn("Ignored %zu exception directory entries outside of executable sections", records.invalidEntries);
+				if (!records.error.empty())
+					throw PEFormatException(records.error);
 			}
 		}
 	}
@@ -1720,6 +1879,7 @@ bool PEView::Init()
 	{
 		m_logger->LogWarn("Failed to parse exception directory: %s\n", e.what());
 	}
+	stageTimer.Checkpoint("exceptions", exceptionRecords.readTime);
 
 	try
 	{
@@ -1845,6 +2005,7 @@ bool PEView::Init()
 	{
 		m_logger->LogWarn("Failed to parse debug directory: %s\n", e.what());
 	}
+	stageTimer.Checkpoint("debug");
 
 	try
 	{
@@ -1959,6 +2120,7 @@ bool PEView::Init()
 	{
 		m_logger->LogWarn("Failed to parse TLS directory: %s\n", e.what());
 	}
+	stageTimer.Checkpoint("TLS");
 
 	try
 	{
@@ -2148,6 +2310,7 @@ bool PEView::Init()
 	{
 		m_logger->LogWarn("Failed to parse Delay Import Descriptor directory: %s\n", e.what());
 	}
+	stageTimer.Checkpoint("delay imports");
 
 	try
 	{
@@ -2401,24 +2564,21 @@ bool PEView::Init()
 	{
 		m_logger->LogWarn("Failed to parse load configuration directory: %s\n", e.what());
 	}
+	stageTimer.Checkpoint("load config");
 
+	PEExportDirectoryRecords exportRecords = exportStage.Get();
 	try
 	{
 		if ((m_dataDirs.size() > IMAGE_DIRECTORY_ENTRY_EXPORT) && (m_dataDirs[IMAGE_DIRECTORY_ENTRY_EXPORT].size >= 40))
 		{
-			PEExportDirectory dir;
-			reader.Seek(RVAToFileOffset(m_dataDirs[IMAGE_DIRECTORY_ENTRY_EXPORT].virtualAddress));
-			dir.characteristics = reader.Read32();
-			dir.timestamp = reader.Read32();
-			dir.majorVersion = reader.Read16();
-			dir.minorVersion = reader.Read16();
-			dir.dllNameAddress = reader.Read32();
-			dir.base = reader.Read32();
-			dir.functionCount = reader.Read32();
-			dir.nameCount = reader.Read32();
-			dir.addressOfFunctions = reader.Read32();
-			dir.addressOfNames = reader.Read32();
-			dir.addressOfNameOrdinals = reader.Read32();
+			// Each piece of the directory is only missing if the reader failed at that point
+			const PEExportDirectoryRecords& records = exportRecords;
+			auto require = [&](const auto& value) -> const auto& {
+				if (!value)
+					throw PEFormatException(records.error);
+				return *value;
+			};
+			const PEExportDirectory& dir = require(records.dir);
 
 			// Create Export Directory Table Type
 			StructureBuilder exportDirBuilder;
@@ -2444,7 +2604,7 @@ bool PEView::Init()
 			DefineAutoSymbol(new Symbol(DataSymbol, "__export_directory_table", m_imageBase + m_dataDirs[IMAGE_DIRECTORY_ENTRY_EXPORT].virtualAddress, NoBinding));
 
 			// Read name of imported DLL, and trim extension for creating symbol name
-			string dllName = ReadString(dir.dllNameAddress);
+			const string& dllName = require(records.dllName);
 			size_t strPos = dllName.rfind('.');
 			string dllShortName = (strPos != string::npos) ? dllName.substr(0, strPos) : dllName;
 			DefineDataVariable(m_imageBase + dir.dllNameAddress, Type::ArrayType(Type::IntegerType(1, true), dllName.size() + 1));
@@ -2454,37 +2614,23 @@ bool PEView::Init()
 			DefineDataVariable(m_imageBase + dir.addressOfFunctions, Type::ArrayType(Type::IntegerType(4, false), dir.functionCount));
 			DefineAutoSymbol(new Symbol(DataSymbol, tableName, m_imageBase + dir.addressOfFunctions, NoBinding));
 
-			vector<uint32_t> funcs;
-			reader.Seek(RVAToFileOffset(dir.addressOfFunctions));
-			funcs.reserve(dir.functionCount);
-			for (uint32_t i = 0; i < dir.functionCount; i++)
-				funcs.push_back(reader.Read32());
+			const vector<uint32_t>& funcs = require(records.funcs);
 
-			vector<uint32_t> nameAddrs;
 			if (dir.addressOfNames != 0)
 			{
 				string tableName = "__pe_" + dllShortName + "_export_name_pointer_table";
 				DefineDataVariable(m_imageBase + dir.addressOfNames, Type::ArrayType(Type::IntegerType(4, false), dir.nameCount));
 				DefineAutoSymbol(new Symbol(DataSymbol, tableName, m_imageBase + dir.addressOfNames, NoBinding));
-
-				nameAddrs.reserve(dir.nameCount);
-				reader.Seek(RVAToFileOffset(dir.addressOfNames));
-				for (uint32_t i = 0; i < dir.nameCount; i++)
-					nameAddrs.push_back(reader.Read32());
 			}
+			const vector<uint32_t>& nameAddrs = require(records.nameAddrs);
 
-			vector<uint16_t> nameOrdinals;
 			if (dir.addressOfNameOrdinals != 0)
 			{
 				string tableName = "__pe_" + dllShortName + "_export_ordinal_table";
 				DefineDataVariable(m_imageBase + dir.addressOfNameOrdinals, Type::ArrayType(Type::IntegerType(2, false), dir.nameCount));
 				DefineAutoSymbol(new Symbol(DataSymbol, tableName, m_imageBase + dir.addressOfNameOrdinals, NoBinding));
-
-				nameOrdinals.reserve(dir.nameCount);
-				reader.Seek(RVAToFileOffset(dir.addressOfNameOrdinals));
-				for (uint32_t i = 0; i < dir.nameCount; i++)
-					nameOrdinals.push_back(reader.Read16());
 			}
+			const vector<uint16_t>& nameOrdinals = require(records.nameOrdinals);
 
 			map<uint16_t, string> namesByOrdinal;
 			for (uint32_t i = 0; i < dir.nameCount; i++)
@@ -2493,8 +2639,10 @@ bool PEView::Init()
 					break;
 				if (i >= nameAddrs.size())
 					break;
+				if (i >= records.names.size())
+					throw PEFormatException(records.error);
 
-				string name = ReadString(nameAddrs[i]);
+				const string& name = records.names[i];
 				namesByOrdinal[nameOrdinals[i]] = name;
 
 				DefineDataVariable(m_imageBase + nameAddrs[i], Type::ArrayType(Type::IntegerType(1, true), name.size() + 1));
@@ -2525,7 +2673,10 @@ bool PEView::Init()
 
 				if ((rvAddr >= exportTableStart) && (rvAddr < exportTableEnd))
 				{
-					string forwarderName = ReadString(rvAddr);
+					auto forwarder = records.forwarderNames.find(rvAddr);
+					if (forwarder == records.forwarderNames.end())
+						throw PEFormatException(records.error);
+					const string& forwarderName = forwarder->second;
 					DefineDataVariable(m_imageBase + rvAddr, Type::ArrayType(Type::IntegerType(1, true), forwarderName.size() + 1));
 					DefineAutoSymbol(new Symbol(DataSymbol, "__forwarder_name(" + forwarderName + ")", m_imageBase + rvAddr, GlobalBinding,
 						NameSpace(DEFAULT_INTERNAL_NAMESPACE), i + dir.base));
@@ -2545,6 +2696,7 @@ bool PEView::Init()
 	{
 		m_logger->LogWarn("Failed to parse export directory: %s\n", e.what());
 	}
+	stageTimer.Checkpoint("exports", exportRecords.readTime);
 
 	m_symbolQueue->Process();
 	delete m_symbolQueue;
@@ -2554,67 +2706,19 @@ bool PEView::Init()
 
 	StoreMetadata("SymbolExternalLibraryMapping", m_symExternMappingMetadata, true);
 
+	PEBaseRelocationRecords baseRelocationRecords = baseRelocationStage.Get();
 	try
 	{
-		if (m_dataDirs.size() > IMAGE_DIRECTORY_ENTRY_BASERELOC)
-		{
-			PEDataDirectory dir = m_dataDirs[IMAGE_DIRECTORY_ENTRY_BASERELOC];
-			// Check if there is a '.reloc' section that is different than this directory entry
-			vector<PEDataDirectory> dirs = { m_dataDirs[IMAGE_DIRECTORY_ENTRY_BASERELOC]};
-			auto section = find_if(m_sections.begin(), m_sections.end(), [](const PESection& section) { return section.name == ".reloc"; });
-			if (section != m_sections.end())
-			{
-				if (section->virtualAddress != dir.virtualAddress)
-					dirs.push_back({ section->virtualAddress, section->sizeOfRawData });
-			}
-			for (auto& dir : dirs)
-			{
-				if (dir.size == 0 || dir.virtualAddress == 0)
-					continue;
-
-				reader.Seek(RVAToFileOffset(dir.virtualAddress));
-				uint64_t size = 0;
-				while (size < dir.size)
-				{
-					ImageBaseRelocation baseReloc;
-					baseReloc.VirtualAddress = reader.Read32() + m_imageBase;
-					baseReloc.SizeOfBlock = reader.Read32();
-					if (baseReloc.SizeOfBlock < 8)
-						break;
-					if (baseReloc.SizeOfBlock == 8)
-					{
-						size += baseReloc.SizeOfBlock;
-						continue;
-					}
-					size_t nEntries = (baseReloc.SizeOfBlock - 8) / sizeof(uint16_t);
-					uint16_t* relocEntries = new uint16_t[nEntries];
-					if (relocEntries)
-					{
-						reader.Read(relocEntries, nEntries * sizeof(uint16_t));
-						for (size_t i = 0; i < nEntries; i++)
-						{
-							BNRelocationInfo reloc;
-							memset(&reloc, 0, sizeof(reloc));
-							reloc.nativeType = relocEntries[i] >> 12;
-							if (!reloc.nativeType) // IMAGE_REL_BASED_ABSOLUTE relocations are skipped/used for padding
-								continue;
-							reloc.address = baseReloc.VirtualAddress + (relocEntries[i] & 0xfff);
-							reloc.size = m_is64 ? 8 : 4;
-							reloc.pcRelative = false;
-							reloc.base = m_imageBase - m_peImageBase;
-							DefineRelocation(m_arch, reloc, 0, reloc.address);
-						}
-						delete[] relocEntries;
-					}
-					size += baseReloc.SizeOfBlock;
-				}
-			}
-		}
+		for (BNRelocationInfo& reloc : baseRelocationRecords.relocs)
+			DefineRelocation(m_arch, reloc, 0, reloc.address);
+		if (!baseRelocationRecords.error.empty())
+			throw PEFormatException(baseRelocationRecords.error);
 	}
 	catch (std::exception& e)
 	{
 		m_logger->LogWarn("Failed to parse relocation directory: %s\n", e.what());
 	}
+	stageTimer.Checkpoint("base relocations", baseRelocationRecords.readTime);
 
 	for (auto& [reloc, name] : relocs)
 	{
@@ -2721,7 +2825,7 @@ bool PEView::Init()
 
 							size_t nameAddr = dir.virtualAddress + (importDirEntry.id ^ 0x80000000);
 
-							BinaryReader nameReader(GetParentView(), LittleEndian);
+							BinaryReader& nameReader = GetParentReader();
 							nameReader.Seek(RVAToFileOffset(nameAddr));
 
 							uint16_t nameLen = nameReader.Read16();
@@ -2748,7 +2852,7 @@ bool PEView::Init()
 
 				for(size_t dataEntryNum = 0; dataEntryNum < dataEntryOffsets.size(); dataEntryNum++)
 				{
-					BinaryReader entryReader(GetParentView(), LittleEndian);
+					BinaryReader& entryReader = GetParentReader();
 
 					size_t entryOffset = dataEntryOffsets[dataEntryNum];
 					entryReader.Seek(RVAToFileOffset(dir.virtualAddress + entryOffset));
@@ -2781,29 +2885,94 @@ bool PEView::Init()
 	{
 		m_logger->LogWarn("Failed to parse resource directory: %s\n", e.what());
 	}
+	stageTimer.Checkpoint("resources");
 
 	// Add a symbol for the entry point
 	if (m_entryPoint)
 		DefineAutoSymbol(new Symbol(FunctionSymbol, "_start", m_imageBase + m_entryPoint));
 	std::chrono::steady_clock::time_point endTime = std::chrono::steady_clock::now();
 	double t = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime).count() / 1000.0;
+	m_logger->LogInfo("PE directory parsing times: %s\n", stageTimer.GetReport().c_str());
 	m_logger->LogInfo("PE parsing took %.3f seconds\n", t);
 
 	return true;
 }
 
 
-uint64_t PEView::RVAToFileOffset(uint64_t offset, bool except)
+// Sections may overlap, so the index splits the RVA space at every section boundary and maps each piece to the first
+// section that contains it, which is the section a linear scan of m_sections would find
+static vector<PESectionInterval> BuildSectionIntervals(const vector<PESection>& sections, bool rawData)
 {
-	for (auto& i : m_sections)
+	auto sectionEnd = [&](const PESection& section) {
+		return (uint64_t)section.virtualAddress + (rawData ? section.sizeOfRawData : section.virtualSize);
+	};
+
+	vector<uint64_t> bounds;
+	for (auto& section : sections)
 	{
-		if ((offset >= i.virtualAddress) &&
-			(offset < (i.virtualAddress + i.sizeOfRawData)) && (i.virtualSize != 0))
+		if (section.virtualSize == 0)
+			continue;
+		bounds.push_back(section.virtualAddress);
+		bounds.push_back(sectionEnd(section));
+	}
+	sort(bounds.begin(), bounds.end());
+	bounds.erase(unique(bounds.begin(), bounds.end()), bounds.end());
+
+	vector<PESectionInterval> result;
+	for (auto start : bounds)
+	{
+		int32_t index = -1;
+		for (size_t i = 0; i < sections.size(); i++)
 		{
-			uint64_t progOfs = offset - i.virtualAddress;
-			return i.pointerToRawData + progOfs;
+			if ((sections[i].virtualSize != 0) && (start >= sections[i].virtualAddress) && (start < sectionEnd(sections[i])))
+			{
+				index = (int32_t)i;
+				break;
+			}
 		}
+		if (result.empty() || (result.back().section != index))
+			result.push_back({start, index});
 	}
+	return result;
+}
+
+
+void PEView::UpdateSectionIndex()
+{
+	if (m_indexedSectionCount == m_sections.size())
+		return;
+	m_rawDataIntervals = BuildSectionIntervals(m_sections, true);
+	m_virtualIntervals = BuildSectionIntervals(m_sections, false);
+	m_indexedSectionCount = m_sections.size();
+}
+
+
+const PESection* PEView::FindSection(const vector<PESectionInterval>& intervals, uint64_t rva)
+{
+	auto itr = upper_bound(intervals.begin(), intervals.end(), rva,
+		[](uint64_t rva, const PESectionInterval& interval) { return rva < interval.start; });
+	if ((itr == intervals.begin()) || ((itr - 1)->section < 0))
+		return nullptr;
+	return &m_sections[(itr - 1)->section];
+}
+
+
+BinaryReader& PEView::GetParentReader()
+{
+	if (!m_parentReader)
+	{
+		m_parentReader = make_unique<BinaryReader>(GetParentView(), LittleEndian);
+		m_parentReader->SetBufferSize();
+	}
+	return *m_parentReader;
+}
+
+
+uint64_t PEView::RVAToFileOffset(uint64_t offset, bool except)
+{
+	UpdateSectionIndex();
+	if (const PESection* section = FindSection(m_rawDataIntervals, offset))
+		return section->pointerToRawData + (offset - section->virtualAddress);
 
 	if (!except)
 		return offset;
@@ -2814,66 +2983,469 @@ uint64_t PEView::RVAToFileOffset(uint64_t offset, bool except)
 
 uint32_t PEView::GetRVACharacteristics(uint64_t offset)
 {
-	for (auto& i : m_sections)
-	{
-		if ((offset >= i.virtualAddress) && (offset < (i.virtualAddress + i.virtualSize)) && (i.virtualSize != 0))
-			return i.characteristics;
-	}
+	UpdateSectionIndex();
+	if (const PESection* section = FindSection(m_virtualIntervals, offset))
+		return section->characteristics;
 	return 0;
 }
 
 
 string PEView::ReadString(uint64_t rva)
 {
-	uint64_t offset = RVAToFileOffset(rva);
-	string result;
-	char data[STRING_READ_CHUNK_SIZE];
-	while (true)
-	{
-		size_t len = GetParentView()->Read(data, offset, STRING_READ_CHUNK_SIZE);
-		if (len == 0)
-			break;
+	BinaryReader& reader = GetParentReader();
+	reader.Seek(RVAToFileOffset(rva));
+	return reader.ReadCString();
+}
+
 
-		size_t i;
-		for (i = 0; i < len; i++)
+uint16_t PEView::Read16(uint64_t rva)
+{
+	BinaryReader& reader = GetParentReader();
+	reader.Seek(RVAToFileOffset(rva));
+	return reader.Read16();
+}
+
+
+uint32_t PEView::Read32(uint64_t rva)
+{
+	BinaryReader& reader = GetParentReader();
+	reader.Seek(RVAToFileOffset(rva));
+	return reader.Read32();
+}
+
+
+uint64_t PEView::Read64(uint64_t rva)
+{
+	BinaryReader& reader = GetParentReader();
+	reader.Seek(RVAToFileOffset(rva));
+	return reader.Read64();
+}
+
+
+static string ReadCStringAt(BinaryReader& reader, uint64_t offset)
+{
+	reader.Seek(offset);
+	return reader.ReadCString();
+}
+
+
+PEImportDirectoryRecords PEView::ReadImportDirectory()
+{
+	auto start = chrono::steady_clock::now();
+	PEImportDirectoryRecords records;
+	if ((m_dataDirs.size() <= IMAGE_DIRECTORY_ENTRY_IMPORT) || (m_dataDirs[IMAGE_DIRECTORY_ENTRY_IMPORT].virtualAddress == 0))
+		return records;
+
+	const PEDataDirectory& dir = m_dataDirs[IMAGE_DIRECTORY_ENTRY_IMPORT];
+	BinaryReader reader(GetParentView(), LittleEndian);
+	reader.SetBufferSize();
+	try
+	{
+		for (size_t numImportEntries = 0;; numImportEntries++)
 		{
-			if (data[i] == 0)
+			reader.Seek(RVAToFileOffset(dir.virtualAddress + (numImportEntries * 20)));
+			PEImportDirectoryEntry importDirEntry;
+			importDirEntry.lookup = reader.Read32();
+			importDirEntry.timestamp = reader.Read32();
+			importDirEntry.forwardChain = reader.Read32();
+			importDirEntry.nameAddress = reader.Read32();
+			importDirEntry.iat = reader.Read32();
+			if (importDirEntry.nameAddress == 0)
+			{
+				records.terminated = true;
 				break;
+			}
+
+			importDirEntry.name = ReadCStringAt(reader, RVAToFileOffset(importDirEntry.nameAddress));
+			PEImportRecord& record = records.imports.emplace_back();
+			record.entry = importDirEntry;
+			record.complete = false;
+
+			uint32_t entryOffset = importDirEntry.lookup;
+			if ((entryOffset == 0) && (importDirEntry.iat != 0))
+				entryOffset = importDirEntry.iat;
+			while (true)
+			{
+				PEImportThunkRecord thunk {};
+				reader.Seek(RVAToFileOffset(entryOffset));
+				if (m_is64)
+				{
+					thunk.entry = reader.Read64();
+					thunk.isOrdinal = (thunk.entry & 0x8000000000000000LL) != 0;
+					thunk.entry &= 0x7fffffffffffffffLL;
+				}
+				else
+				{
+					thunk.entry = reader.Read32();
+					thunk.isOrdinal = (thunk.entry & 0x80000000) != 0;
+					thunk.entry &= 0x7fffffff;
+				}
+				if ((!thunk.isOrdinal) && (thunk.entry == 0))
+					break;
+
+				if (!thunk.isOrdinal)
+				{
+					reader.Seek(RVAToFileOffset(thunk.entry));
+					thunk.hint = reader.Read16();
+					thunk.name = ReadCStringAt(reader, RVAToFileOffset(thunk.entry + 2));
+				}
+				record.thunks.push_back(std::move(thunk));
+				entryOffset += m_is64 ? 8 : 4;
+			}
+			record.complete = true;
 		}
+	}
+	catch (std::exception& e)
+	{
+		records.error = e.what();
+	}
+	records.readTime = MillisecondsSince(start);
+	return records;
+}
 
-		result += string(&data[0], &data[i]);
-		if (i < len)
-			break;
-		offset += len;
+
+// Marks the function start RVAs that fall inside any of the [start, end) ranges and returns how many do
+static size_t ValidateFunctionStarts(
+	const uint32_t* starts, size_t count, const vector<pair<uint32_t, uint32_t>>& ranges, uint8_t* valid)
+{
+	size_t validCount = 0;
+	size_t i = 0;
+#if defined(PE_SIMD_SSE2)
+	// SSE2 only has signed compares, so bias everything into the signed range first
+	const __m128i bias = _mm_set1_epi32((int)0x80000000);
+	for (; i + 4 <= count; i += 4)
+	{
+		__m128i value = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(starts + i)), bias);
+		__m128i inRange = _mm_setzero_si128();
+		for (const auto& [rangeStart, rangeEnd] : ranges)
+		{
+			__m128i low = _mm_set1_epi32((int)(rangeStart ^ 0x80000000));
+			__m128i high = _mm_set1_epi32((int)(rangeEnd ^ 0x80000000));
+			inRange = _mm_or_si128(inRange, _mm_andnot_si128(_mm_cmplt_epi32(value, low), _mm_cmplt_epi32(value, high)));
+		}
+		int mask = _mm_movemask_ps(_mm_castsi128_ps(inRange));
+		for (size_t j = 0; j < 4; j++)
+			valid[i + j] = (mask >> j) & 1;
+		validCount += (mask & 1) + ((mask >> 1) & 1) + ((mask >> 2) & 1) + ((mask >> 3) & 1);
 	}
-	return result;
+#elif defined(PE_SIMD_NEON)
+	const uint32x4_t one = vdupq_n_u32(1);
+	for (; i + 4 <= count; i += 4)
+	{
+		uint32x4_t value = vld1q_u32(starts + i);
+		uint32x4_t inRange = vdupq_n_u32(0);
+		for (const auto& [rangeStart, rangeEnd] : ranges)
+			inRange = vorrq_u32(inRange,
+				vandq_u32(vcgeq_u32(value, vdupq_n_u32(rangeStart)), vcltq_u32(value, vdupq_n_u32(rangeEnd))));
+		inRange = vandq_u32(inRange, one);
+		uint32_t lanes[4];
+		vst1q_u32(lanes, inRange);
+		for (size_t j = 0; j < 4; j++)
+			valid[i + j] = (uint8_t)lanes[j];
+		validCount += vaddvq_u32(inRange);
+	}
+#endif
+	for (; i < count; i++)
+	{
+		valid[i] = 0;
+		for (const auto& [rangeStart, rangeEnd] : ranges)
+		{
+			if ((starts[i] >= rangeStart) && (starts[i] < rangeEnd))
+			{
+				valid[i] = 1;
+				break;
+			}
+		}
+		validCount += valid[i];
+	}
+	return validCount;
 }
 
 
-uint16_t PEView::Read16(uint64_t rva)
+PEExceptionDirectoryRecords PEView::ReadExceptionDirectory(uint16_t machine, size_t entrySize)
 {
-	uint64_t ofs = RVAToFileOffset(rva);
+	auto start = chrono::steady_clock::now();
+	PEExceptionDirectoryRecords records;
+	const PEDataDirectory& dir = m_dataDirs[IMAGE_DIRECTORY_ENTRY_EXCEPTION];
+	const size_t wordsPerEntry = entrySize / 4;
+	const size_t numExceptionEntries = dir.size / entrySize;
 	BinaryReader reader(GetParentView(), LittleEndian);
-	reader.Seek(ofs);
-	return reader.Read16();
+	reader.SetBufferSize();
+
+	// The table normally lives in a single section and can be read in one go, otherwise it is read a
+	// word at a time so that everything up to the first unreadable entry is still used
+	vector<uint32_t> words;
+	try
+	{
+		const PESection* section = FindSection(m_rawDataIntervals, dir.virtualAddress);
+		bool contiguous = section && (FindSection(m_rawDataIntervals, dir.virtualAddress + dir.size - 1) == section);
+		if (contiguous)
+			reader.Seek(RVAToFileOffset(dir.virtualAddress));
+		if (!contiguous || !reader.TryReadArray(words, numExceptionEntries * wordsPerEntry))
+		{
+			words.clear();
+			for (size_t i = 0; i < numExceptionEntries * wordsPerEntry; i++)
+			{
+				reader.Seek(RVAToFileOffset(dir.virtualAddress + (i * 4)));
+				words.push_back(reader.Read32());
+			}
+		}
+	}
+	catch (std::exception& e)
+	{
+		records.error = e.what();
+	}
+
+	// Only entries that start inside an executable section are function starts, gaps between the
+	// sections are not code
+	vector<pair<uint32_t, uint32_t>> execRanges;
+	for (const auto& section : m_sections)
+	{
+		if ((section.characteristics & (PE_ATTR_CODE | PE_ATTR_EXEC)) == 0)
+			continue;
+		uint64_t end = (uint64_t)section.virtualAddress + max(section.virtualSize, section.sizeOfRawData);
+		if (end > section.virtualAddress)
+			execRanges.emplace_back(section.virtualAddress, (uint32_t)min<uint64_t>(end, UINT32_MAX));
+	}
+	if (execRanges.empty())
+		execRanges.emplace_back(0, UINT32_MAX);
+
+	const size_t count = words.size() / wordsPerEntry;
+	vector<uint32_t> beginAddresses(count);
+	for (size_t i = 0; i < count; i++)
+		beginAddresses[i] = words[i * wordsPerEntry];
+	vector<uint8_t> valid(count);
+	records.invalidEntries = count - ValidateFunctionStarts(beginAddresses.data(), count, execRanges, valid.data());
+
+	// Start and size of each function, the size is zero when the unwind data does not describe it
+	vector<pair<uint32_t, uint32_t>> functions;
+	functions.reserve(count);
+	BinaryReader unwindReader(GetParentView(), LittleEndian);
+	unwindReader.SetBufferSize();
+	records.entries.reserve(count);
+	try
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			const uint32_t* entry = &words[i * wordsPerEntry];
+			PEExceptionRecord record {};
+			record.beginAddress = entry[0];
+			uint32_t functionSize = 0;
+			switch (machine)
+			{
+				case IMAGE_FILE_MACHINE_AMD64:
+				case IMAGE_FILE_MACHINE_IA64:
+				{
+					record.unwindRva = entry[2];
+					functionSize = (entry[1] > entry[0]) ? (entry[1] - entry[0]) : 0;
+
+					// Keep the entry even if its unwind info is unreadable so the UNWIND_INFO variable is still defined
+					records.entries.push_back(record);
+					unwindReader.Seek(RVAToFileOffset(record.unwindRva));
+					records.entries.back().unwindInformation = unwindReader.Read32();
+					records.entries.back().unwindValid = true;
+
+					// Chained entries describe another part of a function whose start has its own entry
+					if (records.entries.back().unwindInformation & (UNW_FLAG_CHAININFO << 3))
+						continue;
+					break;
+				}
+				case IMAGE_FILE_MACHINE_ARM64:
+				{
+					records.entries.push_back(record);
+					uint32_t unwindData = entry[1];
+					if ((unwindData & 3) == 0)
+					{
+						// The function length is the low 18 bits of the first .xdata word, in units of 4 bytes
+						uint32_t xdata;
+						if (FindSection(m_rawDataIntervals, unwindData))
+						{
+							unwindReader.Seek(RVAToFileOffset(unwindData));
+							if (unwindReader.TryRead32(xdata))
+								functionSize = (xdata & 0x3ffff) * 4;
+						}
+					}
+					else
+					{
+						// Packed unwind data holds the function length in bits 2-12
+						functionSize = ((unwindData >> 2) & 0x7ff) * 4;
+					}
+					break;
+				}
+				case IMAGE_FILE_MACHINE_MIPSFPU:
+				case IMAGE_FILE_MACHINE_R4000:
+				case IMAGE_FILE_MACHINE_WCEMIPSV2:
+					records.entries.push_back(record);
+					functionSize = (entry[1] > entry[0]) ? (entry[1] - entry[0]) : 0;
+					break;
+				default:
+					records.entries.push_back(record);
+					break;
+			}
+			if (valid[i])
+				functions.emplace_back(record.beginAddress, functionSize);
+		}
+	}
+	catch (std::exception& e)
+	{
+		records.error = e.what();
+	}
+
+	sort(functions.begin(), functions.end());
+	functions.erase(unique(functions.begin(), functions.end(),
+		[](const auto& a, const auto& b) { return a.first == b.first; }), functions.end());
+	records.functionStarts.reserve(functions.size());
+	records.functionSizes.reserve(functions.size());
+	for (const auto& [functionStart, functionSize] : functions)
+	{
+		records.functionStarts.push_back(functionStart);
+		records.functionSizes.push_back(functionSize);
+	}
+
+	records.readTime = MillisecondsSince(start);
+	return records;
 }
 
 
-uint32_t PEView::Read32(uint64_t rva)
+PEExportDirectoryRecords PEView::ReadExportDirectory()
 {
-	uint64_t ofs = RVAToFileOffset(rva);
+	auto start = chrono::steady_clock::now();
+	PEExportDirectoryRecords records;
+	if ((m_dataDirs.size() <= IMAGE_DIRECTORY_ENTRY_EXPORT) || (m_dataDirs[IMAGE_DIRECTORY_ENTRY_EXPORT].size < 40))
+		return records;
+
 	BinaryReader reader(GetParentView(), LittleEndian);
-	reader.Seek(ofs);
-	return reader.Read32();
+	reader.SetBufferSize();
+	auto readTable = [&](auto& table, uint32_t rva, uint32_t count) {
+		using Element = typename std::remove_reference_t<decltype(table)>::value_type;
+		if (((uint64_t)count * sizeof(Element)) > GetParentView()->GetLength())
+			throw ReadException();
+		reader.Seek(RVAToFileOffset(rva));
+		if (!reader.TryReadArray(table, count))
+			throw ReadException();
+	};
+
+	try
+	{
+		PEExportDirectory dir;
+		reader.Seek(RVAToFileOffset(m_dataDirs[IMAGE_DIRECTORY_ENTRY_EXPORT].virtualAddress));
+		dir.characteristics = reader.Read32();
+		dir.timestamp = reader.Read32();
+		dir.majorVersion = reader.Read16();
+		dir.minorVersion = reader.Read16();
+		dir.dllNameAddress = reader.Read32();
+		dir.base = reader.Read32();
+		dir.functionCount = reader.Read32();
+		dir.nameCount = reader.Read32();
+		dir.addressOfFunctions = reader.Read32();
+		dir.addressOfNames = reader.Read32();
+		dir.addressOfNameOrdinals = reader.Read32();
+		records.dir = dir;
+
+		records.dllName = ReadCStringAt(reader, RVAToFileOffset(dir.dllNameAddress));
+
+		vector<uint32_t> funcs;
+		readTable(funcs, dir.addressOfFunctions, dir.functionCount);
+		records.funcs = std::move(funcs);
+
+		vector<uint32_t> nameAddrs;
+		if (dir.addressOfNames != 0)
+			readTable(nameAddrs, dir.addressOfNames, dir.nameCount);
+		records.nameAddrs = std::move(nameAddrs);
+
+		vector<uint16_t> nameOrdinals;
+		if (dir.addressOfNameOrdinals != 0)
+			readTable(nameOrdinals, dir.addressOfNameOrdinals, dir.nameCount);
+		records.nameOrdinals = std::move(nameOrdinals);
+
+		size_t nameCount = min<size_t>(dir.nameCount, min(records.nameAddrs->size(), records.nameOrdinals->size()));
+		records.names.reserve(nameCount);
+		for (size_t i = 0; i < nameCount; i++)
+			records.names.push_back(ReadCStringAt(reader, RVAToFileOffset((*records.nameAddrs)[i])));
+
+		uint32_t exportTableStart = m_dataDirs[IMAGE_DIRECTORY_ENTRY_EXPORT].virtualAddress;
+		uint32_t exportTableEnd = exportTableStart + m_dataDirs[IMAGE_DIRECTORY_ENTRY_EXPORT].size;
+		for (uint32_t rvAddr : *records.funcs)
+		{
+			if ((rvAddr != 0) && (rvAddr >= exportTableStart) && (rvAddr < exportTableEnd))
+				records.forwarderNames[rvAddr] = ReadCStringAt(reader, RVAToFileOffset(rvAddr));
+		}
+	}
+	catch (std::exception& e)
+	{
+		records.error = e.what();
+	}
+	records.readTime = MillisecondsSince(start);
+	return records;
 }
 
 
-uint64_t PEView::Read64(uint64_t rva)
+PEBaseRelocationRecords PEView::ReadBaseRelocationDirectory()
 {
-	uint64_t ofs = RVAToFileOffset(rva);
+	auto start = chrono::steady_clock::now();
+	PEBaseRelocationRecords records;
+	if (m_dataDirs.size() <= IMAGE_DIRECTORY_ENTRY_BASERELOC)
+		return records;
+
 	BinaryReader reader(GetParentView(), LittleEndian);
-	reader.Seek(ofs);
-	return reader.Read64();
+	reader.SetBufferSize();
+	try
+	{
+		PEDataDirectory dir = m_dataDirs[IMAGE_DIRECTORY_ENTRY_BASERELOC];
+		// Check if there is a '.reloc' section that is different than this directory entry
+		vector<PEDataDirectory> dirs = { m_dataDirs[IMAGE_DIRECTORY_ENTRY_BASERELOC]};
+		auto section = find_if(m_sections.begin(), m_sections.end(), [](const PESection& section) { return section.name == ".reloc"; });
+		if (section != m_sections.end())
+		{
+			if (section->virtualAddress != dir.virtualAddress)
+				dirs.push_back({ section->virtualAddress, section->sizeOfRawData });
+		}
+		for (auto& dir : dirs)
+		{
+			if (dir.size == 0 || dir.virtualAddress == 0)
+				continue;
+
+			reader.Seek(RVAToFileOffset(dir.virtualAddress));
+			uint64_t size = 0;
+			vector<uint16_t> relocEntries;
+			while (size < dir.size)
+			{
+				ImageBaseRelocation baseReloc;
+				baseReloc.VirtualAddress = reader.Read32() + m_imageBase;
+				baseReloc.SizeOfBlock = reader.Read32();
+				if (baseReloc.SizeOfBlock < 8)
+					break;
+				if (baseReloc.SizeOfBlock == 8)
+				{
+					size += baseReloc.SizeOfBlock;
+					continue;
+				}
+				size_t nEntries = (baseReloc.SizeOfBlock - 8) / sizeof(uint16_t);
+				if (!reader.TryReadArray(relocEntries, nEntries))
+					throw ReadException();
+				for (uint16_t relocEntry : relocEntries)
+				{
+					BNRelocationInfo reloc;
+					memset(&reloc, 0, sizeof(reloc));
+					reloc.nativeType = relocEntry >> 12;
+					if (!reloc.nativeType) // IMAGE_REL_BASED_ABSOLUTE relocations are skipped/used for padding
+						continue;
+					reloc.address = baseReloc.VirtualAddress + (relocEntry & 0xfff);
+					reloc.size = m_is64 ? 8 : 4;
+					reloc.pcRelative = false;
+					reloc.base = m_imageBase - m_peImageBase;
+					records.relocs.push_back(reloc);
+				}
+				size += baseReloc.SizeOfBlock;
+			}
+		}
+	}
+	catch (std::exception& e)
+	{
+		records.error = e.what();
+	}
+	records.readTime = MillisecondsSince(start);
+	return records;
 }
 
 
@@ -2,6 +2,8 @@
 
 #include "binaryninjaapi.h"
 #include <exception>
+#include <map>
+#include <optional>
 
 #ifdef WIN32
 #pragma warning(disable: 4005)
@@ -329,6 +331,13 @@ namespace BinaryNinja
 		uint32_t characteristics;
 	};
 
+	// Start of an RVA range and the index of the first section containing it, or -1 if no section does
+	struct PESectionInterval
+	{
+		uint64_t start;
+		int32_t section;
+	};
+
 	struct PEImportDirectoryEntry
 	{
 		uint32_t lookup;
@@ -394,6 +403,70 @@ namespace BinaryNinja
 		uint32_t SizeOfBlock;
 	};
 
+	// Records produced by the directory parsing stages, which read the file on worker threads while the view thread
+	// only turns the records into types, symbols and relocations. A stage that runs into malformed data keeps the
+	// records read so far and the error, which is reported after those records are defined.
+	struct PEImportThunkRecord
+	{
+		uint64_t entry;
+		bool isOrdinal;
+		uint16_t hint;
+		std::string name;
+	};
+
+	struct PEImportRecord
+	{
+		PEImportDirectoryEntry entry;
+		std::vector<PEImportThunkRecord> thunks;
+		bool complete;
+	};
+
+	struct PEImportDirectoryRecords
+	{
+		std::vector<PEImportRecord> imports;
+		bool terminated = false;
+		std::string error;
+		double readTime = 0;
+	};
+
+	struct PEExceptionRecord
+	{
+		uint32_t beginAddress;
+		uint32_t unwindRva;
+		uint32_t unwindInformation;
+		bool unwindValid;
+	};
+
+	struct PEExceptionDirectoryRecords
+	{
+		std::vector<PEExceptionRecord> entries;
+		std::vector<uint32_t> functionStarts;
+		std::vector<uint32_t> functionSizes;
+		size_t invalidEntries = 0;
+		std::string error;
+		double readTime = 0;
+	};
+
+	struct PEExportDirectoryRecords
+	{
+		std::optional<PEExportDirectory> dir;
+		std::optional<std::string> dllName;
+		std::optional<std::vector<uint32_t>> funcs;
+		std::optional<std::vector<uint32_t>> nameAddrs;
+		std::optional<std::vector<uint16_t>> nameOrdinals;
+		std::vector<std::string> names;
+		std::map<uint32_t, std::string> forwarderNames;
+		std::string error;
+		double readTime = 0;
+	};
+
+	struct PEBaseRelocationRecords
+	{
+		std::vector<BNRelocationInfo> relocs;
+		std::string error;
+		double readTime = 0;
+	};
+
 	struct CodeViewHeader
 	{
 		uint32_t signature;
@@ -454,6 +527,9 @@ namespace BinaryNinja
 		uint32_t m_sizeOfHeaders;
 		std::vector<PEDataDirectory> m_dataDirs;
 		std::vector<PESection> m_sections;
+		std::vector<PESectionInterval> m_rawDataIntervals, m_virtualIntervals;
+		size_t m_indexedSectionCount = 0;
+		std::unique_ptr<BinaryReader> m_parentReader;
 		Ref<Architecture> m_arch;
 		bool m_is64;
 		bool m_extractMangledTypes;
@@ -465,12 +541,19 @@ namespace BinaryNinja
 
 		Ref<Metadata> m_symExternMappingMetadata;
 
+		void UpdateSectionIndex();
+		const PESection* FindSection(const std::vector<PESectionInterval>& intervals, uint64_t rva);
+		BinaryReader& GetParentReader();
 		uint64_t RVAToFileOffset(uint64_t rva, bool except = true);
 		uint32_t GetRVACharacteristics(uint64_t rva);
 		std::string ReadString(uint64_t rva);
 		uint16_t Read16(uint64_t rva);
 		uint32_t Read32(uint64_t rva);
 		uint64_t Read64(uint64_t rva);
+		PEImportDirectoryRecords ReadImportDirectory();
+		PEExceptionDirectoryRecords ReadExceptionDirectory(uint16_t machine, size_t entrySize);
+		PEExportDirectoryRecords ReadExportDirectory();
+		PEBaseRelocationRecords ReadBaseRelocationDirectory();
 		void AddPESymbol(BNSymbolType type, const std::string& dll, const std::string& name, uint64_t addr,
 			BNSymbolBinding binding = NoBinding, uint64_t ordinal = 0, std::vector<Ref<TypeLibrary>> lib = {});
 